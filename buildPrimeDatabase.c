@@ -0,0 +1,563 @@
+/* Some fun with prime numbers. Program builds the prime database served by
+    server.js (database/primes.db): segments of SEGMENT_PRIMES consecutive
+    primes, stored as a start prime plus the gaps after it, encoded as -c
+    method (varint_delta by default, or half_gap; see gapCodec.c). A database
+    that already holds segments is extended to the new count: sieving resumes
+    after its last stored prime, in the database's own method.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o buildPrimeDatabase buildPrimeDatabase.c -pthread -lm -lsqlite3
+   Run by:     ./buildPrimeDatabase [-t threads] [-c method] [--profile[=json]]
+                                    [NAT primes] [database]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sqlite3.h>
+#include "timer.h"
+#include "eratosthenes.c"
+#include "gapCodec.c"
+
+void *threadSieveWindow(void *rank);
+void execOrDie(sqlite3 *db, const char *sql);
+void flushSegment(void);
+long unsigned int resumeSegments(void);
+void storedTotals(long unsigned int *primes, long unsigned int *segments);
+void stopBuild(int signal);
+
+// definitions
+#define SEGMENT_PRIMES 1000000          // primes per database segment
+#define WINDOW_SEGMENTS 64              // sieve segments per worker window
+#define WINDOW_SPAN (WINDOW_SEGMENTS * SIEVE_SEGMENT_SPAN)
+#define BATCH_SEGMENTS 100              // database segments per transaction
+#define PROGRESS_INTERVAL 100           // segments between progress lines
+#define SCHEMA_PATH "database/schema.sql"
+#define DEFAULT_DATABASE "database/primes.db"
+#define DEFAULT_TARGET 10000000000UL
+
+// global variables: the sieve workers fill a ring of window slots, which
+//  the main thread drains in order into database segments
+long unsigned int targetPrimes;
+int builderCodec;                       // compression_method of the blobs
+long unsigned int sieveLimit;
+uint32_t *builderBase;
+long unsigned int builderNumBase;
+long unsigned int nextWindow;
+long unsigned int windowOrigin;         // odd number window 0 starts at
+long unsigned int numSlots;
+unsigned char **slotGaps;               // encoded gaps after the first prime
+long unsigned int *slotBytes, *slotCapacity;
+long unsigned int *slotFirst, *slotCount;
+long unsigned int *slotWindow;          // window held, or waiting to be filled
+int *slotReady;
+int builderStop;
+pthread_mutex_t slotMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t slotFilled = PTHREAD_COND_INITIALIZER;
+pthread_cond_t slotDrained = PTHREAD_COND_INITIALIZER;
+
+// the database segment being assembled and the statements that store it
+sqlite3 *database;
+sqlite3_stmt *insertSegment, *updateProgress;
+unsigned char *segmentBlob;
+long unsigned int segmentBytes, segmentCount, segmentStart, segmentId;
+long unsigned int primesStored, lastPrime;
+long unsigned int primesResumed;        // stored before this run
+volatile sig_atomic_t builderInterrupted;
+double buildStart;
+time_t buildStartTime;                  // wall clock, for generation_progress
+
+int main(int argc, char * argv[]) {
+
+  const char *path = DEFAULT_DATABASE;
+  char *schema, sql[256];
+  FILE *f;
+  long schemaLength;
+  long unsigned int threads, n, w, slot, i, j, bytes, terminators, existing;
+  long unsigned int storedPrimes, storedSegments;
+  int errorCode;
+  long rank;
+  pthread_t *threadHandles;
+  int scope;
+  double finish;
+
+  if (parseThreadFlag(&argc, argv) != 0 || (builderCodec = parseCodecFlag(&argc, argv)) < 0
+      || profileInit(&argc, argv) != 0 || argc > 3) {
+    printf("Usage: %s [-t threads] [-c varint_delta|half_gap] [--profile[=json]] <optionally followed by [NAT primes] [database]>\n", argv[0]);
+    exit(-1);
+  }
+  targetPrimes = (argc >= 2) ? strtoul(argv[1], NULL, 10) : DEFAULT_TARGET;
+  if (argc == 3) {
+    path = argv[2];
+  }
+  if (targetPrimes == 0) {
+    printf("Usage: %s [-t threads] [-c varint_delta|half_gap] [--profile[=json]] <optionally followed by [NAT primes] [database]>\n", argv[0]);
+    exit(-1);
+  }
+
+  // open the database and apply the schema
+  if (strcmp(path, DEFAULT_DATABASE) == 0) {
+    mkdir("database", 0755);
+  }
+  if (sqlite3_open(path, &database) != SQLITE_OK) {
+    printf("Error opening database %s: %s\n", path, sqlite3_errmsg(database));
+    exit(1);
+  }
+  if ((f = fopen(SCHEMA_PATH, "r")) == NULL) {
+    printf("Error opening %s (run from the repository root)\n", SCHEMA_PATH);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  schemaLength = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  schema = (char *) malloc(schemaLength + 1);
+  schema[fread(schema, 1, schemaLength, f)] = '\0';
+  fclose(f);
+  execOrDie(database, "PRAGMA journal_mode = WAL");
+  execOrDie(database, "PRAGMA synchronous = NORMAL");
+  execOrDie(database, schema);
+  free(schema);
+
+  // an existing database keeps its codec and is extended from its last segment
+  segmentBlob = (unsigned char *) malloc(2 * SEGMENT_PRIMES);
+  segmentBytes = segmentCount = segmentId = primesStored = lastPrime = 0;
+  n = builderCodec;
+  existing = resumeSegments();
+  if (existing && (int) n != builderCodec) {
+    printf("Extending in %s, the database's compression method\n", codecName(builderCodec));
+  }
+  if (existing >= targetPrimes) {
+    printf("%s already holds %lu primes\n", path, existing);
+    exit(0);
+  }
+  primesResumed = existing;
+
+  // a partial last segment is rewritten in place as it fills up
+  sqlite3_prepare_v2(database, "INSERT OR REPLACE INTO prime_segments (segment_id, start_index, "
+                     "end_index, start_prime, segment_size, compressed_deltas) "
+                     "VALUES (?, ?, ?, ?, ?, ?)", -1, &insertSegment, NULL);
+  sqlite3_prepare_v2(database, "INSERT OR REPLACE INTO generation_progress (id, "
+                     "current_segment, current_number, primes_generated, start_time, "
+                     "last_update) VALUES (1, ?, ?, ?, datetime(?, 'unixepoch'), "
+                     "CURRENT_TIMESTAMP)", -1, &updateProgress, NULL);
+  sprintf(sql, "UPDATE database_metadata SET value = '%lu', updated_at = CURRENT_TIMESTAMP "
+               "WHERE key = 'target_prime_count'", targetPrimes);
+  execOrDie(database, sql);
+  execOrDie(database, "UPDATE database_metadata SET value = 'in_progress', "
+                      "updated_at = CURRENT_TIMESTAMP WHERE key = 'generation_status'");
+  sprintf(sql, "UPDATE database_metadata SET value = '%s', updated_at = CURRENT_TIMESTAMP "
+               "WHERE key = 'compression_method'", codecName(builderCodec));
+  execOrDie(database, sql);
+  if (builderCodec != CODEC_VARINT_DELTA) {
+    // readers that predate compression_method would misread the blobs
+    execOrDie(database, "UPDATE database_metadata SET value = '2.0', "
+                        "updated_at = CURRENT_TIMESTAMP WHERE key = 'version'");
+  }
+
+  if (existing) {
+    printf("Extending %s from %lu to %lu primes (%s), after %lu\n", path, existing,
+           targetPrimes, codecName(builderCodec), lastPrime);
+  } else {
+    printf("Building %lu primes into %s (%s)\n", targetPrimes, path, codecName(builderCodec));
+  }
+
+  GET_TIME(buildStart);
+  buildStartTime = time(NULL);
+
+  // p_n < n (ln n + ln ln n) for n >= 6 bounds the sieve
+  n = (targetPrimes < 6) ? 6 : targetPrimes;
+  sieveLimit = (long unsigned int) (n * (log((double) n) + log(log((double) n)))) + 16;
+  scope = profileBegin("base primes");
+  builderBase = sievePrimesUpTo(isqrt(sieveLimit), &builderNumBase);
+  profileEnd(scope);
+
+  threads = sieveThreadCount();
+  numSlots = 2 * threads;
+  slotGaps = (unsigned char **) malloc(sizeof(unsigned char *)*numSlots);
+  slotBytes = (long unsigned int *) calloc(numSlots, sizeof(long unsigned int));
+  slotCapacity = (long unsigned int *) calloc(numSlots, sizeof(long unsigned int));
+  slotFirst = (long unsigned int *) calloc(numSlots, sizeof(long unsigned int));
+  slotCount = (long unsigned int *) calloc(numSlots, sizeof(long unsigned int));
+  slotWindow = (long unsigned int *) malloc(sizeof(long unsigned int)*numSlots);
+  slotReady = (int *) calloc(numSlots, sizeof(int));
+  for (slot = 0; slot < numSlots; slot++) {
+    slotGaps[slot] = NULL;
+    slotWindow[slot] = slot;
+  }
+  builderStop = 0;
+  nextWindow = 0;
+  windowOrigin = lastPrime ? (lastPrime + 1) | 1 : 1;
+
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadSieveWindow, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+    }
+  }
+
+  // batches commit whole segments, so a crash or ^C loses at most a batch
+  //  and the next run resumes from the last committed one
+  builderInterrupted = 0;
+  signal(SIGINT, stopBuild);
+  signal(SIGTERM, stopBuild);
+  execOrDie(database, "BEGIN");
+  for (w = 0; primesStored + segmentCount < targetPrimes && !builderInterrupted; w++) {
+
+    // wait for window w
+    slot = w % numSlots;
+    scope = profileBegin("waiting for sieve");
+    pthread_mutex_lock(&slotMutex);
+    while (!(slotReady[slot] && slotWindow[slot] == w)) {
+      pthread_cond_wait(&slotFilled, &slotMutex);
+    }
+    pthread_mutex_unlock(&slotMutex);
+    profileEnd(scope);
+    scope = profileBegin("segment assembly");
+
+    // cut the window's primes into database segments: a prime that opens a
+    //  segment becomes its start_prime, every other one adds a gap
+    if (slotCount[slot] > 0) {
+      if (segmentCount > 0) {
+        segmentBytes += encodeGap(builderCodec, segmentBlob + segmentBytes, slotFirst[slot] - lastPrime);
+      } else {
+        segmentStart = slotFirst[slot];
+      }
+      segmentCount++;
+      lastPrime = slotFirst[slot];
+      i = 0;
+      while (1) {
+        if (segmentCount == SEGMENT_PRIMES || primesStored + segmentCount == targetPrimes) {
+          flushSegment();
+        }
+        if (i == slotBytes[slot] || primesStored == targetPrimes) {
+          break;
+        }
+        if (segmentCount == 0) {
+          lastPrime += decodeGap(builderCodec, slotGaps[slot], &i);
+          segmentStart = lastPrime;
+          segmentCount = 1;
+          continue;
+        }
+
+        // copy as many gaps as the segment (and the target) still has room for
+        n = SEGMENT_PRIMES - segmentCount;
+        if (n > targetPrimes - primesStored - segmentCount) {
+          n = targetPrimes - primesStored - segmentCount;
+        }
+        for (j = i, terminators = 0; j < slotBytes[slot] && terminators < n; terminators++) {
+          lastPrime += decodeGap(builderCodec, slotGaps[slot], &j);
+        }
+        bytes = j - i;
+        memcpy(segmentBlob + segmentBytes, slotGaps[slot] + i, bytes);
+        segmentBytes += bytes;
+        segmentCount += terminators;
+        i += bytes;
+      }
+    }
+    profileEnd(scope);
+
+    // hand the slot back for window w + numSlots
+    pthread_mutex_lock(&slotMutex);
+    slotReady[slot] = 0;
+    slotWindow[slot] = w + numSlots;
+    pthread_cond_broadcast(&slotDrained);
+    pthread_mutex_unlock(&slotMutex);
+  }
+
+  pthread_mutex_lock(&slotMutex);
+  builderStop = 1;
+  pthread_cond_broadcast(&slotDrained);
+  pthread_mutex_unlock(&slotMutex);
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+    }
+  }
+
+  // an interrupted build drops the segment it was assembling (a reloaded
+  //  partial one stays as stored); the next run sieves it again
+  storedTotals(&storedPrimes, &storedSegments);
+  sprintf(sql, "UPDATE database_metadata SET value = '%lu', updated_at = CURRENT_TIMESTAMP "
+               "WHERE key = 'last_generated_index'", storedPrimes);
+  execOrDie(database, sql);
+  sprintf(sql, "UPDATE database_metadata SET value = '%lu', updated_at = CURRENT_TIMESTAMP "
+               "WHERE key = 'total_segments'", storedSegments);
+  execOrDie(database, sql);
+  if (primesStored == targetPrimes) {
+    execOrDie(database, "UPDATE database_metadata SET value = 'completed', "
+                        "updated_at = CURRENT_TIMESTAMP WHERE key = 'generation_status'");
+  }
+  execOrDie(database, "COMMIT");
+  sqlite3_finalize(updateProgress);
+  sqlite3_finalize(insertSegment);
+  execOrDie(database, "PRAGMA wal_checkpoint(TRUNCATE)");
+  sqlite3_close(database);
+
+  GET_TIME(finish);
+
+  if (primesStored < targetPrimes) {
+    printf("\nInterrupted: %lu primes in %lu segments stored; run again to resume\n",
+           storedPrimes, storedSegments);
+  } else {
+    printf("\nDone: %lu primes in %lu segments (largest %lu)\n", primesStored, segmentId, lastPrime);
+  }
+  printf("\nCPU execution time: %0.6fs\n\n", finish - buildStart);
+
+  for (slot = 0; slot < numSlots; slot++) {
+    free(slotGaps[slot]);
+  }
+  free(threadHandles);
+  free(segmentBlob);
+  free(slotReady);
+  free(slotWindow);
+  free(slotCount);
+  free(slotFirst);
+  free(slotCapacity);
+  free(slotBytes);
+  free(slotGaps);
+  free(builderBase);
+
+  return 0;
+
+}
+
+/******************************************************************************
+* Function flushSegment stores the assembled segment through the prepared     *
+*  insert, committing and recording progress every BATCH_SEGMENTS segments.   *
+******************************************************************************/
+void flushSegment(void) {
+
+  char sql[160];
+  double now;
+  int scope;
+
+  scope = profileBegin("database write");
+  sqlite3_bind_int64(insertSegment, 1, (sqlite3_int64) segmentId);
+  sqlite3_bind_int64(insertSegment, 2, (sqlite3_int64) (primesStored + 1));
+  sqlite3_bind_int64(insertSegment, 3, (sqlite3_int64) (primesStored + segmentCount));
+  sqlite3_bind_int64(insertSegment, 4, (sqlite3_int64) segmentStart);
+  sqlite3_bind_int64(insertSegment, 5, (sqlite3_int64) segmentCount);
+  sqlite3_bind_blob(insertSegment, 6, segmentBlob, (int) segmentBytes, SQLITE_STATIC);
+  if (sqlite3_step(insertSegment) != SQLITE_DONE) {
+    printf("Error inserting segment %lu: %s\n", segmentId, sqlite3_errmsg(database));
+    exit(1);
+  } // end if
+  sqlite3_reset(insertSegment);
+
+  primesStored += segmentCount;
+  segmentId++;
+  segmentCount = 0;
+  segmentBytes = 0;
+
+  if (segmentId % BATCH_SEGMENTS == 0 || primesStored == targetPrimes) {
+    sqlite3_bind_int64(updateProgress, 1, (sqlite3_int64) segmentId);
+    sqlite3_bind_int64(updateProgress, 2, (sqlite3_int64) lastPrime);
+    sqlite3_bind_int64(updateProgress, 3, (sqlite3_int64) primesStored);
+    sqlite3_bind_int64(updateProgress, 4, (sqlite3_int64) buildStartTime);
+    sqlite3_step(updateProgress);
+    sqlite3_reset(updateProgress);
+    sprintf(sql, "UPDATE database_metadata SET value = '%lu', updated_at = CURRENT_TIMESTAMP "
+                 "WHERE key = 'last_generated_index'", primesStored);
+    execOrDie(database, sql);
+    execOrDie(database, "COMMIT");
+    execOrDie(database, "BEGIN");
+  } // end if
+  profileEnd(scope);
+  if (segmentId % PROGRESS_INTERVAL == 0) {
+    GET_TIME(now);
+    printf("Progress: %0.2f%% | Segment %lu | %lu primes | Rate: %0.0f/sec\n",
+           100.0 * primesStored / targetPrimes, segmentId, primesStored,
+           (primesStored - primesResumed) / (now - buildStart));
+    fflush(stdout);
+  } // end if
+
+} // end flushSegment
+
+/******************************************************************************
+* Function resumeSegments picks up after the last stored segment: a full one  *
+*  is followed by a new segment, a partial one (the end of an earlier, lower  *
+*  target) is reloaded to be filled up. Returns the primes already stored.    *
+******************************************************************************/
+long unsigned int resumeSegments(void) {
+
+  sqlite3_stmt *stmt;
+  long unsigned int startIndex, endIndex, size, bytes;
+  const unsigned char *blob;
+
+  if (sqlite3_prepare_v2(database, "SELECT segment_id, start_index, end_index, start_prime, "
+                         "segment_size, compressed_deltas FROM prime_segments "
+                         "ORDER BY segment_id DESC LIMIT 1", -1, &stmt, NULL) != SQLITE_OK) {
+    printf("Database error: %s\n", sqlite3_errmsg(database));
+    exit(1);
+  } // end if
+  if (sqlite3_step(stmt) != SQLITE_ROW) {
+    sqlite3_finalize(stmt);
+    return 0;
+  } // end if
+  if ((builderCodec = databaseCodec(database)) < 0) {
+    printf("Unknown compression_method; cannot extend\n");
+    exit(1);
+  } // end if
+
+  segmentId = (long unsigned int) sqlite3_column_int64(stmt, 0);
+  startIndex = (long unsigned int) sqlite3_column_int64(stmt, 1);
+  endIndex = (long unsigned int) sqlite3_column_int64(stmt, 2);
+  segmentStart = (long unsigned int) sqlite3_column_int64(stmt, 3);
+  size = (long unsigned int) sqlite3_column_int64(stmt, 4);
+  blob = (const unsigned char *) sqlite3_column_blob(stmt, 5);
+  bytes = (long unsigned int) sqlite3_column_bytes(stmt, 5);
+  lastPrime = segmentStart;
+  if (size == 0 || endIndex + 1 != startIndex + size || bytes > 2 * SEGMENT_PRIMES
+      || addGaps(builderCodec, blob, bytes, &lastPrime, size - 1) != 0) {
+    printf("Segment %lu is damaged; remove it to resume\n", segmentId);
+    exit(1);
+  } // end if
+
+  if (size < SEGMENT_PRIMES) {
+    memcpy(segmentBlob, blob, bytes);
+    segmentBytes = bytes;
+    segmentCount = size;
+    primesStored = startIndex - 1;
+  } else {
+    segmentId++;
+    primesStored = endIndex;
+  } // end if
+  sqlite3_finalize(stmt);
+
+  return endIndex;
+
+} // end resumeSegments
+
+/******************************************************************************
+* Function storedTotals reads the primes and segments prime_segments holds    *
+******************************************************************************/
+void storedTotals(long unsigned int *primes, long unsigned int *segments) {
+
+  sqlite3_stmt *stmt;
+
+  if (sqlite3_prepare_v2(database, "SELECT COUNT(*), COALESCE(MAX(end_index), 0) FROM prime_segments",
+                         -1, &stmt, NULL) != SQLITE_OK || sqlite3_step(stmt) != SQLITE_ROW) {
+    printf("Database error: %s\n", sqlite3_errmsg(database));
+    exit(1);
+  } // end if
+  *segments = (long unsigned int) sqlite3_column_int64(stmt, 0);
+  *primes = (long unsigned int) sqlite3_column_int64(stmt, 1);
+  sqlite3_finalize(stmt);
+
+} // end storedTotals
+
+/******************************************************************************
+* Function stopBuild asks the main loop to commit and stop                    *
+******************************************************************************/
+void stopBuild(int signal) {
+
+  (void) signal;
+  builderInterrupted = 1;
+
+} // end stopBuild
+
+/******************************************************************************
+* Function threadSieveWindow claims windows of WINDOW_SPAN numbers, waits for *
+*  its ring slot to be drained, then sieves the window into it: the first     *
+*  prime and the encoded gaps after it.                                       *
+******************************************************************************/
+void *threadSieveWindow(void *rank) {
+
+  long unsigned int w, slot, low, high, windowLow, windowHigh, words, k;
+  long unsigned int prime, previous, bytes, count, first, bound;
+  uint64_t *bits, word;
+  unsigned char *gaps;
+  int scope;
+
+  (void) rank;
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+
+  while (1) {
+    w = __atomic_fetch_add(&nextWindow, 1, __ATOMIC_RELAXED);
+    slot = w % numSlots;
+    pthread_mutex_lock(&slotMutex);
+    while (!builderStop && slotWindow[slot] != w) {
+      pthread_cond_wait(&slotDrained, &slotMutex);
+    } // end while
+    pthread_mutex_unlock(&slotMutex);
+    if (builderStop) {
+      break;
+    } // end if
+
+    // Brun-Titchmarsh: at most 2y/ln y primes in y numbers, <= 2 bytes a gap
+    //  (half_gap escapes take 3, but only past 510, far rarer than the slack)
+    bound = 2 * (2 * WINDOW_SPAN / (long unsigned int) log((double) WINDOW_SPAN) + 64);
+    if (slotCapacity[slot] < bound) {
+      free(slotGaps[slot]);
+      slotGaps[slot] = (unsigned char *) malloc(bound);
+      slotCapacity[slot] = bound;
+    } // end if
+    gaps = slotGaps[slot];
+
+    windowLow = windowOrigin + w * WINDOW_SPAN;
+    windowHigh = windowLow + WINDOW_SPAN - 1;
+    if (windowHigh > sieveLimit) {
+      windowHigh = sieveLimit;
+    } // end if
+    count = 0;
+    bytes = 0;
+    first = previous = 0;
+    if (w == 0 && windowOrigin == 1) {
+      first = previous = 2;
+      count = 1;
+    } // end if
+    for (low = windowLow; low <= windowHigh; low += SIEVE_SEGMENT_SPAN) {
+      high = (windowHigh - low < SIEVE_SEGMENT_SPAN) ? windowHigh
+                                                     : low + SIEVE_SEGMENT_SPAN - 1;
+      scope = profileBegin("segment marking");
+      sieveSegment(bits, low, high, builderBase, builderNumBase);
+      profileEnd(scope);
+      scope = profileBegin("extraction");
+      words = ((high - low) / 2 + 64) / 64;
+      for (k = 0; k < words; k++) {
+        word = bits[k];
+        while (word) {
+          prime = low + 2 * (k * 64 + __builtin_ctzll(word));
+          word &= word - 1;
+          if (count++ == 0) {
+            first = prime;
+          } else {
+            bytes += encodeGap(builderCodec, gaps + bytes, prime - previous);
+          } // end if
+          previous = prime;
+        } // end while
+      } // end for (k)
+      profileEnd(scope);
+    } // end for (low)
+
+    pthread_mutex_lock(&slotMutex);
+    slotFirst[slot] = first;
+    slotCount[slot] = count;
+    slotBytes[slot] = bytes;
+    slotReady[slot] = 1;
+    pthread_cond_broadcast(&slotFilled);
+    pthread_mutex_unlock(&slotMutex);
+  } // end while
+
+  free(bits);
+
+  return NULL;
+
+} // end threadSieveWindow
+
+/******************************************************************************
+* Function execOrDie runs sql and exits with sqlite's message if it fails     *
+******************************************************************************/
+void execOrDie(sqlite3 *db, const char *sql) {
+
+  char *error = NULL;
+
+  if (sqlite3_exec(db, sql, NULL, NULL, &error) != SQLITE_OK) {
+    printf("Database error: %s\n", error);
+    sqlite3_free(error);
+    exit(1);
+  } // end if
+
+} // end execOrDie
@@ -0,0 +1,386 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef CONSTELLATION_C
+#define CONSTELLATION_C
+
+#include "eratosthenes.c"
+#include "primeOutput.c"
+
+/* Prime constellations: the n in [lo, hi] for which every n + h, h in a
+    pattern of offsets such as {0, 2} (twins) or {0, 2, 6, 8} (quadruplets),
+    is prime.
+
+    Only n in residue classes mod TUPLE_WHEEL = 2*3*5*7*11*13 that keep every
+    n + h clear of the wheel primes can qualify (1485 of 30030 for twins), so
+    each admissible class is sieved on its own: candidate n = r + 30030 j is
+    one bit in j, and a sieving prime p > 13 crosses off, for each offset h,
+    the one class of j mod p where p divides n + h. Threads take blocks of j
+    and run every class over them; a block's matches are sorted and, when
+    listing, written in block order. Tuples that contain a wheel prime (n <=
+    13) are checked directly. */
+
+// content summary
+#define TUPLE_MAX_OFFSETS 8
+
+typedef struct {
+  int k;                                // number of offsets
+  long unsigned int offsets[TUPLE_MAX_OFFSETS];   // rising, the first 0
+} tuplePattern;
+
+int parsePattern(const char *text, tuplePattern *pattern);
+  /* parsePattern reads a pattern by name (twin, cousin, sexy, triplet,
+      quadruplet) or as rising offsets from 0 ("0,2,6"). Returns 0, or -1
+      if text is neither.
+      */
+long unsigned int countTuples(const tuplePattern *pattern, long unsigned int lo,
+                              long unsigned int hi, primeOutput *out);
+  /* countTuples returns the number of n in [lo, hi] (hi + the widest offset
+      below 2^64 - 2^32) whose whole pattern is prime, on all threads. If out
+      is not NULL each such n is also written to it, in order.
+      */
+void *threadTupleBlocks(void *rank);
+  /* threadTupleBlocks is the pthread body that claims and sieves blocks.
+      */
+int tupleIsPrime(long unsigned int n);
+  /* tupleIsPrime tests small n by trial division.
+      */
+long unsigned int inverseMod(long unsigned int a, long unsigned int m);
+  /* inverseMod returns the inverse of a mod m (a and m coprime).
+      */
+int compareTuples(const void *a, const void *b);
+  /* compareTuples is the qsort order of a block's matches.
+      */
+
+// definitions
+#define TUPLE_WHEEL 30030UL
+#define TUPLE_BLOCK_BITS (1UL << 20)    // j's per block, at most
+#define TUPLE_BLOCKS_PER_THREAD 4
+
+// named patterns
+const char *tupleNames[] = {"twin", "cousin", "sexy", "triplet", "quadruplet"};
+const char *tupleOffsets[] = {"0,2", "0,4", "0,6", "0,2,6", "0,2,6,8"};
+
+// global variables
+tuplePattern tuplePat;
+long unsigned int tupleLo, tupleHi;     // n range left to the wheel classes
+uint32_t *tupleResidues;
+long unsigned int tupleNumResidues;
+uint32_t *tupleBase;                    // sieving primes past the wheel
+uint32_t *tupleInverse;                 // TUPLE_WHEEL^-1 mod each of them
+long unsigned int tupleNumBase;
+long unsigned int tupleFirstJ, tupleBlockJ, tupleNumBlocks;
+long unsigned int tupleNextBlock;       // shared work counter
+long unsigned int *tupleCounts;         // per thread
+primeOutput *tupleOut;
+long unsigned int tupleTurn;            // next block to write
+pthread_mutex_t tupleMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t tupleWritten = PTHREAD_COND_INITIALIZER;
+
+/******************************************************************************
+* Function parsePattern                                                       *
+******************************************************************************/
+int parsePattern(const char *text, tuplePattern *pattern) {
+
+  long unsigned int i;
+  const char *p;
+  char *end;
+
+  for (i = 0; i < sizeof(tupleNames) / sizeof(tupleNames[0]); i++) {
+    if (strcmp(text, tupleNames[i]) == 0) {
+      text = tupleOffsets[i];
+    } // end if
+  } // end for
+
+  pattern->k = 0;
+  p = text;
+  while (*p) {
+    if (pattern->k == TUPLE_MAX_OFFSETS || *p < '0' || *p > '9') {
+      return -1;
+    } // end if
+    pattern->offsets[pattern->k] = strtoul(p, &end, 10);
+    if ((pattern->k == 0 && pattern->offsets[0] != 0)
+        || (pattern->k > 0 && pattern->offsets[pattern->k] <= pattern->offsets[pattern->k-1])
+        || pattern->offsets[pattern->k] > 1024) {
+      return -1;
+    } // end if
+    pattern->k++;
+    p = end;
+    if (*p == ',') {
+      p++;
+    } else if (*p) {
+      return -1;
+    } // end if
+  } // end while
+
+  return pattern->k ? 0 : -1;
+
+} // end parsePattern
+
+/******************************************************************************
+* Function tupleIsPrime                                                       *
+******************************************************************************/
+int tupleIsPrime(long unsigned int n) {
+
+  long unsigned int d;
+
+  if (n < 2) {
+    return 0;
+  } // end if
+  for (d = 2; d * d <= n; d++) {
+    if (n % d == 0) {
+      return 0;
+    } // end if
+  } // end for
+
+  return 1;
+
+} // end tupleIsPrime
+
+/******************************************************************************
+* Function inverseMod returns a^-1 mod m for coprime a, m (extended Euclid)   *
+******************************************************************************/
+long unsigned int inverseMod(long unsigned int a, long unsigned int m) {
+
+  long int t = 0, newT = 1, r = (long int) m, newR = (long int) (a % m), q, x;
+
+  while (newR != 0) {
+    q = r / newR;
+    x = t - q * newT;
+    t = newT;
+    newT = x;
+    x = r - q * newR;
+    r = newR;
+    newR = x;
+  } // end while
+
+  return (long unsigned int) (t < 0 ? t + (long int) m : t);
+
+} // end inverseMod
+
+/******************************************************************************
+* Function countTuples                                                        *
+******************************************************************************/
+long unsigned int countTuples(const tuplePattern *pattern, long unsigned int lo,
+                              long unsigned int hi, primeOutput *out) {
+
+  long unsigned int n, r, i, count = 0, numOdd, width, threads, lastJ;
+  const long unsigned int wheel[6] = {2, 3, 5, 7, 11, 13};
+  uint32_t *oddPrimes;
+  int h, w, errorCode, scope;
+  long rank;
+  pthread_t *threadHandles;
+
+  tuplePat = *pattern;
+  width = pattern->offsets[pattern->k - 1];
+
+  // tuples holding a wheel prime start at n <= 13
+  for (n = lo; n <= hi && n <= 13; n++) {
+    for (h = 0; h < pattern->k && tupleIsPrime(n + pattern->offsets[h]); h++);
+    if (h == pattern->k) {
+      count++;
+      if (out) {
+        primeOutputPrime(out, n);
+      } // end if
+    } // end if
+  } // end for
+  tupleLo = (lo > 14) ? lo : 14;
+  tupleHi = hi;
+  if (tupleLo > tupleHi) {
+    return count;
+  } // end if
+
+  // admissible classes: r + h prime to the wheel for every offset
+  scope = profileBegin("sieve init");
+  tupleResidues = (uint32_t *) malloc(sizeof(uint32_t)*TUPLE_WHEEL);
+  tupleNumResidues = 0;
+  for (r = 0; r < TUPLE_WHEEL; r++) {
+    for (h = 0; h < pattern->k; h++) {
+      for (w = 0; w < 6 && (r + pattern->offsets[h]) % wheel[w]; w++);
+      if (w < 6) {
+        break;
+      } // end if
+    } // end for (h)
+    if (h == pattern->k) {
+      tupleResidues[tupleNumResidues++] = (uint32_t) r;
+    } // end if
+  } // end for (r)
+  profileEnd(scope);
+
+  // sieving primes past the wheel up to sqrt(hi + width)
+  scope = profileBegin("base primes");
+  oddPrimes = sievePrimesUpTo(isqrt(hi + width), &numOdd);
+  tupleBase = (uint32_t *) malloc(sizeof(uint32_t)*(numOdd + 1));
+  tupleInverse = (uint32_t *) malloc(sizeof(uint32_t)*(numOdd + 1));
+  tupleNumBase = 0;
+  for (i = 0; i < numOdd; i++) {
+    if (oddPrimes[i] > 13) {
+      tupleBase[tupleNumBase] = oddPrimes[i];
+      tupleInverse[tupleNumBase++] = (uint32_t) inverseMod(TUPLE_WHEEL, oddPrimes[i]);
+    } // end if
+  } // end for
+  free(oddPrimes);
+  profileEnd(scope);
+
+  // blocks of j, several per thread
+  threads = sieveThreadCount();
+  tupleFirstJ = tupleLo / TUPLE_WHEEL;
+  lastJ = tupleHi / TUPLE_WHEEL;
+  tupleBlockJ = ((lastJ - tupleFirstJ + 1) / (threads * TUPLE_BLOCKS_PER_THREAD) / 64 + 1) * 64;
+  if (tupleBlockJ > TUPLE_BLOCK_BITS) {
+    tupleBlockJ = TUPLE_BLOCK_BITS;
+  } // end if
+  tupleNumBlocks = (lastJ - tupleFirstJ) / tupleBlockJ + 1;
+  if (threads > tupleNumBlocks) {
+    threads = tupleNumBlocks;
+  } // end if
+  tupleNextBlock = 0;
+  tupleTurn = 0;
+  tupleOut = out;
+  tupleCounts = (long unsigned int *) calloc(threads, sizeof(long unsigned int));
+
+  scope = profileBegin("tuple threads");
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadTupleBlocks, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+    }
+  }
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+    }
+    count += tupleCounts[rank];
+  }
+  profileEnd(scope);
+
+  free(threadHandles);
+  free(tupleCounts);
+  free(tupleInverse);
+  free(tupleBase);
+  free(tupleResidues);
+
+  return count;
+
+} // end countTuples
+
+/******************************************************************************
+* Function compareTuples orders matches                                       *
+******************************************************************************/
+int compareTuples(const void *a, const void *b) {
+
+  long unsigned int x = *(const long unsigned int *) a;
+  long unsigned int y = *(const long unsigned int *) b;
+
+  return (x > y) - (x < y);
+
+} // end compareTuples
+
+/******************************************************************************
+* Function threadTupleBlocks runs every admissible class over a block of j.   *
+*  Candidate n = r + TUPLE_WHEEL (J + t) is bit t; p | n + h exactly when     *
+*  t = -(r + h + TUPLE_WHEEL J) TUPLE_WHEEL^-1 mod p. Crossing off starts at  *
+*  p^2, so a tuple member that is itself a sieving prime survives.            *
+******************************************************************************/
+void *threadTupleBlocks(void *rank) {
+
+  uint64_t *bits, word;
+  uint32_t *blockMod;
+  long unsigned int b, J, bitsInBlock, words, s, i, p, c, t, step, n, r, low;
+  long unsigned int count = 0, numMatches, capacity = 1024, *matches;
+  int h;
+
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*(tupleBlockJ / 64 + 1));
+  blockMod = (uint32_t *) malloc(sizeof(uint32_t)*(tupleNumBase + 1));
+  matches = (long unsigned int *) malloc(sizeof(long unsigned int)*capacity);
+
+  // claim blocks until the range is exhausted
+  while ((b = __atomic_fetch_add(&tupleNextBlock, 1, __ATOMIC_RELAXED)) < tupleNumBlocks) {
+    J = tupleFirstJ + b * tupleBlockJ;
+    bitsInBlock = (tupleHi / TUPLE_WHEEL - J < tupleBlockJ) ? tupleHi / TUPLE_WHEEL - J + 1 : tupleBlockJ;
+    words = (bitsInBlock + 63) / 64;
+    for (i = 0; i < tupleNumBase; i++) {
+      p = tupleBase[i];
+      blockMod[i] = (uint32_t) ((TUPLE_WHEEL % p) * (J % p) % p);
+    } // end for
+    numMatches = 0;
+
+    for (s = 0; s < tupleNumResidues; s++) {
+      r = tupleResidues[s];
+
+      // at the ends of the range a class may have no candidate in it at all
+      if (r + TUPLE_WHEEL * J > tupleHi || r + TUPLE_WHEEL * (J + bitsInBlock - 1) < tupleLo) {
+        continue;
+      } // end if
+      memset(bits, 0xff, sizeof(uint64_t)*words);
+      if (bitsInBlock % 64) {
+        bits[words-1] = (1ULL << (bitsInBlock % 64)) - 1;
+      } // end if
+
+      // run sieve
+      for (i = 0; i < tupleNumBase; i++) {
+        p = tupleBase[i];
+        for (h = 0; h < tuplePat.k; h++) {
+          c = (r + tuplePat.offsets[h] + blockMod[i]) % p;
+          t = c ? (p - c) * tupleInverse[i] % p : 0;
+
+          // composites below p^2 have a smaller factor (and n + h = p is prime)
+          low = r + tuplePat.offsets[h] + TUPLE_WHEEL * (J + t);
+          if (low < p * p) {
+            step = TUPLE_WHEEL * p;
+            t += (p * p - low + step - 1) / step * p;
+          } // end if
+          for (; t < bitsInBlock; t += p) {
+            bits[t >> 6] &= ~(1ULL << (t & 63));
+          } // end for (t)
+        } // end for (h)
+      } // end for (i)
+
+      // survivors in range
+      for (i = 0; i < words; i++) {
+        word = bits[i];
+        while (word) {
+          n = r + TUPLE_WHEEL * (J + i * 64 + __builtin_ctzll(word));
+          word &= word - 1;
+          if (n < tupleLo || n > tupleHi) {
+            continue;
+          } // end if
+          count++;
+          if (tupleOut) {
+            if (numMatches == capacity) {
+              capacity *= 2;
+              matches = (long unsigned int *) realloc(matches, sizeof(long unsigned int)*capacity);
+            } // end if
+            matches[numMatches++] = n;
+          } // end if
+        } // end while
+      } // end for (i)
+    } // end for (s)
+
+    // write the block's matches once every earlier block is written
+    if (tupleOut) {
+      qsort(matches, numMatches, sizeof(long unsigned int), compareTuples);
+      pthread_mutex_lock(&tupleMutex);
+      while (tupleTurn != b) {
+        pthread_cond_wait(&tupleWritten, &tupleMutex);
+      } // end while
+      for (i = 0; i < numMatches; i++) {
+        primeOutputPrime(tupleOut, matches[i]);
+      } // end for
+      tupleTurn++;
+      pthread_cond_broadcast(&tupleWritten);
+      pthread_mutex_unlock(&tupleMutex);
+    } // end if
+  } // end while
+
+  tupleCounts[(long) rank] = count;
+  free(matches);
+  free(blockMod);
+  free(bits);
+  return NULL;
+
+} // end threadTupleBlocks
+
+#endif
@@ -7,7 +7,7 @@ CREATE TABLE IF NOT EXISTS prime_segments (
     end_index BIGINT NOT NULL,
     start_prime BIGINT NOT NULL,
     segment_size INTEGER NOT NULL,     -- Number of primes in this segment
-    compressed_deltas BLOB NOT NULL,   -- Delta-encoded gaps (VLInt format)
+    compressed_deltas BLOB NOT NULL,   -- Delta-encoded gaps (format per compression_method)
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
     checksum TEXT                      -- For data integrity verification
 );
@@ -15,6 +15,7 @@ CREATE TABLE IF NOT EXISTS prime_segments (
 -- Indexes for fast lookups
 CREATE INDEX IF NOT EXISTS idx_prime_index_range ON prime_segments(start_index, end_index);
 CREATE INDEX IF NOT EXISTS idx_segment_id ON prime_segments(segment_id);
+CREATE INDEX IF NOT EXISTS idx_start_prime ON prime_segments(start_prime);  -- reverse lookups
 
 -- Metadata table for database info and configuration
 CREATE TABLE IF NOT EXISTS database_metadata (
@@ -23,15 +24,15 @@ CREATE TABLE IF NOT EXISTS database_metadata (
     updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 
--- Initial metadata
-INSERT OR REPLACE INTO database_metadata (key, value) VALUES 
+-- Initial metadata (kept when the schema is re-applied to an existing database)
+INSERT OR IGNORE INTO database_metadata (key, value) VALUES 
     ('version', '1.0'),
     ('target_prime_count', '10000000000'),  -- 10 billion
     ('segment_size', '1000000'),            -- 1M primes per segment
     ('generation_status', 'not_started'),
     ('last_generated_index', '0'),
     ('total_segments', '10000'),
-    ('compression_method', 'varint_delta');
+    ('compression_method', 'varint_delta'); -- or 'half_gap' (version 2.0), see gapCodec.c
 
 -- Progress tracking table for resumable generation
 CREATE TABLE IF NOT EXISTS generation_progress (
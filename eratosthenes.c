@@ -3,10 +3,18 @@
   Updated: November 5, 2016
 */
 
+#ifndef ERATOSTHENES_C
+#define ERATOSTHENES_C
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
 #include <pthread.h>
+#include <unistd.h>
+#include "instrument.c"
+#include "primeTables.c"
 
 // content summary
 long unsigned int *eratosthenesFull(long unsigned int n);
@@ -23,47 +31,119 @@ long unsigned int *eratosthenesPrime(long unsigned int n,
 long unsigned int *pth_eratosthenesPrime(long unsigned int n,
                                          long unsigned int *size);
   /* pth_eratosthenesPrime takes advantage of multicore processing using
-      pthreads to generate an array of unpredictable size (guaranteed to be less
-      than n, if n>3) containing all prime numbers between 1 and n (inclusive).
+      pthreads to generate the same array as eratosthenesPrime. The range is
+      cut into cache-sized segments which threads claim one at a time.
       */
 void *threadPartialSieve(void *rank);
-  /* threadPartialSieve uses pthreads to split the work of a reduced Sieve of
-      Eratosthenes between a number of threads. Parallelized, it can only be
-      used to find a list of prime numbers, not a full decomposition.
+  /* threadPartialSieve is the pthread body of pth_eratosthenesPrime. It keeps
+      claiming the next unsieved segment from a shared counter, sieves it into
+      a private buffer and stores that segment's primes, until none are left.
+      */
+int sieveThreadCount(void);
+  /* sieveThreadCount returns the number of threads the parallel sieves use:
+      numberOfThreads if set (e.g. by parseThreadFlag), else PRIME_THREADS
+      from the environment, else the number of online cores.
+      */
+int parseThreadFlag(int *argc, char *argv[]);
+  /* parseThreadFlag removes a "-t <threads>" option from argv, stores it in
+      numberOfThreads and returns 0, or returns -1 if the option is malformed.
+      */
+long unsigned int isqrt(long unsigned int n);
+  /* isqrt returns floor(sqrt(n)) computed exactly over the full 64-bit range.
+      */
+long unsigned int primeCountBound(long unsigned int n);
+  /* primeCountBound returns an upper bound on the number of primes <= n
+      (Rosser-Schoenfeld), used to size output arrays before sieving.
+      */
+uint32_t *sievePrimesUpTo(long unsigned int limit, long unsigned int *size);
+  /* sievePrimesUpTo returns an array of all odd primes <= limit (limit must
+      be below 2^32). Used to build the sieving primes for a segmented sieve.
+      */
+void sieveSegment(uint64_t *bits, long unsigned int low,
+                  long unsigned int high, const uint32_t *basePrimes,
+                  long unsigned int numBase);
+  /* sieveSegment sieves the odd numbers in [low, high] (low odd) into a
+      bit-packed segment where bit k stands for low+2k and is set iff that
+      number is prime. basePrimes must hold every odd prime <= sqrt(high).
+      */
+long unsigned int segmentPrimes(const uint64_t *bits, long unsigned int low,
+                                long unsigned int high,
+                                long unsigned int *primes);
+  /* segmentPrimes writes the primes marked in a sieved segment to primes, in
+      ascending order, and returns how many were written.
+      */
+void spfSegment(uint32_t *spf, long unsigned int low, long unsigned int high,
+                const uint32_t *basePrimes, long unsigned int numBase);
+  /* spfSegment fills a smallest-prime-factor segment for the odd numbers in
+      [low, high] (low odd): entry k belongs to low+2k and holds its smallest
+      prime factor, or 0 if low+2k is prime (or 1). Even numbers are left out
+      since their smallest prime factor is always 2.
       */
 
 // definitions
 #define TRUE 1
 #define FALSE 0
 
+// one segment is SIEVE_SEGMENT_WORDS 64-bit words of odd candidates, sized to
+//  stay resident in L1d while it is being crossed off
+#ifndef SIEVE_SEGMENT_WORDS
+#define SIEVE_SEGMENT_WORDS 4096
+#endif
+#define SIEVE_SEGMENT_SPAN ((long unsigned int) SIEVE_SEGMENT_WORDS * 128)
+
+// a smallest-prime-factor segment holds SPF_SEGMENT_ENTRIES 32-bit entries,
+//  one per odd number, sized to L2
+#ifndef SPF_SEGMENT_ENTRIES
+#define SPF_SEGMENT_ENTRIES 131072
+#endif
+#define SPF_SEGMENT_SPAN ((long unsigned int) SPF_SEGMENT_ENTRIES * 2)
+
 // global variables
-int *isPrimeArray;
-int numberOfThreads = 4;
+int numberOfThreads = 0;                    // 0 = decide at runtime
 long unsigned int globalN;
+uint32_t *globalBasePrimes;
+long unsigned int globalNumBase;
+long unsigned int globalNumSegments;
+long unsigned int nextSegment;              // shared work counter
+long unsigned int **segmentPrimeLists;
+long unsigned int *segmentPrimeCounts;
 
 /******************************************************************************
 * Function eratosthenesFull returns array of decomposed naturals of size n.   *
 *  this is not quite standard for a Sieve of Eratosthenes as it is typically  *
-*  used to find prime numbers, not "natural decomposition".                   *
+*  used to find prime numbers, not "natural decomposition". Each entry is the *
+*  smallest prime factor, filled in from odd-only segments by spfSegment.     *
 ******************************************************************************/
 long unsigned int *eratosthenesFull(long unsigned int n) {
 
-  long unsigned int *sieve, i, j;
+  long unsigned int *sieve, i, k, numBase, low, high;
+  uint32_t *basePrimes, *spf;
 
-  // allocate sieve memory and initialize
-  sieve = (long unsigned int *) malloc(sizeof(long unsigned int)*n);
-  for (i = 0; i < n; i++) {
-    sieve[i] = 1;
+  // allocate sieve memory; evens (and 1) need no sieving
+  sieve = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                       (n ? n : 1));
+  for (i = 1; i < n; i += 2) {
+    sieve[i] = 2;
   } // end for
-
-  // run sieve
-  for (i = 0; i < n; i++) {
-    for (j = i; j < n; j+=(i+1)) {
-      if (sieve[j] == 1) {
-        sieve[j] = i+1;
-      } // end if
-    } // end for (j)
-  } // end for (i)
+  if (n >= 1) {
+    sieve[0] = 1;
+  } // end if
+
+  // run sieve over the odd numbers, one segment at a time
+  basePrimes = sievePrimesUpTo(isqrt(n), &numBase);
+  spf = (uint32_t *) malloc(sizeof(uint32_t)*SPF_SEGMENT_ENTRIES);
+  for (low = 3; low <= n; low += SPF_SEGMENT_SPAN) {
+    high = (n - low < SPF_SEGMENT_SPAN) ? n : low + SPF_SEGMENT_SPAN - 2;
+    spfSegment(spf, low, high, basePrimes, numBase);
+    for (k = 0; low + 2 * k <= high; k++) {
+      sieve[low + 2 * k - 1] = spf[k] ? spf[k] : low + 2 * k;
+    } // end for (k)
+    if (high == n) {
+      break;
+    } // end if
+  } // end for
+  free(spf);
+  free(basePrimes);
 
   return sieve;
 
@@ -71,112 +151,409 @@ long unsigned int *eratosthenesFull(long unsigned int n) {
 
 /******************************************************************************
 * Function eratosthenesPrime returns array of prime numbers between 1 and n.  *
-*  Also assigns number of primes in returned array to size.                   *
+*  Also assigns number of primes in returned array to size. As it always has, *
+*  the list opens with 1. Built on the bit-packed segmented sieve below, so   *
+*  the working set is one segment plus the sieving primes up to sqrt(n).      *
 ******************************************************************************/
 long unsigned int *eratosthenesPrime(long unsigned int n,
                                      long unsigned int *size) {
 
-  long unsigned int *sieve, *primes, primeCount, lastPrime, i;
+  uint32_t *basePrimes;
+  uint64_t *bits;
+  long unsigned int *primes, primeCount, numBase, low, high;
+  int scope;
 
-  // run sieve
-  sieve = eratosthenesFull(n);
-
-  // get primeCount
+  // allocate primes memory (shrunk to fit once the count is known)
+  scope = profileBegin("sieve init");
+  primes = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                        (primeCountBound(n)+1));
   primeCount=0;
-  lastPrime=1;
-  for (i = 0; i < n; i++) {
-    if (sieve[i] >= lastPrime) {
-      lastPrime = sieve[i];
-      primeCount++;
-    } // end if
-  } // end for
-  *size=primeCount;
-
-  // allocate primes memory
-  primes = (long unsigned int *) malloc(sizeof(long unsigned int)*primeCount);
+  if (n >= 1) {
+    primes[primeCount++] = 1;
+  }
+  if (n >= 2) {
+    primes[primeCount++] = 2;
+  }
 
-  // build primes
-  primeCount=0;
-  lastPrime=1;
-  for (i = 0; i < n; i++) {
-    if (sieve[i] >= lastPrime) {
-      lastPrime = sieve[i];
-      primes[primeCount] = sieve[i];
-      primeCount++;
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  profileEnd(scope);
+
+  // run sieve one segment of odd numbers at a time
+  scope = profileBegin("base primes");
+  basePrimes = sievePrimesUpTo(isqrt(n), &numBase);
+  profileEnd(scope);
+  for (low = 3; low <= n; low += SIEVE_SEGMENT_SPAN) {
+    high = (n - low < SIEVE_SEGMENT_SPAN) ? n : low + SIEVE_SEGMENT_SPAN - 2;
+    scope = profileBegin("segment marking");
+    sieveSegment(bits, low, high, basePrimes, numBase);
+    profileEnd(scope);
+    scope = profileBegin("extraction");
+    primeCount += segmentPrimes(bits, low, high, primes + primeCount);
+    profileEnd(scope);
+    if (high == n) {
+      break;
     } // end if
   } // end for
+  free(bits);
+  free(basePrimes);
 
-  return primes;
+  *size=primeCount;
+  return (long unsigned int *) realloc(primes,
+                                       sizeof(long unsigned int)*
+                                       (primeCount ? primeCount : 1));
 
 } // end eratosthenesPrime
 
 /******************************************************************************
-* Function pth_eratosthenesPrime is a parallelized - but reduced - sieve      *
+* Function pth_eratosthenesPrime is a parallelized segmented sieve. Threads   *
+*  share nothing but the read-only sieving primes and a segment counter, so   *
+*  load balances itself and no two threads write the same cache line.         *
 ******************************************************************************/
 long unsigned int *pth_eratosthenesPrime(long unsigned int n,
                                          long unsigned int *size) {
 
-  int errorCode;
+  int errorCode, threads, scope;
   long rank;
-  long unsigned int *primes, i, j, primeCount;
-  pthread_t * threadHandles = (pthread_t *) malloc(numberOfThreads * sizeof(pthread_t));
-  globalN=n;
-
-  // allocate global "isPrimeArray" memory and initialize all to "Prime"
-  isPrimeArray = (int *) malloc(sizeof(int)*n);
-  for (i = 0; i < n; i++) {
-    isPrimeArray[i] = TRUE;
-  }
-
-  for (rank = 0; rank < numberOfThreads; rank++) {
-    if (errorCode = pthread_create(&threadHandles[rank], NULL, threadPartialSieve, (void *) rank) != 0) {
+  long unsigned int *primes, i, primeCount;
+  pthread_t *threadHandles;
+
+  // set up shared state: sieving primes and one result slot per segment
+  globalN = n;
+  scope = profileBegin("base primes");
+  globalBasePrimes = sievePrimesUpTo(isqrt(n), &globalNumBase);
+  profileEnd(scope);
+  globalNumSegments = (n >= 3) ? (n - 3) / SIEVE_SEGMENT_SPAN + 1 : 0;
+  nextSegment = 0;
+  segmentPrimeLists = (long unsigned int **)
+    calloc(globalNumSegments + 1, sizeof(long unsigned int *));
+  segmentPrimeCounts = (long unsigned int *)
+    calloc(globalNumSegments + 1, sizeof(long unsigned int));
+
+  // no point in more threads than segments
+  threads = sieveThreadCount();
+  if ((long unsigned int) threads > globalNumSegments) {
+    threads = globalNumSegments ? (int) globalNumSegments : 1;
+  } // end if
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+
+  scope = profileBegin("sieve threads");
+  for (rank = 0; rank < threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadPartialSieve, (void *) rank)) != 0) {
       printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
     }
   }
 
-  for (rank = 0; rank < numberOfThreads; rank++) {
-    if (errorCode = pthread_join(threadHandles[rank], (void **) NULL) != 0) {
+  for (rank = 0; rank < threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
       printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
     }
   }
+  profileEnd(scope);
+  free(threadHandles);
 
   // get primeCount
-  primeCount=0;
-  for (i = 0; i < n; i++) {
-    if (isPrimeArray[i] == TRUE) {
-      primeCount++;
-    } // end if
+  primeCount = (n >= 1) + (n >= 2);
+  for (i = 0; i < globalNumSegments; i++) {
+    primeCount += segmentPrimeCounts[i];
   } // end for
   *size=primeCount;
 
   // allocate primes memory
-  primes = (long unsigned int *) malloc(sizeof(long unsigned int)*primeCount);
+  primes = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                        (primeCount ? primeCount : 1));
 
-  // build primes
+  // build primes, stitching the segments back together in order
+  scope = profileBegin("stitching");
   primeCount=0;
-  for (i = 0; i < n; i++) {
-    if (isPrimeArray[i] == TRUE) {
-      primes[primeCount] = i+1;
-      primeCount++;
-    } // end if
+  if (n >= 1) {
+    primes[primeCount++] = 1;
+  }
+  if (n >= 2) {
+    primes[primeCount++] = 2;
+  }
+  for (i = 0; i < globalNumSegments; i++) {
+    memcpy(primes + primeCount, segmentPrimeLists[i],
+           sizeof(long unsigned int)*segmentPrimeCounts[i]);
+    primeCount += segmentPrimeCounts[i];
+    free(segmentPrimeLists[i]);
   } // end for
 
+  free(segmentPrimeLists);
+  free(segmentPrimeCounts);
+  free(globalBasePrimes);
+  profileEnd(scope);
+
   return primes;
 
 } // end pth_eratosthenesPrime
 
 void *threadPartialSieve(void *rank) {
 
-  long unsigned int i, j;
+  uint64_t *bits;
+  long unsigned int *scratch, segment, low, high, count;
+  int scope;
+
+  (void) rank;
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  scratch = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                         SIEVE_SEGMENT_WORDS * 64);
+
+  // claim segments until the range is exhausted
+  while ((segment = __atomic_fetch_add(&nextSegment, 1, __ATOMIC_RELAXED))
+         < globalNumSegments) {
+    low = 3 + segment * SIEVE_SEGMENT_SPAN;
+    high = (globalN - low < SIEVE_SEGMENT_SPAN) ? globalN
+                                                : low + SIEVE_SEGMENT_SPAN - 2;
+    scope = profileBegin("segment marking");
+    sieveSegment(bits, low, high, globalBasePrimes, globalNumBase);
+    profileEnd(scope);
+    scope = profileBegin("extraction");
+    count = segmentPrimes(bits, low, high, scratch);
+    profileEnd(scope);
+    segmentPrimeLists[segment] = (long unsigned int *)
+      malloc(sizeof(long unsigned int)*(count ? count : 1));
+    memcpy(segmentPrimeLists[segment], scratch,
+           sizeof(long unsigned int)*count);
+    segmentPrimeCounts[segment] = count;
+  } // end while
+
+  free(scratch);
+  free(bits);
+  return NULL;
+
+} // end threadPartialSieve
+
+/******************************************************************************
+* Function sieveThreadCount resolves how many threads a parallel sieve uses   *
+******************************************************************************/
+int sieveThreadCount(void) {
+
+  char *env;
+  long cores;
+  int threads;
+
+  // explicit setting wins, then the environment, then the machine
+  if (numberOfThreads > 0) {
+    return numberOfThreads;
+  } // end if
+  env = getenv("PRIME_THREADS");
+  if (env != NULL && (threads = atoi(env)) > 0) {
+    return threads;
+  } // end if
+  cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return (cores > 0) ? (int) cores : 1;
+
+} // end sieveThreadCount
+
+/******************************************************************************
+* Function parseThreadFlag strips "-t <threads>" out of the argument list so  *
+*  the tools can keep checking their positional arguments by argc             *
+******************************************************************************/
+int parseThreadFlag(int *argc, char *argv[]) {
+
+  int i, j;
+
+  for (i = 1; i < *argc; i++) {
+    if (strcmp(argv[i], "-t") == 0) {
+      if (i + 1 >= *argc || (numberOfThreads = atoi(argv[i+1])) < 1) {
+        return -1;
+      } // end if
+      for (j = i; j + 2 <= *argc; j++) {
+        argv[j] = argv[j+2];
+      } // end for (j)
+      *argc -= 2;
+      i--;
+    } // end if
+  } // end for (i)
+
+  return 0;
+
+} // end parseThreadFlag
+
+/******************************************************************************
+* Function isqrt returns floor(sqrt(n)) without floating point rounding error *
+******************************************************************************/
+long unsigned int isqrt(long unsigned int n) {
+
+  long unsigned int r = (long unsigned int) sqrtl((long double) n);
+
+  // correct the estimate in either direction
+  while (r > 0 && r > n / r) {
+    r--;
+  } // end while
+  while (r + 1 <= n / (r + 1)) {
+    r++;
+  } // end while
+
+  return r;
+
+} // end isqrt
+
+/******************************************************************************
+* Function primeCountBound returns an upper bound on pi(n)                    *
+******************************************************************************/
+long unsigned int primeCountBound(long unsigned int n) {
+
+  // pi(n) < 1.25506 n / ln n holds for all n > 1
+  if (n < 17) {
+    return 7;
+  } // end if
+
+  return (long unsigned int) (1.25506 * (double) n / log((double) n)) + 1;
+
+} // end primeCountBound
+
+/******************************************************************************
+* Function sievePrimesUpTo returns the odd primes up to limit. The primes to  *
+*  sqrt(limit) (below 2^16) come from smallPrimeTable, the rest is segmented. *
+******************************************************************************/
+uint32_t *sievePrimesUpTo(long unsigned int limit, long unsigned int *size) {
+
+  const uint32_t *basePrimes;
+  uint32_t *primes;
+  uint64_t *bits;
+  long unsigned int *segment, root, numBase, primeCount, low, high, i, k;
+
+  // bootstrap: odd primes up to sqrt(limit), straight from the table
+  root = isqrt(limit);
+  basePrimes = smallPrimeTable + 1;
+  numBase = 0;
+  while (numBase < SMALL_TABLE_PRIMES - 1 && basePrimes[numBase] <= root) {
+    numBase++;
+  } // end while
+
+  // segmented pass over (root, limit]
+  primes = (uint32_t *) malloc(sizeof(uint32_t)*(primeCountBound(limit)+1));
+  segment = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                         SIEVE_SEGMENT_WORDS * 64);
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  primeCount = 0;
+  for (low = 3; low <= limit; low += SIEVE_SEGMENT_SPAN) {
+    high = (limit - low < SIEVE_SEGMENT_SPAN) ? limit
+                                              : low + SIEVE_SEGMENT_SPAN - 2;
+    sieveSegment(bits, low, high, basePrimes, numBase);
+    k = segmentPrimes(bits, low, high, segment);
+    for (i = 0; i < k; i++) {
+      primes[primeCount++] = (uint32_t) segment[i];
+    } // end for
+    if (high == limit) {
+      break;
+    } // end if
+  } // end for
+  free(bits);
+  free(segment);
+
+  *size = primeCount;
+  return (uint32_t *) realloc(primes, sizeof(uint32_t)*
+                                      (primeCount ? primeCount : 1));
+
+} // end sievePrimesUpTo
+
+/******************************************************************************
+* Function sieveSegment crosses off odd composites in [low, high]. Each base  *
+*  prime starts from its first odd multiple in range and strides by 2p, i.e.  *
+*  p bits, so composites are only ever touched by their prime factors.        *
+******************************************************************************/
+void sieveSegment(uint64_t *bits, long unsigned int low,
+                  long unsigned int high, const uint32_t *basePrimes,
+                  long unsigned int numBase) {
+
+  long unsigned int numBits, words, i, p, start, k;
+
+  // candidates start out as the numbers coprime to 3..13; clear the tail
+  //  past high
+  numBits = (high - low) / 2 + 1;
+  words = (numBits + 63) / 64;
+  presieveSegment(bits, low, words);
+  if (numBits % 64) {
+    bits[words-1] &= (1ULL << (numBits % 64)) - 1;
+  } // end if
 
   // run sieve
-  for (i = (long unsigned int) rank+1; i < sqrt(globalN); i+=numberOfThreads) {
-    for (j = i; j < globalN; j+=(i+1)) {
-      if (i > (long unsigned int) rank+1 && (i+1)%2 == 0) {break;}
-      if (j > i) {
-        isPrimeArray[j] = FALSE;
+  for (i = 0; i < numBase; i++) {
+    p = basePrimes[i];
+    if (p <= PRESIEVE_LARGEST) {
+      continue;
+    } // end if
+    if (p > high / p) {
+      break;
+    } // end if
+    start = p * p;
+    if (start < low) {
+      start = low + (p - low % p) % p;
+      if (start % 2 == 0) {
+        start += p;
       } // end if
-    } // end for (j)
+    } // end if
+    for (k = (start - low) / 2; k < numBits; k += p) {
+      bits[k >> 6] &= ~(1ULL << (k & 63));
+    } // end for (k)
   } // end for (i)
 
-} // end threadPartialSieve
+  // 1 is not prime
+  if (low == 1) {
+    bits[0] &= ~1ULL;
+  } // end if
+
+} // end sieveSegment
+
+/******************************************************************************
+* Function segmentPrimes extracts the set bits of a sieved segment            *
+******************************************************************************/
+long unsigned int segmentPrimes(const uint64_t *bits, long unsigned int low,
+                                long unsigned int high,
+                                long unsigned int *primes) {
+
+  long unsigned int words, w, primeCount = 0;
+  uint64_t word;
+
+  words = ((high - low) / 2 + 64) / 64;
+  for (w = 0; w < words; w++) {
+    word = bits[w];
+    while (word) {
+      primes[primeCount++] = low + 2 * (w * 64 + __builtin_ctzll(word));
+      word &= word - 1;
+    } // end while
+  } // end for
+
+  return primeCount;
+
+} // end segmentPrimes
+
+/******************************************************************************
+* Function spfSegment sieves smallest prime factors. Base primes go in        *
+*  ascending order and only claim entries still unset, so each odd composite  *
+*  keeps the first (smallest) prime that reaches it.                          *
+******************************************************************************/
+void spfSegment(uint32_t *spf, long unsigned int low, long unsigned int high,
+                const uint32_t *basePrimes, long unsigned int numBase) {
+
+  long unsigned int entries, i, p, start, k;
+
+  entries = (high - low) / 2 + 1;
+  memset(spf, 0, sizeof(uint32_t)*entries);
+
+  // run sieve
+  for (i = 0; i < numBase; i++) {
+    p = basePrimes[i];
+    if (p > high / p) {
+      break;
+    } // end if
+    start = p * p;
+    if (start < low) {
+      start = low + (p - low % p) % p;
+      if (start % 2 == 0) {
+        start += p;
+      } // end if
+    } // end if
+    for (k = (start - low) / 2; k < entries; k += p) {
+      if (spf[k] == 0) {
+        spf[k] = (uint32_t) p;
+      } // end if
+    } // end for (k)
+  } // end for (i)
+
+} // end spfSegment
+
+#endif
@@ -0,0 +1,236 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef FACTORIZATION_C
+#define FACTORIZATION_C
+
+#include <pthread.h>
+#include "primality.c"
+#include "eratosthenes.c"
+
+// content summary
+int factorize(long unsigned int n, long unsigned int *primes, int *exponents);
+  /* factorize writes the complete prime factorization of n to primes and
+      exponents (ascending, at most MAX_DISTINCT_FACTORS entries) and returns
+      the number of distinct primes. 0 and 1 have no factors and return 0.
+      */
+long unsigned int pollardBrent(long unsigned int n);
+  /* pollardBrent returns a nontrivial factor of the odd composite n using
+      Brent's variant of Pollard's rho in Montgomery arithmetic.
+      */
+long unsigned int gcd64(long unsigned int a, long unsigned int b);
+  /* gcd64 returns the greatest common divisor of a and b (binary algorithm).
+      */
+void buildFactorTable(void);
+  /* buildFactorTable fills the cached smallest-prime-factor table for the odd
+      numbers below FACTOR_TABLE_LIMIT. Called once through pthread_once.
+      */
+int factorSplit(long unsigned int n, long unsigned int *found, int count);
+  /* factorSplit appends the prime factors of odd n > 1 (with repetition, in
+      no particular order) to found[count..] and returns the new count.
+      */
+
+// definitions
+#define MAX_DISTINCT_FACTORS 15            // 2*3*5*...*47 < 2^64 < ...*53
+#define FACTOR_TABLE_LIMIT 2097152         // 2^21
+#define RHO_BATCH 128                      // rho steps per gcd
+
+// global variables
+uint32_t *factorTable;                     // odd m: spf of m, 0 if prime
+pthread_once_t factorTableOnce = PTHREAD_ONCE_INIT;
+
+/******************************************************************************
+* Function factorize: powers of two by ctz, then table lookups, primality     *
+*  tests and rho splits until every piece is prime; then sort and group.      *
+******************************************************************************/
+int factorize(long unsigned int n, long unsigned int *primes, int *exponents) {
+
+  long unsigned int found[64], t;
+  int count = 0, distinct = 0, twos, i, j;
+
+  if (n < 2) {
+    return 0;
+  } // end if
+  pthread_once(&factorTableOnce, buildFactorTable);
+
+  // factors of two
+  twos = __builtin_ctzl(n);
+  n >>= twos;
+  if (twos) {
+    primes[distinct] = 2;
+    exponents[distinct++] = twos;
+  } // end if
+
+  // odd part, unsorted
+  if (n > 1) {
+    count = factorSplit(n, found, 0);
+  } // end if
+
+  // insertion sort (at most 63 factors), then group equal primes
+  for (i = 1; i < count; i++) {
+    t = found[i];
+    for (j = i; j > 0 && found[j-1] > t; j--) {
+      found[j] = found[j-1];
+    } // end for (j)
+    found[j] = t;
+  } // end for (i)
+  for (i = 0; i < count; i++) {
+    if (i > 0 && found[i] == found[i-1]) {
+      exponents[distinct-1]++;
+    } else {
+      primes[distinct] = found[i];
+      exponents[distinct++] = 1;
+    } // end if
+  } // end for
+
+  return distinct;
+
+} // end factorize
+
+/******************************************************************************
+* Function factorSplit factors an odd n > 1                                   *
+******************************************************************************/
+int factorSplit(long unsigned int n, long unsigned int *found, int count) {
+
+  long unsigned int d, p;
+  int i;
+
+  // small cofactors come straight out of the table
+  while (n < FACTOR_TABLE_LIMIT) {
+    if (n == 1) {
+      return count;
+    } // end if
+    p = factorTable[n / 2] ? factorTable[n / 2] : n;
+    found[count++] = p;
+    n /= p;
+  } // end while
+
+  // cheap trial division by the small primes first
+  for (i = 1; i < SMALL_PRIME_COUNT; i++) {
+    while (n * smallPrimeInverses[i] <= smallPrimeLimits[i]) {
+      found[count++] = smallPrimes[i];
+      n /= smallPrimes[i];
+    } // end while
+  } // end for
+  if (n < FACTOR_TABLE_LIMIT) {
+    return factorSplit(n, found, count);
+  } // end if
+
+  if (isPrime(n)) {
+    found[count++] = n;
+    return count;
+  } // end if
+
+  // split and recurse on both halves
+  d = pollardBrent(n);
+  count = factorSplit(d, found, count);
+  return factorSplit(n / d, found, count);
+
+} // end factorSplit
+
+/******************************************************************************
+* Function pollardBrent iterates x -> x^2 + c, multiplying RHO_BATCH          *
+*  differences together between gcds and backtracking if a batch overshoots  *
+******************************************************************************/
+long unsigned int pollardBrent(long unsigned int n) {
+
+  uint64_t nInv, one, r2, c, x, y, ys, q, diff;
+  long unsigned int g, r, k, i, steps;
+
+  montgomery64(n, &nInv, &one, &r2);
+
+// y = y^2 + c (mod n), in Montgomery form
+#define RHO_STEP(y) { \
+  y = montMul64(y, y, n, nInv); \
+  y = (y >= n - c) ? y - (n - c) : y + c; \
+}
+
+  for (c = one; ; c = (c >= n - one) ? c - (n - one) : c + one) {
+    y = one + one >= n ? one + one - n : one + one;
+    q = one;
+    g = 1;
+    r = 1;
+    x = y;
+    ys = y;
+    do {
+      x = y;
+      for (i = 0; i < r; i++) {
+        RHO_STEP(y);
+      } // end for
+      k = 0;
+      do {
+        ys = y;
+        steps = (RHO_BATCH < r - k) ? RHO_BATCH : r - k;
+        for (i = 0; i < steps; i++) {
+          RHO_STEP(y);
+          diff = (x > y) ? x - y : y - x;
+          q = montMul64(q, diff, n, nInv);
+        } // end for
+        g = gcd64(q, n);
+        k += RHO_BATCH;
+      } while (k < r && g == 1);
+      r *= 2;
+    } while (g == 1);
+
+    // the batch hit a multiple of n: redo it one gcd at a time
+    if (g == n) {
+      do {
+        RHO_STEP(ys);
+        diff = (x > ys) ? x - ys : ys - x;
+        g = gcd64(diff, n);
+      } while (g == 1);
+    } // end if
+    if (g != n) {
+      return g;
+    } // end if
+  } // end for (c)
+
+#undef RHO_STEP
+
+} // end pollardBrent
+
+/******************************************************************************
+* Function gcd64 is Stein's binary gcd                                        *
+******************************************************************************/
+long unsigned int gcd64(long unsigned int a, long unsigned int b) {
+
+  long unsigned int t;
+  int shift;
+
+  if (a == 0 || b == 0) {
+    return a | b;
+  } // end if
+  shift = __builtin_ctzl(a | b);
+  a >>= __builtin_ctzl(a);
+  do {
+    b >>= __builtin_ctzl(b);
+    if (a > b) {
+      t = a;
+      a = b;
+      b = t;
+    } // end if
+    b -= a;
+  } while (b);
+
+  return a << shift;
+
+} // end gcd64
+
+/******************************************************************************
+* Function buildFactorTable sieves the cached table in one spfSegment call    *
+******************************************************************************/
+void buildFactorTable(void) {
+
+  uint32_t *basePrimes;
+  long unsigned int numBase;
+
+  basePrimes = sievePrimesUpTo(isqrt(FACTOR_TABLE_LIMIT), &numBase);
+  factorTable = (uint32_t *) malloc(sizeof(uint32_t)*FACTOR_TABLE_LIMIT / 2);
+  spfSegment(factorTable, 1, FACTOR_TABLE_LIMIT - 1, basePrimes, numBase);
+  free(basePrimes);
+
+} // end buildFactorTable
+
+#endif
@@ -0,0 +1,354 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef GAPANALYSIS_C
+#define GAPANALYSIS_C
+
+#include "eratosthenes.c"
+
+/* One pass over the primes up to n, straight from the segmented sieve, that
+    gathers the gap statistics primeDifference has always been after: the
+    gap histogram, the maximal (record) gaps, the average gap, and the runs
+    of k equal consecutive gaps (k = 2 the "bi-series", k = 3 the
+    "tri-series"). A run of L equal gaps holds floor(L/k) series, counted
+    without overlap as primeDifference always did.
+
+    The range is cut into chunks of whole sieve segments that threads claim
+    from a shared counter. Everything that does not depend on order
+    (histogram, series inside a chunk) goes into per-thread totals; each
+    chunk keeps just its ends (first and last prime, the runs of equal gaps
+    it opens and closes with) and its own rising maxima, which are stitched
+    together in order at the end. */
+
+// content summary
+#define GAP_BUCKETS 1024                // gaps 2..2046 (the largest below
+                                        //  2^64 is under 1600)
+
+typedef struct {
+  long unsigned int gap;
+  long unsigned int prime;              // the prime the gap follows
+} gapRecord;
+
+typedef struct {
+  long unsigned int n, k;
+  long unsigned int count;              // pi(n)
+  long unsigned int first, last;        // smallest and largest prime <= n
+  long unsigned int histogram[GAP_BUCKETS];   // gap g at g/2 (1 at 0)
+  long unsigned int series[GAP_BUCKETS];      // runs of k gaps g, at g/2
+  long unsigned int seriesFirst[GAP_BUCKETS]; // prime opening the first
+  long unsigned int numRecords;
+  gapRecord records[GAP_BUCKETS];       // maximal gaps, rising
+} gapStats;
+
+typedef struct {
+  long unsigned int first, last, count;
+  long unsigned int leadGap, leadLength;      // run of equal gaps at the start
+  long unsigned int trailGap, trailLength, trailStart;   // and at the end
+  int singleRun;                        // every gap in the chunk is equal
+  long unsigned int numRecords;
+  gapRecord *records;                   // the chunk's own rising maxima
+} gapChunk;
+
+gapStats *analyzeGaps(long unsigned int n, long unsigned int k);
+  /* analyzeGaps sieves the primes up to n (below 2^64 - 2^32) on all
+      threads and returns their gap statistics, with series of k (>= 2)
+      equal gaps. The caller frees the result.
+      */
+double averageGap(const gapStats *stats);
+  /* averageGap returns the mean gap between consecutive primes <= n.
+      */
+void *threadGapChunks(void *rank);
+  /* threadGapChunks is the pthread body that claims and analyzes chunks.
+      */
+void closeRun(gapStats *stats, long unsigned int gap, long unsigned int length,
+              long unsigned int start);
+  /* closeRun adds the floor(length/k) series of a finished run of equal
+      gaps opening at start.
+      */
+
+// definitions
+#define GAP_CHUNKS_PER_THREAD 8
+#define GAP_MAX_CHUNK_SEGMENTS 1024     // caps chunk length at ~5.4e8
+
+// global variables
+long unsigned int gapN;
+long unsigned int gapChunkSpan;
+long unsigned int gapNumChunks;
+long unsigned int gapNextChunk;         // shared work counter
+uint32_t *gapBase;
+long unsigned int gapNumBase;
+gapChunk *gapChunks;
+gapStats **gapThreadStats;
+
+/******************************************************************************
+* Function gapBucket maps a gap to its histogram slot (the last takes the     *
+*  overflow)                                                                  *
+******************************************************************************/
+static inline long unsigned int gapBucket(long unsigned int gap) {
+
+  return (gap / 2 < GAP_BUCKETS) ? gap / 2 : GAP_BUCKETS - 1;
+
+} // end gapBucket
+
+/******************************************************************************
+* Function analyzeGaps                                                        *
+******************************************************************************/
+gapStats *analyzeGaps(long unsigned int n, long unsigned int k) {
+
+  gapStats *stats;
+  gapChunk *chunk;
+  long unsigned int c, b, max, carryGap = 0, carryLength = 0, carryStart = 0;
+  long unsigned int previous = 0, i, threads;
+  int errorCode, scope;
+  long rank;
+  pthread_t *threadHandles;
+
+  stats = (gapStats *) calloc(1, sizeof(gapStats));
+  stats->n = n;
+  stats->k = k;
+
+  // chunks of whole segments, several per thread for balance
+  threads = sieveThreadCount();
+  gapN = n;
+  gapChunkSpan = (n / (threads * GAP_CHUNKS_PER_THREAD) / SIEVE_SEGMENT_SPAN + 1) * SIEVE_SEGMENT_SPAN;
+  if (gapChunkSpan > GAP_MAX_CHUNK_SEGMENTS * SIEVE_SEGMENT_SPAN) {
+    gapChunkSpan = GAP_MAX_CHUNK_SEGMENTS * SIEVE_SEGMENT_SPAN;
+  } // end if
+  gapNumChunks = (n >= 2) ? (n - 1) / gapChunkSpan + 1 : 0;
+  gapNextChunk = 0;
+  gapChunks = (gapChunk *) calloc(gapNumChunks + 1, sizeof(gapChunk));
+  if ((long unsigned int) threads > gapNumChunks) {
+    threads = gapNumChunks ? gapNumChunks : 1;
+  } // end if
+
+  scope = profileBegin("base primes");
+  gapBase = sievePrimesUpTo(isqrt(n), &gapNumBase);
+  profileEnd(scope);
+
+  scope = profileBegin("gap threads");
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  gapThreadStats = (gapStats **) malloc(threads * sizeof(gapStats *));
+  for (rank = 0; rank < (long) threads; rank++) {
+    gapThreadStats[rank] = (gapStats *) calloc(1, sizeof(gapStats));
+    gapThreadStats[rank]->k = k;
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadGapChunks, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+    }
+  }
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+    }
+  }
+  profileEnd(scope);
+
+  // order-free totals: histogram and the series inside chunks
+  scope = profileBegin("merge");
+  for (rank = 0; rank < (long) threads; rank++) {
+    for (b = 0; b < GAP_BUCKETS; b++) {
+      stats->histogram[b] += gapThreadStats[rank]->histogram[b];
+      stats->series[b] += gapThreadStats[rank]->series[b];
+      if (gapThreadStats[rank]->seriesFirst[b] && (stats->seriesFirst[b] == 0
+          || gapThreadStats[rank]->seriesFirst[b] < stats->seriesFirst[b])) {
+        stats->seriesFirst[b] = gapThreadStats[rank]->seriesFirst[b];
+      } // end if
+    } // end for (b)
+    free(gapThreadStats[rank]);
+  } // end for (rank)
+
+  // stitch the chunks in order: the gap across each boundary, the runs that
+  //  span boundaries, and the maximal gaps
+  max = 0;
+  for (c = 0; c < gapNumChunks; c++) {
+    chunk = &gapChunks[c];
+    if (chunk->count == 0) {
+      free(chunk->records);
+      continue;
+    } // end if
+    if (stats->count == 0) {
+      stats->first = chunk->first;
+    } else {
+      b = chunk->first - previous;
+      stats->histogram[gapBucket(b)]++;
+      if (b > max && stats->numRecords < GAP_BUCKETS) {
+        max = b;
+        stats->records[stats->numRecords].gap = b;
+        stats->records[stats->numRecords++].prime = previous;
+      } // end if
+      if (b == carryGap) {
+        carryLength++;
+      } else {
+        closeRun(stats, carryGap, carryLength, carryStart);
+        carryGap = b;
+        carryLength = 1;
+        carryStart = previous;
+      } // end if
+    } // end if
+    stats->count += chunk->count;
+    previous = stats->last = chunk->last;
+
+    for (i = 0; i < chunk->numRecords; i++) {
+      if (chunk->records[i].gap > max && stats->numRecords < GAP_BUCKETS) {
+        max = chunk->records[i].gap;
+        stats->records[stats->numRecords++] = chunk->records[i];
+      } // end if
+    } // end for (i)
+    free(chunk->records);
+
+    if (chunk->leadLength == 0) {
+      continue;
+    } // end if
+    if (chunk->leadGap == carryGap) {
+      carryLength += chunk->leadLength;
+    } else {
+      closeRun(stats, carryGap, carryLength, carryStart);
+      carryGap = chunk->leadGap;
+      carryLength = chunk->leadLength;
+      carryStart = chunk->first;
+    } // end if
+    if (!chunk->singleRun) {
+      closeRun(stats, carryGap, carryLength, carryStart);
+      carryGap = chunk->trailGap;
+      carryLength = chunk->trailLength;
+      carryStart = chunk->trailStart;
+    } // end if
+  } // end for (c)
+  closeRun(stats, carryGap, carryLength, carryStart);
+  profileEnd(scope);
+
+  free(threadHandles);
+  free(gapThreadStats);
+  free(gapChunks);
+  free(gapBase);
+
+  return stats;
+
+} // end analyzeGaps
+
+/******************************************************************************
+* Function closeRun                                                           *
+******************************************************************************/
+void closeRun(gapStats *stats, long unsigned int gap, long unsigned int length,
+              long unsigned int start) {
+
+  long unsigned int b;
+
+  if (length < stats->k) {
+    return;
+  } // end if
+  b = gapBucket(gap);
+  stats->series[b] += length / stats->k;
+  if (stats->seriesFirst[b] == 0 || start < stats->seriesFirst[b]) {
+    stats->seriesFirst[b] = start;
+  } // end if
+
+} // end closeRun
+
+/******************************************************************************
+* Function threadGapChunks sieves a chunk a segment at a time and walks its   *
+*  primes once. Runs of equal gaps that are closed inside the chunk (neither  *
+*  the first run nor the last) are counted here.                             *
+******************************************************************************/
+void *threadGapChunks(void *rank) {
+
+  gapStats *mine = gapThreadStats[(long) rank];
+  gapChunk *chunk;
+  gapRecord *records;
+  uint64_t *bits, word;
+  long unsigned int c, low, high, chunkLow, chunkHigh, words, w, prime;
+  long unsigned int previous, gap, max, runGap, runLength, runStart, count;
+  int leadOpen, scope;
+
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  records = (gapRecord *) malloc(sizeof(gapRecord)*GAP_BUCKETS);
+
+  // claim chunks until the range is exhausted
+  while ((c = __atomic_fetch_add(&gapNextChunk, 1, __ATOMIC_RELAXED)) < gapNumChunks) {
+    chunk = &gapChunks[c];
+    chunkLow = 1 + c * gapChunkSpan;
+    chunkHigh = (gapN - chunkLow < gapChunkSpan) ? gapN : chunkLow + gapChunkSpan - 1;
+    previous = max = runGap = runLength = runStart = count = 0;
+    chunk->numRecords = 0;
+    leadOpen = 1;
+    if (c == 0) {
+      chunk->first = previous = 2;
+      count = 1;
+    } // end if
+
+    for (low = chunkLow; low <= chunkHigh; low += SIEVE_SEGMENT_SPAN) {
+      high = (chunkHigh - low < SIEVE_SEGMENT_SPAN) ? chunkHigh : low + SIEVE_SEGMENT_SPAN - 1;
+      scope = profileBegin("segment marking");
+      sieveSegment(bits, low, high, gapBase, gapNumBase);
+      profileEnd(scope);
+
+      scope = profileBegin("gap scan");
+      words = ((high - low) / 2 + 64) / 64;
+      for (w = 0; w < words; w++) {
+        word = bits[w];
+        while (word) {
+          prime = low + 2 * (w * 64 + __builtin_ctzll(word));
+          word &= word - 1;
+          if (count++ == 0) {
+            chunk->first = previous = prime;
+            continue;
+          } // end if
+          gap = prime - previous;
+          mine->histogram[gapBucket(gap)]++;
+          if (gap > max && chunk->numRecords < GAP_BUCKETS) {
+            max = gap;
+            records[chunk->numRecords].gap = gap;
+            records[chunk->numRecords++].prime = previous;
+          } // end if
+          if (gap == runGap) {
+            runLength++;
+          } else {
+            if (leadOpen) {
+              chunk->leadGap = runGap;
+              chunk->leadLength = runLength;
+              leadOpen = (runLength == 0);
+            } else {
+              closeRun(mine, runGap, runLength, runStart);
+            } // end if
+            runGap = gap;
+            runLength = 1;
+            runStart = previous;
+          } // end if
+          previous = prime;
+        } // end while
+      } // end for (w)
+      profileEnd(scope);
+    } // end for (low)
+
+    // the run still open is the last; if none was closed it is also the first
+    chunk->count = count;
+    chunk->last = previous;
+    chunk->singleRun = leadOpen;
+    if (leadOpen) {
+      chunk->leadGap = runGap;
+      chunk->leadLength = runLength;
+    } // end if
+    chunk->trailGap = runGap;
+    chunk->trailLength = runLength;
+    chunk->trailStart = runStart;
+    chunk->records = (gapRecord *) malloc(sizeof(gapRecord)*(chunk->numRecords ? chunk->numRecords : 1));
+    memcpy(chunk->records, records, sizeof(gapRecord)*chunk->numRecords);
+  } // end while
+
+  free(records);
+  free(bits);
+  return NULL;
+
+} // end threadGapChunks
+
+/******************************************************************************
+* Function averageGap                                                         *
+******************************************************************************/
+double averageGap(const gapStats *stats) {
+
+  return (stats->count > 1) ? (double) (stats->last - stats->first) / (stats->count - 1) : 0.0;
+
+} // end averageGap
+
+#endif
@@ -0,0 +1,382 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef GAPCODEC_C
+#define GAPCODEC_C
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* The gap codecs a prime_segments blob can be written in, as named by
+    database_metadata.compression_method:
+
+    varint_delta  each gap as a little-endian base-128 varint (1.0 format)
+    half_gap      each gap g as the single byte g/2 when g is even and
+                   2 <= g <= 510, otherwise a 0 byte followed by g as a
+                   varint (only 2 -> 3, and gaps no database reaches yet)
+
+    Gaps past 2 are even, so half_gap keeps gaps from 128 to 510 in one byte
+    and, with escapes this rare, decodes as plain bytes: a block without a 0
+    byte is prefix-summed straight into absolute primes. */
+
+// content summary
+int codecFromName(const char *name);
+  /* codecFromName returns the codec called name, or -1 if there is none.
+      */
+const char *codecName(int codec);
+  /* codecName returns the compression_method value of codec.
+      */
+int parseCodecFlag(int *argc, char *argv[]);
+  /* parseCodecFlag strips "-c <method>" out of the argument list and returns
+      the codec named, varint_delta if there is no flag, or -1 if the method
+      is unknown.
+      */
+int encodeGap(int codec, unsigned char *out, long unsigned int gap);
+  /* encodeGap writes gap at out and returns the number of bytes written
+      (at most 11).
+      */
+long unsigned int decodeGap(int codec, const unsigned char *bytes,
+                            long unsigned int *i);
+  /* decodeGap returns the gap starting at bytes[*i] and moves *i past it.
+      The gap must be complete.
+      */
+long unsigned int completeGap(int codec, const unsigned char *bytes,
+                              long unsigned int i, long unsigned int length);
+  /* completeGap returns the byte length of the gap at bytes[i], or 0 if it
+      runs past length.
+      */
+long unsigned int countGaps(int codec, const unsigned char *bytes,
+                            long unsigned int length);
+  /* countGaps returns the number of complete gaps in bytes[0..length).
+      */
+long unsigned int addGaps(int codec, const unsigned char *bytes,
+                          long unsigned int length, long unsigned int *prime,
+                          long unsigned int steps);
+  /* addGaps adds the first steps gaps of bytes[0..length) to *prime and
+      returns how many it could not add for lack of bytes (0 normally).
+      */
+long unsigned int decodePrimes(int codec, const unsigned char *bytes,
+                               long unsigned int length,
+                               long unsigned int prime, uint64_t *out,
+                               long unsigned int max);
+  /* decodePrimes writes the primes following prime, up to max of them, to
+      out and returns how many it wrote.
+      */
+#ifdef SQLITE_VERSION
+int databaseCodec(sqlite3 *db);
+  /* databaseCodec returns the codec named by the database's
+      compression_method (varint_delta if it has none), or -1 if the method
+      is unknown.
+      */
+#endif
+
+// definitions
+#define CODEC_VARINT_DELTA 0
+#define CODEC_HALF_GAP 1
+#define CODEC_COUNT 2
+#define HALF_GAP_ESCAPE 0
+#define HIGH_BITS 0x8080808080808080ULL    // high bit of every byte
+#define ONE_BITS 0x0101010101010101ULL     // low bit of every byte
+
+const char *codecNames[CODEC_COUNT] = {"varint_delta", "half_gap"};
+
+/******************************************************************************
+* Function codecFromName                                                      *
+******************************************************************************/
+int codecFromName(const char *name) {
+
+  int codec;
+
+  for (codec = 0; codec < CODEC_COUNT; codec++) {
+    if (strcmp(name, codecNames[codec]) == 0) {
+      return codec;
+    } // end if
+  } // end for
+
+  return -1;
+
+} // end codecFromName
+
+/******************************************************************************
+* Function codecName                                                          *
+******************************************************************************/
+const char *codecName(int codec) {
+
+  return codecNames[codec];
+
+} // end codecName
+
+/******************************************************************************
+* Function parseCodecFlag works like parseThreadFlag                          *
+******************************************************************************/
+int parseCodecFlag(int *argc, char *argv[]) {
+
+  int i, j, codec = CODEC_VARINT_DELTA;
+
+  for (i = 1; i < *argc; i++) {
+    if (strcmp(argv[i], "-c") == 0) {
+      if (i + 1 >= *argc || (codec = codecFromName(argv[i+1])) < 0) {
+        return -1;
+      } // end if
+      for (j = i; j + 2 <= *argc; j++) {
+        argv[j] = argv[j+2];
+      } // end for (j)
+      *argc -= 2;
+      i--;
+    } // end if
+  } // end for (i)
+
+  return codec;
+
+} // end parseCodecFlag
+
+/******************************************************************************
+* Function encodeGap                                                          *
+******************************************************************************/
+int encodeGap(int codec, unsigned char *out, long unsigned int gap) {
+
+  int length = 0;
+
+  if (codec == CODEC_HALF_GAP) {
+    if (gap % 2 == 0 && gap >= 2 && gap <= 510) {
+      out[0] = (unsigned char) (gap / 2);
+      return 1;
+    } // end if
+    out[length++] = HALF_GAP_ESCAPE;
+  } // end if
+  while (gap >= 128) {
+    out[length++] = (unsigned char) ((gap & 127) | 128);
+    gap >>= 7;
+  } // end while
+  out[length++] = (unsigned char) gap;
+
+  return length;
+
+} // end encodeGap
+
+/******************************************************************************
+* Function decodeGap                                                          *
+******************************************************************************/
+long unsigned int decodeGap(int codec, const unsigned char *bytes,
+                            long unsigned int *i) {
+
+  long unsigned int gap = 0;
+  int shift = 0;
+
+  if (codec == CODEC_HALF_GAP && bytes[(*i)++] != HALF_GAP_ESCAPE) {
+    return 2 * (long unsigned int) bytes[*i - 1];
+  } // end if
+  while (bytes[*i] & 128) {
+    gap |= (long unsigned int) (bytes[(*i)++] & 127) << shift;
+    shift += 7;
+  } // end while
+  gap |= (long unsigned int) bytes[(*i)++] << shift;
+
+  return gap;
+
+} // end decodeGap
+
+/******************************************************************************
+* Function completeGap returns the length of the gap at bytes[i], or 0 if it  *
+*  runs past length                                                           *
+******************************************************************************/
+long unsigned int completeGap(int codec, const unsigned char *bytes,
+                              long unsigned int i, long unsigned int length) {
+
+  long unsigned int j = i;
+
+  if (codec == CODEC_HALF_GAP && bytes[j++] != HALF_GAP_ESCAPE) {
+    return 1;
+  } // end if
+  while (j < length && bytes[j] & 128) {
+    j++;
+  } // end while
+
+  return (j < length) ? j + 1 - i : 0;
+
+} // end completeGap
+
+/******************************************************************************
+* Function plainWord reports whether the 8 bytes at p are one gap each: no    *
+*  continuation bit for varint_delta, no escape byte for half_gap             *
+******************************************************************************/
+static inline int plainWord(int codec, const unsigned char *p, uint64_t *word) {
+
+  memcpy(word, p, 8);
+  if (codec == CODEC_HALF_GAP) {
+    return ((*word - ONE_BITS) & ~*word & HIGH_BITS) == 0;
+  } // end if
+
+  return (*word & HIGH_BITS) == 0;
+
+} // end plainWord
+
+/******************************************************************************
+* Function countGaps counts 8 plain bytes at a time                           *
+******************************************************************************/
+long unsigned int countGaps(int codec, const unsigned char *bytes,
+                            long unsigned int length) {
+
+  long unsigned int i = 0, count = 0, step;
+  uint64_t word;
+
+  while (i < length) {
+    if (length - i >= 8 && plainWord(codec, bytes + i, &word)) {
+      count += 8;
+      i += 8;
+    } else if ((step = completeGap(codec, bytes, i, length)) > 0) {
+      count++;
+      i += step;
+    } else {
+      break;
+    } // end if
+  } // end while
+
+  return count;
+
+} // end countGaps
+
+/******************************************************************************
+* Function addGaps sums 8 plain bytes at a time in 16-bit lanes: bytes are    *
+*  added pairwise into 4 lanes, and the multiply folds the lanes into the top *
+*  one (at most 8 * 255, so nothing carries out)                              *
+******************************************************************************/
+long unsigned int addGaps(int codec, const unsigned char *bytes,
+                          long unsigned int length, long unsigned int *prime,
+                          long unsigned int steps) {
+
+  long unsigned int i = 0, sum;
+  uint64_t word;
+
+  while (steps > 0 && i < length) {
+    if (steps >= 8 && length - i >= 8 && plainWord(codec, bytes + i, &word)) {
+      word = (word & 0x00ff00ff00ff00ffULL) + ((word >> 8) & 0x00ff00ff00ff00ffULL);
+      sum = (word * 0x0001000100010001ULL) >> 48;
+      *prime += (codec == CODEC_HALF_GAP) ? 2 * sum : sum;
+      steps -= 8;
+      i += 8;
+      continue;
+    } // end if
+    if (completeGap(codec, bytes, i, length) == 0) {
+      break;
+    } // end if
+    *prime += decodeGap(codec, bytes, &i);
+    steps--;
+  } // end while
+
+  return steps;
+
+} // end addGaps
+
+#ifdef __SSE2__
+/******************************************************************************
+* Function prefixHalfGaps turns 8 half-gaps in 16-bit lanes into 8 primes:    *
+*  a log-step prefix sum across the lanes, doubled, widened to 64 bits and    *
+*  offset by prime. Returns the last of them.                                 *
+******************************************************************************/
+static inline uint64_t prefixHalfGaps(__m128i lanes, uint64_t prime, uint64_t *out) {
+
+  __m128i zero = _mm_setzero_si128(), base = _mm_set1_epi64x((long long) prime);
+  __m128i low, high;
+
+  lanes = _mm_add_epi16(lanes, _mm_slli_si128(lanes, 2));
+  lanes = _mm_add_epi16(lanes, _mm_slli_si128(lanes, 4));
+  lanes = _mm_add_epi16(lanes, _mm_slli_si128(lanes, 8));
+  lanes = _mm_add_epi16(lanes, lanes);
+  low = _mm_unpacklo_epi16(lanes, zero);
+  high = _mm_unpackhi_epi16(lanes, zero);
+  _mm_storeu_si128((__m128i *) (out + 0), _mm_add_epi64(base, _mm_unpacklo_epi32(low, zero)));
+  _mm_storeu_si128((__m128i *) (out + 2), _mm_add_epi64(base, _mm_unpackhi_epi32(low, zero)));
+  _mm_storeu_si128((__m128i *) (out + 4), _mm_add_epi64(base, _mm_unpacklo_epi32(high, zero)));
+  _mm_storeu_si128((__m128i *) (out + 6), _mm_add_epi64(base, _mm_unpackhi_epi32(high, zero)));
+
+  return out[7];
+
+} // end prefixHalfGaps
+#endif
+
+/******************************************************************************
+* Function decodePrimes takes blocks of plain bytes at a time: 16 through the *
+*  SSE2 prefix sum for half_gap, 8 unrolled otherwise                         *
+******************************************************************************/
+long unsigned int decodePrimes(int codec, const unsigned char *bytes,
+                               long unsigned int length,
+                               long unsigned int prime, uint64_t *out,
+                               long unsigned int max) {
+
+  long unsigned int i = 0, k = 0;
+  uint64_t word;
+  int b;
+#ifdef __SSE2__
+  __m128i block, zero = _mm_setzero_si128();
+
+  if (codec == CODEC_HALF_GAP) {
+    while (max - k >= 16 && length - i >= 16) {
+      block = _mm_loadu_si128((const __m128i *) (bytes + i));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, zero)) != 0) {
+        if (completeGap(codec, bytes, i, length) == 0) {
+          return k;
+        } // end if
+        prime += decodeGap(codec, bytes, &i);
+        out[k++] = prime;
+        continue;
+      } // end if
+      prime = prefixHalfGaps(_mm_unpacklo_epi8(block, zero), prime, out + k);
+      prime = prefixHalfGaps(_mm_unpackhi_epi8(block, zero), prime, out + k + 8);
+      k += 16;
+      i += 16;
+    } // end while
+  } // end if
+#endif
+
+  while (k < max && i < length) {
+    if (max - k >= 8 && length - i >= 8 && plainWord(codec, bytes + i, &word)) {
+      for (b = 0; b < 8; b++) {
+        prime += (codec == CODEC_HALF_GAP) ? 2 * (word & 255) : (word & 255);
+        out[k++] = prime;
+        word >>= 8;
+      } // end for
+      i += 8;
+      continue;
+    } // end if
+    if (completeGap(codec, bytes, i, length) == 0) {
+      break;
+    } // end if
+    prime += decodeGap(codec, bytes, &i);
+    out[k++] = prime;
+  } // end while
+
+  return k;
+
+} // end decodePrimes
+
+#ifdef SQLITE_VERSION
+/******************************************************************************
+* Function databaseCodec reads database_metadata.compression_method           *
+******************************************************************************/
+int databaseCodec(sqlite3 *db) {
+
+  sqlite3_stmt *stmt;
+  int codec = CODEC_VARINT_DELTA;
+
+  if (sqlite3_prepare_v2(db, "SELECT value FROM database_metadata WHERE key = 'compression_method'",
+                         -1, &stmt, NULL) != SQLITE_OK) {
+    return codec;
+  } // end if
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    codec = codecFromName((const char *) sqlite3_column_text(stmt, 0));
+  } // end if
+  sqlite3_finalize(stmt);
+
+  return codec;
+
+} // end databaseCodec
+#endif
+
+#endif
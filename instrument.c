@@ -0,0 +1,353 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef INSTRUMENT_C
+#define INSTRUMENT_C
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/* Named, nestable timing scopes for the hot paths (base primes, segment
+    marking, extraction, output, ...). Off unless a tool is run with
+    --profile (summary) or --profile=json, in which case a tree of scopes
+    with calls, time and, where the kernel allows, cycles, instructions,
+    LLC misses and branch misses is written to stderr at exit.
+
+    Scopes nest per thread. Hardware counters are inherited by the threads a
+    tool creates, so they are read on the main thread only: a main-thread
+    scope includes the work of workers it waited for, and scopes opened on
+    worker threads report calls and time (summed over threads) alone. */
+
+// content summary
+int profileInit(int *argc, char *argv[]);
+  /* profileInit strips "--profile" or "--profile=json" out of the argument
+      list and, if present, turns profiling on and registers the report to
+      run at exit. Returns 0, or -1 if the option is malformed.
+      */
+int profileBegin(const char *name);
+  /* profileBegin opens a scope called name (a string literal) under the
+      calling thread's innermost open scope. Returns the scope's handle for
+      profileEnd, or -1 when profiling is off.
+      */
+void profileEnd(int scope);
+  /* profileEnd closes the scope profileBegin returned (ignores -1).
+      */
+void profileReport(void);
+  /* profileReport writes the scope tree as a summary or as JSON to stderr.
+      */
+uint64_t monotonicNanoseconds(void);
+  /* monotonicNanoseconds reads CLOCK_MONOTONIC.
+      */
+
+// definitions
+#define PROFILE_OFF 0
+#define PROFILE_SUMMARY 1
+#define PROFILE_JSON 2
+#define PROFILE_SCOPES 256              // distinct (parent, name) pairs
+#define PROFILE_DEPTH 32                // open scopes per thread
+#define PROFILE_COUNTERS 4
+
+typedef struct {
+  const char *name;
+  int parent;                           // -1 for a root
+  int mainThread;                       // counters are only read there
+  long unsigned int calls;
+  uint64_t nanoseconds;
+  uint64_t counters[PROFILE_COUNTERS];
+} profileScope;
+
+// global variables
+int profileMode = PROFILE_OFF;
+int profileNumScopes = 0;
+int profileFds[PROFILE_COUNTERS] = {-1, -1, -1, -1};
+pthread_t profileMainThread;
+pthread_mutex_t profileMutex = PTHREAD_MUTEX_INITIALIZER;
+profileScope profileScopes[PROFILE_SCOPES];
+const char *profileCounterNames[PROFILE_COUNTERS] = {
+  "cycles", "instructions", "llc_misses", "branch_misses"
+};
+
+// each thread's open scopes: handle, start time and counter readings
+__thread int profileDepth = 0;
+__thread int profileStack[PROFILE_DEPTH];
+__thread uint64_t profileStart[PROFILE_DEPTH];
+__thread uint64_t profileStartCounters[PROFILE_DEPTH][PROFILE_COUNTERS];
+
+/******************************************************************************
+* Function monotonicNanoseconds                                               *
+******************************************************************************/
+uint64_t monotonicNanoseconds(void) {
+
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+
+  return (uint64_t) t.tv_sec * 1000000000ULL + (uint64_t) t.tv_nsec;
+
+} // end monotonicNanoseconds
+
+/******************************************************************************
+* Function profileOpenCounters opens one inherited user-space counter per     *
+*  event; any the kernel refuses (no PMU, perf_event_paranoid) stay at -1     *
+******************************************************************************/
+void profileOpenCounters(void) {
+
+#ifdef __linux__
+  struct perf_event_attr attr;
+  const uint64_t configs[PROFILE_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+  };
+  int c;
+
+  for (c = 0; c < PROFILE_COUNTERS; c++) {
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[c];
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    profileFds[c] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  } // end for
+#endif
+
+} // end profileOpenCounters
+
+/******************************************************************************
+* Function profileReadCounters                                                *
+******************************************************************************/
+static inline void profileReadCounters(uint64_t *values) {
+
+  int c;
+
+  for (c = 0; c < PROFILE_COUNTERS; c++) {
+    values[c] = 0;
+    if (profileFds[c] >= 0 && read(profileFds[c], &values[c], sizeof(uint64_t)) != sizeof(uint64_t)) {
+      values[c] = 0;
+    } // end if
+  } // end for
+
+} // end profileReadCounters
+
+/******************************************************************************
+* Function profileInit works like parseThreadFlag                             *
+******************************************************************************/
+int profileInit(int *argc, char *argv[]) {
+
+  int i, j, mode = PROFILE_OFF;
+
+  for (i = 1; i < *argc; i++) {
+    if (strcmp(argv[i], "--profile") == 0) {
+      mode = PROFILE_SUMMARY;
+    } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+      if (strcmp(argv[i] + 10, "json") == 0) {
+        mode = PROFILE_JSON;
+      } else if (strcmp(argv[i] + 10, "summary") == 0) {
+        mode = PROFILE_SUMMARY;
+      } else {
+        return -1;
+      } // end if
+    } else {
+      continue;
+    } // end if
+    for (j = i; j + 1 <= *argc; j++) {
+      argv[j] = argv[j+1];
+    } // end for (j)
+    (*argc)--;
+    i--;
+  } // end for (i)
+
+  if (mode != PROFILE_OFF && profileMode == PROFILE_OFF) {
+    profileMainThread = pthread_self();
+    profileOpenCounters();
+    atexit(profileReport);
+  } // end if
+  if (mode != PROFILE_OFF) {
+    profileMode = mode;
+  } // end if
+
+  return 0;
+
+} // end profileInit
+
+/******************************************************************************
+* Function profileBegin finds or adds the (parent, name) scope and pushes it  *
+******************************************************************************/
+int profileBegin(const char *name) {
+
+  int parent, scope, mainThread;
+
+  if (profileMode == PROFILE_OFF || profileDepth == PROFILE_DEPTH) {
+    return -1;
+  } // end if
+  parent = profileDepth ? profileStack[profileDepth - 1] : -1;
+  mainThread = pthread_equal(pthread_self(), profileMainThread);
+
+  pthread_mutex_lock(&profileMutex);
+  for (scope = 0; scope < profileNumScopes; scope++) {
+    if (profileScopes[scope].parent == parent && profileScopes[scope].mainThread == mainThread
+        && strcmp(profileScopes[scope].name, name) == 0) {
+      break;
+    } // end if
+  } // end for
+  if (scope == profileNumScopes) {
+    if (profileNumScopes == PROFILE_SCOPES) {
+      pthread_mutex_unlock(&profileMutex);
+      return -1;
+    } // end if
+    memset(&profileScopes[scope], 0, sizeof(profileScope));
+    profileScopes[scope].name = name;
+    profileScopes[scope].parent = parent;
+    profileScopes[scope].mainThread = mainThread;
+    profileNumScopes++;
+  } // end if
+  pthread_mutex_unlock(&profileMutex);
+
+  profileStack[profileDepth] = scope;
+  if (mainThread) {
+    profileReadCounters(profileStartCounters[profileDepth]);
+  } // end if
+  profileStart[profileDepth++] = monotonicNanoseconds();
+
+  return scope;
+
+} // end profileBegin
+
+/******************************************************************************
+* Function profileEnd pops the scope and adds its time and counter deltas     *
+******************************************************************************/
+void profileEnd(int scope) {
+
+  uint64_t elapsed, counters[PROFILE_COUNTERS];
+  int c;
+
+  if (scope < 0 || profileDepth == 0 || profileStack[profileDepth - 1] != scope) {
+    return;
+  } // end if
+  elapsed = monotonicNanoseconds() - profileStart[--profileDepth];
+  if (profileScopes[scope].mainThread) {
+    profileReadCounters(counters);
+  } // end if
+
+  pthread_mutex_lock(&profileMutex);
+  profileScopes[scope].calls++;
+  profileScopes[scope].nanoseconds += elapsed;
+  if (profileScopes[scope].mainThread) {
+    for (c = 0; c < PROFILE_COUNTERS; c++) {
+      profileScopes[scope].counters[c] += counters[c] - profileStartCounters[profileDepth][c];
+    } // end for
+  } // end if
+  pthread_mutex_unlock(&profileMutex);
+
+} // end profileEnd
+
+/******************************************************************************
+* Function profileReportScope prints scope and, indented, its children. Self  *
+*  time is what the children do not account for.                             *
+******************************************************************************/
+void profileReportScope(int scope, int depth, int *first) {
+
+  profileScope *s = &profileScopes[scope];
+  uint64_t children = 0;
+  int child, c;
+
+  for (child = 0; child < profileNumScopes; child++) {
+    if (profileScopes[child].parent == scope && profileScopes[child].mainThread == s->mainThread) {
+      children += profileScopes[child].nanoseconds;
+    } // end if
+  } // end for
+
+  if (profileMode == PROFILE_JSON) {
+    fprintf(stderr, "%s\n    {\"scope\": \"%s\", \"parent\": %d, \"depth\": %d, \"thread\": \"%s\", "
+                    "\"calls\": %lu, \"seconds\": %.9f, \"self_seconds\": %.9f",
+            *first ? "" : ",", s->name, s->parent, depth, s->mainThread ? "main" : "worker",
+            s->calls, s->nanoseconds / 1e9,
+            (s->nanoseconds > children ? s->nanoseconds - children : 0) / 1e9);
+    for (c = 0; c < PROFILE_COUNTERS && s->mainThread; c++) {
+      if (profileFds[c] >= 0) {
+        fprintf(stderr, ", \"%s\": %lu", profileCounterNames[c], (long unsigned int) s->counters[c]);
+      } // end if
+    } // end for
+    fprintf(stderr, "}");
+  } else {
+    fprintf(stderr, "%*s%-*s %10lu %12.6f %12.6f", 2 * depth, "", 28 - 2 * depth, s->name,
+            s->calls, s->nanoseconds / 1e9,
+            (s->nanoseconds > children ? s->nanoseconds - children : 0) / 1e9);
+    if (s->mainThread && profileFds[0] >= 0 && profileFds[1] >= 0) {
+      fprintf(stderr, " %14lu %6.2f", (long unsigned int) s->counters[0],
+              s->counters[0] ? (double) s->counters[1] / s->counters[0] : 0.0);
+    } else {
+      fprintf(stderr, " %14s %6s", "-", "-");
+    } // end if
+    for (c = 2; c < PROFILE_COUNTERS; c++) {
+      if (s->mainThread && profileFds[c] >= 0) {
+        fprintf(stderr, " %12lu", (long unsigned int) s->counters[c]);
+      } else {
+        fprintf(stderr, " %12s", "-");
+      } // end if
+    } // end for
+    fprintf(stderr, "\n");
+  } // end if
+  *first = 0;
+
+  for (child = 0; child < profileNumScopes; child++) {
+    if (profileScopes[child].parent == scope && profileScopes[child].mainThread == s->mainThread) {
+      profileReportScope(child, depth + 1, first);
+    } // end if
+  } // end for
+
+} // end profileReportScope
+
+/******************************************************************************
+* Function profileReport                                                      *
+******************************************************************************/
+void profileReport(void) {
+
+  int scope, first = 1, mainThread, heading;
+
+  if (profileMode == PROFILE_OFF) {
+    return;
+  } // end if
+  fflush(stdout);
+  if (profileMode == PROFILE_JSON) {
+    fprintf(stderr, "{\"profile\": [");
+  } else {
+    fprintf(stderr, "\n%-28s %10s %12s %12s %14s %6s %12s %12s\n", "scope", "calls",
+            "seconds", "self", "cycles", "IPC", "LLC misses", "br misses");
+  } // end if
+
+  // main-thread trees first, then the scopes opened on worker threads
+  for (mainThread = 1; mainThread >= 0; mainThread--) {
+    heading = !mainThread && profileMode == PROFILE_SUMMARY;
+    for (scope = 0; scope < profileNumScopes; scope++) {
+      if (profileScopes[scope].parent == -1 && profileScopes[scope].mainThread == mainThread) {
+        if (heading) {
+          fprintf(stderr, "worker threads (summed):\n");
+          heading = 0;
+        } // end if
+        profileReportScope(scope, 0, &first);
+      } // end if
+    } // end for (scope)
+  } // end for (mainThread)
+
+  if (profileMode == PROFILE_JSON) {
+    fprintf(stderr, "\n  ], \"counters\": %s}\n", profileFds[0] >= 0 ? "true" : "false");
+  } else if (profileFds[0] < 0) {
+    fprintf(stderr, "(hardware counters unavailable: perf_event_open refused)\n");
+  } // end if
+
+} // end profileReport
+
+#endif
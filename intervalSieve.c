@@ -0,0 +1,291 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef INTERVALSIEVE_C
+#define INTERVALSIEVE_C
+
+#include "eratosthenes.c"
+
+/* A forward segmented sieve of an arbitrary interval [lo, hi] of 64-bit
+    numbers, costing about (hi - lo) log log hi plus one pass over the
+    sieving primes up to sqrt(hi), however large lo is.
+
+    Segments are the usual odd-only bitmaps of SIEVE_SEGMENT_WORDS words,
+    presieved up to 13. Sieving primes below the segment's bit count cross
+    off every segment and keep their next multiple from one segment to the
+    next. Larger ones hit a segment at most once, so (after Oliveira e Silva)
+    each waits in a bucket for the segment of its next multiple: a segment
+    only touches the primes that actually divide something in it. Buckets
+    form a ring long enough for the largest prime's stride; primes whose
+    first multiple (p^2) lies beyond the ring wait, in order, in a list of
+    late primes. */
+
+// content summary
+#define BUCKET_BLOCK_ENTRIES 1022       // a block is 8 KB
+
+typedef struct {
+  uint32_t prime;
+  uint32_t index;                       // bit of its multiple in the segment
+} bucketEntry;
+
+typedef struct bucketBlock {
+  struct bucketBlock *next;
+  long unsigned int count;
+  bucketEntry entries[BUCKET_BLOCK_ENTRIES];
+} bucketBlock;
+
+typedef struct {
+  long unsigned int first;              // odd number of bit 0 of segment 0
+  long unsigned int hi;
+  long unsigned int segment;            // next segment to sieve
+  long unsigned int numSegments;
+  long unsigned int low, high;          // numbers of the segment in bits
+  uint64_t *bits;
+  uint32_t *smallPrimes;                // below SIEVE_SEGMENT_WORDS * 64
+  long unsigned int *smallNext;         // bit of the next multiple
+  long unsigned int numSmall;
+  bucketBlock **buckets;
+  long unsigned int numBuckets;
+  bucketBlock *freeBlocks;
+  uint32_t *latePrimes;                 // first multiple p^2 past the ring
+  long unsigned int numLate, nextLate, lateCapacity;
+  long unsigned int numEntries;         // primes waiting in buckets
+} intervalSieve;
+
+void intervalSieveInit(intervalSieve *s, long unsigned int lo, long unsigned int hi);
+  /* intervalSieveInit prepares s to sieve the odd numbers of [lo, hi]
+      (hi below 2^64 - 2^32), sieving primes included.
+      */
+int intervalSieveNext(intervalSieve *s);
+  /* intervalSieveNext sieves the next segment into s->bits, where bit k
+      stands for s->low + 2k up to s->high (later words are 0), and returns
+      1, or returns 0 once the interval is done.
+      */
+void intervalSieveFree(intervalSieve *s);
+  /* intervalSieveFree releases the memory of s.
+      */
+void intervalSieveAdd(intervalSieve *s, long unsigned int p);
+  /* intervalSieveAdd files sieving prime p under its first multiple.
+      */
+void bucketPush(intervalSieve *s, long unsigned int bucket, uint32_t p, uint32_t index);
+  /* bucketPush adds an entry to a bucket.
+      */
+
+// definitions
+#define SEGMENT_BITS (SIEVE_SEGMENT_SPAN / 2)
+
+/******************************************************************************
+* Function intervalSieveInit streams the sieving primes up to sqrt(hi) out of *
+*  a plain segmented sieve and files each one                                 *
+******************************************************************************/
+void intervalSieveInit(intervalSieve *s, long unsigned int lo, long unsigned int hi) {
+
+  uint64_t *bits, word;
+  long unsigned int limit, numTiny, low, high, words, w;
+  int scope;
+
+  memset(s, 0, sizeof(intervalSieve));
+  s->first = (lo < 1) ? 1 : (lo | 1);
+  s->hi = hi;
+  s->numSegments = (hi >= s->first) ? (hi - s->first) / SIEVE_SEGMENT_SPAN + 1 : 0;
+  s->bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  if (s->numSegments == 0) {
+    return;
+  } // end if
+
+  // the largest stride is p bits, so a ring that long holds every bucket
+  limit = isqrt(hi);
+  s->numBuckets = limit / SEGMENT_BITS + 2;
+  s->buckets = (bucketBlock **) calloc(s->numBuckets, sizeof(bucketBlock *));
+  s->smallPrimes = (uint32_t *) malloc(sizeof(uint32_t)*SEGMENT_BITS);
+  s->smallNext = (long unsigned int *) malloc(sizeof(long unsigned int)*SEGMENT_BITS);
+  s->lateCapacity = 1024;
+  s->latePrimes = (uint32_t *) malloc(sizeof(uint32_t)*s->lateCapacity);
+
+  scope = profileBegin("base primes");
+  numTiny = 0;
+  while (numTiny < SMALL_TABLE_PRIMES - 1 && smallPrimeTable[numTiny + 1] <= isqrt(limit)) {
+    numTiny++;
+  } // end while
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  for (low = 3; low <= limit; low += SIEVE_SEGMENT_SPAN) {
+    high = (limit - low < SIEVE_SEGMENT_SPAN) ? limit : low + SIEVE_SEGMENT_SPAN - 2;
+    sieveSegment(bits, low, high, smallPrimeTable + 1, numTiny);
+    words = ((high - low) / 2 + 64) / 64;
+    for (w = 0; w < words; w++) {
+      word = bits[w];
+      while (word) {
+        intervalSieveAdd(s, low + 2 * (w * 64 + __builtin_ctzll(word)));
+        word &= word - 1;
+      } // end while
+    } // end for (w)
+    if (high == limit) {
+      break;
+    } // end if
+  } // end for (low)
+  free(bits);
+  profileEnd(scope);
+
+} // end intervalSieveInit
+
+/******************************************************************************
+* Function intervalSieveAdd starts p at its first odd multiple that is both   *
+*  in the interval and at least p^2 (below that, a smaller prime covers it)  *
+******************************************************************************/
+void intervalSieveAdd(intervalSieve *s, long unsigned int p) {
+
+  long unsigned int start, m, bit;
+
+  // the presieve pattern already holds the smallest primes
+  if (p <= PRESIEVE_LARGEST) {
+    return;
+  } // end if
+
+  start = (s->first > p * p) ? s->first : p * p;
+  m = start + (p - start % p) % p;
+  if (m % 2 == 0) {
+    m += p;
+  } // end if
+  if (m > s->hi || m < start) {
+    return;
+  } // end if
+  bit = (m - s->first) / 2;
+
+  if (p < SEGMENT_BITS) {
+    s->smallPrimes[s->numSmall] = (uint32_t) p;
+    s->smallNext[s->numSmall++] = bit;
+  } else if (bit / SEGMENT_BITS < s->numBuckets) {
+    bucketPush(s, bit / SEGMENT_BITS, (uint32_t) p, (uint32_t) (bit % SEGMENT_BITS));
+  } else {
+    if (s->numLate == s->lateCapacity) {
+      s->lateCapacity *= 2;
+      s->latePrimes = (uint32_t *) realloc(s->latePrimes, sizeof(uint32_t)*s->lateCapacity);
+    } // end if
+    s->latePrimes[s->numLate++] = (uint32_t) p;
+  } // end if
+
+} // end intervalSieveAdd
+
+/******************************************************************************
+* Function bucketPush                                                         *
+******************************************************************************/
+void bucketPush(intervalSieve *s, long unsigned int bucket, uint32_t p, uint32_t index) {
+
+  bucketBlock *block = s->buckets[bucket % s->numBuckets];
+
+  if (block == NULL || block->count == BUCKET_BLOCK_ENTRIES) {
+    if (s->freeBlocks) {
+      block = s->freeBlocks;
+      s->freeBlocks = block->next;
+    } else {
+      block = (bucketBlock *) malloc(sizeof(bucketBlock));
+    } // end if
+    block->count = 0;
+    block->next = s->buckets[bucket % s->numBuckets];
+    s->buckets[bucket % s->numBuckets] = block;
+  } // end if
+  block->entries[block->count].prime = p;
+  block->entries[block->count++].index = index;
+  s->numEntries++;
+
+} // end bucketPush
+
+/******************************************************************************
+* Function intervalSieveNext                                                  *
+******************************************************************************/
+int intervalSieveNext(intervalSieve *s) {
+
+  long unsigned int numBits, words, i, k, p, seg, bit;
+  bucketBlock *block, *next;
+  bucketEntry *e, *end;
+
+  if (s->segment >= s->numSegments) {
+    return 0;
+  } // end if
+  seg = s->segment++;
+  s->low = s->first + SIEVE_SEGMENT_SPAN * seg;
+  s->high = (s->hi - s->low < SIEVE_SEGMENT_SPAN) ? s->hi : s->low + SIEVE_SEGMENT_SPAN - 2;
+  numBits = (s->high - s->low) / 2 + 1;
+  words = (numBits + 63) / 64;
+  presieveSegment(s->bits, s->low, words);
+  memset(s->bits + words, 0, sizeof(uint64_t)*(SIEVE_SEGMENT_WORDS - words));
+
+  // late primes whose p^2 has come within the ring join their bucket
+  while (s->nextLate < s->numLate) {
+    p = s->latePrimes[s->nextLate];
+    bit = (p * p - s->first) / 2;
+    if (bit / SEGMENT_BITS >= seg + s->numBuckets - 1) {
+      break;
+    } // end if
+    bucketPush(s, bit / SEGMENT_BITS, (uint32_t) p, (uint32_t) (bit % SEGMENT_BITS));
+    s->nextLate++;
+  } // end while
+
+  // small primes hit every segment
+  for (i = 0; i < s->numSmall; i++) {
+    p = s->smallPrimes[i];
+    for (k = s->smallNext[i]; k < SEGMENT_BITS; k += p) {
+      s->bits[k >> 6] &= ~(1ULL << (k & 63));
+    } // end for (k)
+    s->smallNext[i] = k - SEGMENT_BITS;
+  } // end for (i)
+
+  // large primes hit it once, then move to the bucket of their next multiple
+  block = s->buckets[seg % s->numBuckets];
+  s->buckets[seg % s->numBuckets] = NULL;
+  while (block) {
+    for (e = block->entries, end = e + block->count; e < end; e++) {
+      s->bits[e->index >> 6] &= ~(1ULL << (e->index & 63));
+      k = e->index + e->prime;
+      s->numEntries--;
+      if (seg + k / SEGMENT_BITS < s->numSegments) {
+        bucketPush(s, seg + k / SEGMENT_BITS, e->prime, (uint32_t) (k % SEGMENT_BITS));
+      } // end if
+    } // end for (e)
+    next = block->next;
+    block->next = s->freeBlocks;
+    s->freeBlocks = block;
+    block = next;
+  } // end while
+
+  // clear the tail past hi, and 1
+  if (numBits % 64) {
+    s->bits[words-1] &= (1ULL << (numBits % 64)) - 1;
+  } // end if
+  if (s->low == 1) {
+    s->bits[0] &= ~1ULL;
+  } // end if
+
+  return 1;
+
+} // end intervalSieveNext
+
+/******************************************************************************
+* Function intervalSieveFree                                                  *
+******************************************************************************/
+void intervalSieveFree(intervalSieve *s) {
+
+  bucketBlock *block, *next;
+  long unsigned int b;
+
+  for (b = 0; b < s->numBuckets; b++) {
+    for (block = s->buckets[b]; block; block = next) {
+      next = block->next;
+      free(block);
+    } // end for (block)
+  } // end for (b)
+  for (block = s->freeBlocks; block; block = next) {
+    next = block->next;
+    free(block);
+  } // end for
+  free(s->buckets);
+  free(s->latePrimes);
+  free(s->smallNext);
+  free(s->smallPrimes);
+  free(s->bits);
+
+} // end intervalSieveFree
+
+#endif
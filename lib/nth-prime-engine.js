@@ -0,0 +1,233 @@
+const path = require('path');
+const { Worker } = require('worker_threads');
+const addon = require('./prime-native');
+
+// Time a single computation may take (NTH_PRIME_BUDGET_MS overrides)
+const DEFAULT_BUDGET_MS = 5000;
+
+// Computed primes remembered; each also serves as an anchor for later ones
+const DEFAULT_CACHE_ENTRIES = 1024;
+
+// pi(2^53): past it p_n is no longer a safe JavaScript integer
+const MAX_COMPUTED_INDEX = 252252704148404;
+
+// Rough speeds (one core) for estimating a job's cost: numbers sieved per
+// millisecond by the JS sieve and by the addon, and the addon's
+// Lagarias-Miller-Odlyzko pi(x), about 3 s at 3e13 and growing as x^(2/3).
+// Below the addon's last pi checkpoint (2^38) every index is cheap.
+const JS_SIEVE_NUMBERS_PER_MS = 100000;
+const NATIVE_SIEVE_NUMBERS_PER_MS = 600000;
+const LMO_MS_AT_3E13 = 3000;
+const PI_CHECKPOINT_LIMIT = 2 ** 38;
+
+// Extra time the worker gets beyond its budget before it is terminated. The
+// addon checks the budget between sieve segments but not inside pi(x).
+const TERMINATE_GRACE_MS = 1000;
+
+class NthPrimeError extends Error {
+    constructor(code, message, estimate = null) {
+        super(message);
+        this.code = code; // 'range', 'busy', 'timeout' or 'failed'
+        this.estimate = estimate;
+    }
+}
+
+// Logarithmic integral li(x), by Ramanujan's series
+function logIntegral(x) {
+    const L = Math.log(x);
+    let sum = 0;
+    let inner = 0;
+    let term = -2; // (-1)^(n-1) L^n / (n! 2^(n-1))
+    for (let n = 1; n < 200; n++) {
+        term *= -L / (2 * n);
+        if (n % 2 === 1) {
+            inner += 1 / n;
+        }
+        sum += term * inner;
+        if (Math.abs(term * inner) < 1e-17 * Math.abs(sum)) break;
+    }
+    return 0.5772156649015329 + Math.log(L) + Math.sqrt(x) * sum;
+}
+
+// Estimate p_n as li^-1(n), by Newton's method (within about sqrt(p) ln p)
+function inverseLi(n) {
+    if (n < 6) return [2, 2, 3, 5, 7, 11][n];
+    let x = n * Math.log(n);
+    for (let i = 0; i < 50; i++) {
+        const step = (logIntegral(x) - n) * Math.log(x);
+        x -= step;
+        if (Math.abs(step) < 1) break;
+    }
+    return Math.round(x);
+}
+
+// Finds primes past the database's last index. A single worker thread sieves
+// (or, with the addon, counts and then sieves) from the nearest known exact
+// (index, prime) pair: the database's last prime, an earlier result, or the
+// addon's built-in pi checkpoints. A job that overruns its budget fails
+// with 'timeout' and jobs are refused as 'busy' while another one runs.
+class NthPrimeEngine {
+    constructor(budgetMs = DEFAULT_BUDGET_MS, maxEntries = DEFAULT_CACHE_ENTRIES) {
+        this.budgetMs = budgetMs;
+        this.maxEntries = maxEntries;
+        this.cache = new Map(); // n -> p_n, in LRU order
+        this.inFlight = new Map(); // n -> promise of p_n
+        this.worker = null;
+        this.job = null; // { n, resolve, reject, timer }
+        this.terminating = null; // promise while an overrun worker shuts down
+        this.computed = 0;
+        this.hits = 0;
+        this.timeouts = 0;
+        this.refused = 0;
+    }
+
+    // p_n, given the last known exact pair (anchorIndex, anchorPrime)
+    async nthPrime(n, anchorIndex = 0, anchorPrime = 0) {
+        if (!Number.isSafeInteger(n) || n < 1 || n > MAX_COMPUTED_INDEX) {
+            throw new NthPrimeError('range', `Index must be between 1 and ${MAX_COMPUTED_INDEX.toLocaleString()}`);
+        }
+
+        const cached = this.cache.get(n);
+        if (cached !== undefined) {
+            this.hits++;
+            this.cache.delete(n);
+            this.cache.set(n, cached);
+            return cached;
+        }
+        if (this.inFlight.has(n)) {
+            return this.inFlight.get(n);
+        }
+
+        // a cached result between the anchor and n is a closer anchor
+        for (const [index, prime] of this.cache) {
+            if (index < n && index > anchorIndex) {
+                anchorIndex = index;
+                anchorPrime = prime;
+            }
+        }
+
+        // refuse what would run well past the budget rather than tie the worker up
+        if (NthPrimeEngine.estimateMs(n, anchorIndex) > 2 * this.budgetMs) {
+            this.refused++;
+            throw new NthPrimeError('timeout', `Computation would exceed ${this.budgetMs} ms`, inverseLi(n));
+        }
+        if (this.job || this.terminating) {
+            this.refused++;
+            throw new NthPrimeError('busy', 'Another prime is being computed', inverseLi(n));
+        }
+
+        const promise = this.run(n, anchorIndex, anchorPrime);
+        this.inFlight.set(n, promise);
+        try {
+            const prime = await promise;
+            this.remember(n, prime);
+            return prime;
+        } finally {
+            this.inFlight.delete(n);
+        }
+    }
+
+    // Rough milliseconds to find p_n from anchorIndex, the addon taking the
+    // cheaper of sieving the gap and counting pi(x) near li^-1(n)
+    static estimateMs(n, anchorIndex) {
+        const x = inverseLi(n);
+        const gap = (n - anchorIndex) * Math.log(x);
+        if (!addon || !addon.nthPrime) {
+            return gap / JS_SIEVE_NUMBERS_PER_MS;
+        }
+        if (x <= PI_CHECKPOINT_LIMIT) {
+            return 0;
+        }
+        return Math.min(gap / NATIVE_SIEVE_NUMBERS_PER_MS, LMO_MS_AT_3E13 * Math.pow(x / 3e13, 2 / 3));
+    }
+
+    // Hand one job to the worker, terminating it if it overruns
+    run(n, anchorIndex, anchorPrime) {
+        if (!this.worker) {
+            const worker = new Worker(path.join(__dirname, 'nth-prime-worker.js'));
+            worker.on('message', (message) => this.finish(message));
+            worker.on('error', (err) => this.finish({ error: err.message }));
+            worker.on('exit', () => {
+                if (this.worker === worker) {
+                    this.worker = null;
+                    this.finish({ error: 'worker exited' });
+                }
+            });
+            worker.unref(); // after the listeners, which ref it
+            this.worker = worker;
+        }
+
+        return new Promise((resolve, reject) => {
+            const timer = setTimeout(() => this.abort(), this.budgetMs + TERMINATE_GRACE_MS);
+            this.job = { n, resolve, reject, timer };
+            this.worker.postMessage({ n, anchorIndex, anchorPrime, budgetMs: this.budgetMs });
+        });
+    }
+
+    finish(message) {
+        const job = this.job;
+        if (!job) return;
+        this.job = null;
+        clearTimeout(job.timer);
+
+        if (message.prime !== undefined) {
+            this.computed++;
+            job.resolve(message.prime);
+        } else if (message.timeout) {
+            this.timeouts++;
+            job.reject(new NthPrimeError('timeout', `Computation exceeded ${this.budgetMs} ms`, inverseLi(job.n)));
+        } else {
+            job.reject(new NthPrimeError('failed', message.error || 'Computation failed'));
+        }
+    }
+
+    // The worker is stuck past its budget: fail the job and replace the worker
+    abort() {
+        const worker = this.worker;
+        this.finish({ timeout: true });
+        if (worker) {
+            this.worker = null;
+            this.terminating = worker.terminate().finally(() => {
+                this.terminating = null;
+            });
+        }
+    }
+
+    remember(n, prime) {
+        this.cache.delete(n);
+        this.cache.set(n, prime);
+        while (this.cache.size > this.maxEntries) {
+            this.cache.delete(this.cache.keys().next().value);
+        }
+    }
+
+    getStats() {
+        return {
+            native: Boolean(addon && addon.nthPrime),
+            budgetMs: this.budgetMs,
+            cached: this.cache.size,
+            hits: this.hits,
+            computed: this.computed,
+            timeouts: this.timeouts,
+            refused: this.refused,
+            busy: Boolean(this.job || this.terminating)
+        };
+    }
+}
+
+let globalInstance = null;
+
+function getNthPrimeEngineInstance() {
+    if (!globalInstance) {
+        globalInstance = new NthPrimeEngine(Number(process.env.NTH_PRIME_BUDGET_MS) || DEFAULT_BUDGET_MS);
+    }
+    return globalInstance;
+}
+
+module.exports = {
+    NthPrimeEngine,
+    NthPrimeError,
+    MAX_COMPUTED_INDEX,
+    inverseLi,
+    getNthPrimeEngineInstance
+};
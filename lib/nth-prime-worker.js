@@ -0,0 +1,79 @@
+const { parentPort } = require('worker_threads');
+const addon = require('./prime-native');
+
+// Worker thread for NthPrimeEngine: finds p_n from an anchor (anchorIndex,
+// anchorPrime) within budgetMs and posts { prime } or { timeout: true }.
+// The native addon counts with the pi checkpoints or LMO and sieves the rest;
+// without it the gap from the anchor is sieved here in plain JS.
+
+// Odd numbers per JS sieve segment (one byte each)
+const SEGMENT_SIZE = 1 << 18;
+
+let basePrimes = [];
+let basePrimesLimit = 1;
+
+// Odd primes up to limit, kept for the next job
+function ensureBasePrimes(limit) {
+    const composite = new Uint8Array(limit + 1);
+    const primes = [];
+    for (let i = 3; i <= limit; i += 2) {
+        if (composite[i]) continue;
+        primes.push(i);
+        for (let j = i * i; j <= limit; j += 2 * i) {
+            composite[j] = 1;
+        }
+    }
+    basePrimes = primes;
+    basePrimesLimit = limit;
+}
+
+// Count on from the anchor through odd-only segments until the n-th prime
+function sieveFrom(n, anchorIndex, anchorPrime, deadline) {
+    if (anchorIndex < 1 || anchorPrime < 2) {
+        anchorIndex = 1;
+        anchorPrime = 2;
+    }
+    if (n === anchorIndex) return anchorPrime;
+
+    let count = anchorIndex;
+    let low = anchorPrime % 2 ? anchorPrime + 2 : anchorPrime + 1;
+    const sieve = new Uint8Array(SEGMENT_SIZE);
+    while (true) {
+        if (deadline && Date.now() > deadline) return null;
+
+        const high = low + 2 * (SEGMENT_SIZE - 1);
+        const root = Math.floor(Math.sqrt(high));
+        if (root > basePrimesLimit) {
+            ensureBasePrimes(2 * root);
+        }
+        sieve.fill(1);
+        for (const p of basePrimes) {
+            if (p > root) break;
+            let m = Math.max(p * p, Math.ceil(low / p) * p);
+            if (m % 2 === 0) m += p;
+            for (let k = (m - low) / 2; k < SEGMENT_SIZE; k += p) {
+                sieve[k] = 0;
+            }
+        }
+        for (let k = 0; k < SEGMENT_SIZE; k++) {
+            if (sieve[k] && ++count === n) {
+                return low + 2 * k;
+            }
+        }
+        low = high + 2;
+    }
+}
+
+parentPort.on('message', ({ n, anchorIndex, anchorPrime, budgetMs }) => {
+    try {
+        let prime;
+        if (addon && addon.nthPrime) {
+            prime = addon.nthPrime(n, anchorIndex, anchorPrime, budgetMs);
+        } else {
+            prime = sieveFrom(n, anchorIndex, anchorPrime, Date.now() + budgetMs);
+        }
+        parentPort.postMessage(prime === null ? { timeout: true } : { prime });
+    } catch (err) {
+        parentPort.postMessage({ error: err.message });
+    }
+});
@@ -1,13 +1,29 @@
 const sqlite3 = require('sqlite3').verbose();
 const path = require('path');
+const fs = require('fs');
+const { PrimeGapFile } = require('./prime-gap-file');
+const addon = require('./prime-native');
+const { SegmentCache, DEFAULT_MAX_BYTES } = require('./segment-cache');
+
+// Gap codecs understood by the reader (see gapCodec.c)
+const COMPRESSION_METHODS = ['varint_delta', 'half_gap'];
+
+// Segments remembered as missed once before the set is reset
+const SEEN_SEGMENTS_LIMIT = 4096;
 
 class PrimeDatabase {
-    constructor(dbPath = null) {
+    constructor(dbPath = null, gapPath = null) {
         this.dbPath = dbPath || path.join(__dirname, '../database/primes.db');
+        this.gapPath = gapPath || path.join(path.dirname(this.dbPath), 'primes.gaps');
+        this.gapFile = null; // flat gap file, used for lookups when present
+        this.compressionMethod = 'varint_delta'; // read from database_metadata
         this.db = null;
         this.isInitialized = false;
-        this.cache = new Map(); // LRU cache for hot segments
-        this.maxCacheSize = 100; // Cache up to 100 segments (~100MB)
+        // Decoded segments, bounded in bytes (PRIME_CACHE_BYTES overrides)
+        this.segmentCache = new SegmentCache(Number(process.env.PRIME_CACHE_BYTES) || DEFAULT_MAX_BYTES);
+        this.seenSegments = new Set(); // missed once, admitted on the next miss
+        this.lastSegmentId = null; // for detecting sequential access
+        this.pendingPrefetch = new Set();
     }
 
     // Initialize database connection
@@ -21,19 +37,48 @@ class PrimeDatabase {
             }
         });
 
+        // Segments are decoded according to the builder's compression_method
+        this.compressionMethod = await this.getCompressionMethod();
+        if (!COMPRESSION_METHODS.includes(this.compressionMethod)) {
+            throw new Error(`Unsupported compression_method ${this.compressionMethod}`);
+        }
+
+        // Prefer the flat gap file (primeGaps --convert) for index lookups
+        if (fs.existsSync(this.gapPath) && fs.existsSync(`${this.gapPath}.idx`)) {
+            try {
+                this.gapFile = new PrimeGapFile(this.gapPath).open();
+                console.log(`✅ Prime gap file opened (${this.gapFile.count.toLocaleString()} primes)`);
+            } catch (err) {
+                console.error('Failed to open prime gap file, using segments:', err.message);
+                this.gapFile = null;
+            }
+        }
+
         this.isInitialized = true;
         console.log('✅ Prime database initialized');
     }
 
-    // Decode variable-length integer
-    decodeVarInt(buffer, offset = 0) {
+    // Read database_metadata.compression_method (varint_delta if absent)
+    async getCompressionMethod() {
+        return new Promise((resolve, reject) => {
+            this.db.get(`SELECT value FROM database_metadata WHERE key = 'compression_method'`,
+                (err, row) => {
+                    if (err) reject(err);
+                    else resolve(row ? row.value : 'varint_delta');
+                });
+        });
+    }
+
+    // Decode variable-length integer (static: the builder's resume uses it too)
+    static decodeVarInt(buffer, offset = 0) {
         let result = 0;
         let shift = 0;
         let index = offset;
 
         while (index < buffer.length) {
             const byte = buffer[index++];
-            result |= (byte & 127) << shift;
+            // Multiply rather than shift: bitwise ops truncate to 32 bits
+            result += (byte & 127) * 2 ** shift;
             
             if ((byte & 128) === 0) {
                 return { value: result, nextOffset: index };
@@ -45,13 +90,29 @@ class PrimeDatabase {
         throw new Error('Invalid VarInt encoding');
     }
 
+    // Decode a whole segment; the addon returns a Float64Array instead
+    decodeSegment(startPrime, compressedBuffer) {
+        if (addon) {
+            return addon.decodeSegment(compressedBuffer, startPrime, false, this.compressionMethod);
+        }
+        return this.reconstructPrimes(startPrime, this.decompressDeltas(compressedBuffer));
+    }
+
     // Decompress delta-encoded gaps
     decompressDeltas(compressedBuffer) {
         const gaps = [];
         let offset = 0;
 
         while (offset < compressedBuffer.length) {
-            const decoded = this.decodeVarInt(compressedBuffer, offset);
+            // half_gap: one byte per half-gap, 0 escapes to a varint gap
+            if (this.compressionMethod === 'half_gap' && compressedBuffer[offset] !== 0) {
+                gaps.push(2 * compressedBuffer[offset++]);
+                continue;
+            }
+            if (this.compressionMethod === 'half_gap') {
+                offset++;
+            }
+            const decoded = PrimeDatabase.decodeVarInt(compressedBuffer, offset);
             gaps.push(decoded.value);
             offset = decoded.nextOffset;
         }
@@ -87,16 +148,150 @@ class PrimeDatabase {
         });
     }
 
+    // Find the segment whose primes cover x: the last one starting at or below x
+    async findSegmentForPrime(x) {
+        return new Promise((resolve, reject) => {
+            this.db.get(`
+                SELECT segment_id, start_index, end_index, start_prime, compressed_deltas
+                FROM prime_segments
+                WHERE start_prime <= ?
+                ORDER BY start_prime DESC
+                LIMIT 1
+            `, [x], (err, row) => {
+                if (err) reject(err);
+                else resolve(row);
+            });
+        });
+    }
+
+    // Decode a segment row and admit it to the segment cache
+    loadSegment(segment, prefetched = false) {
+        const primes = this.decodeSegment(segment.start_prime, segment.compressed_deltas);
+        this.segmentCache.set(segment.segment_id, primes, prefetched);
+        this.seenSegments.delete(segment.segment_id);
+        return primes;
+    }
+
+    // Decoded primes of a segment row, through the segment cache
+    getSegmentPrimes(segment) {
+        this.noteAccess(segment);
+        return this.segmentCache.get(segment.segment_id) || this.loadSegment(segment);
+    }
+
+    // Two lookups in consecutive segments look like a scan: decode the
+    // following segment in the background so the scan finds it cached
+    noteAccess(segment) {
+        const sequential = this.lastSegmentId !== null && segment.segment_id === this.lastSegmentId + 1;
+        this.lastSegmentId = segment.segment_id;
+        if (!sequential || this.pendingPrefetch.has(segment.segment_id + 1)
+            || this.segmentCache.has(segment.segment_id + 1)) {
+            return;
+        }
+
+        this.pendingPrefetch.add(segment.segment_id + 1);
+        setImmediate(async () => {
+            try {
+                const next = await this.findSegmentForIndex(segment.end_index + 1);
+                if (next && !this.segmentCache.has(next.segment_id)) {
+                    this.loadSegment(next, true);
+                }
+            } catch (error) {
+                console.error(`Error prefetching segment ${segment.segment_id + 1}:`, error);
+            }
+            this.pendingPrefetch.delete(segment.segment_id + 1);
+        });
+    }
+
+    // Locate x among the stored primes with one segment read: pi(x) (the
+    // index of the largest prime <= x), that prime, and the segment holding
+    // it. Returns null if primes past the database could still be <= x.
+    async locatePrime(x) {
+        if (!this.isInitialized) {
+            await this.initialize();
+        }
+        if (x < 2) {
+            return { index: 0, prime: null, segment: null, primes: null, position: -1 };
+        }
+
+        const segment = await this.findSegmentForPrime(x);
+        if (!segment) {
+            return null;
+        }
+        const primes = this.getSegmentPrimes(segment);
+
+        // Binary search for the last prime <= x
+        let low = 0;
+        let high = primes.length - 1;
+        while (low < high) {
+            const mid = (low + high + 1) >>> 1;
+            if (primes[mid] <= x) low = mid;
+            else high = mid - 1;
+        }
+
+        if (low === primes.length - 1 && x > primes[low]
+            && !(await this.findSegmentForIndex(segment.end_index + 1))) {
+            return null;
+        }
+
+        return {
+            index: segment.start_index + low,
+            prime: primes[low],
+            segment,
+            primes,
+            position: low
+        };
+    }
+
+    // Index of x if it is prime, and pi(x) either way (null past the database)
+    async getIndexOfPrime(x) {
+        const located = await this.locatePrime(x);
+        if (!located) {
+            return null;
+        }
+
+        const isPrime = located.prime === x;
+        return { isPrime, index: isPrime ? located.index : null, pi: located.index };
+    }
+
+    // Smallest prime > x as { index, prime }, or null past the database
+    async getNextPrime(x) {
+        const located = await this.locatePrime(x);
+        if (!located) {
+            return null;
+        }
+
+        if (located.primes && located.position + 1 < located.primes.length) {
+            return { index: located.index + 1, prime: located.primes[located.position + 1] };
+        }
+        if (!(await this.findSegmentForIndex(located.index + 1))) {
+            return null;
+        }
+        return { index: located.index + 1, prime: await this.getPrimeByIndex(located.index + 1) };
+    }
+
+    // Largest prime < x as { index, prime }, or null if there is none or it
+    // may lie past the database
+    async getPrevPrime(x) {
+        const located = await this.locatePrime(x - 1);
+        if (!located || located.index === 0) {
+            return null;
+        }
+
+        return { index: located.index, prime: located.prime };
+    }
+
     // Get prime by index (1-based indexing)
     async getPrimeByIndex(primeIndex) {
         if (!this.isInitialized) {
             await this.initialize();
         }
 
-        // Check cache first
-        const cacheKey = `index_${primeIndex}`;
-        if (this.cache.has(cacheKey)) {
-            return this.cache.get(cacheKey);
+        // The gap file answers directly from the page cache
+        if (this.gapFile && primeIndex <= this.gapFile.count) {
+            const prime = this.gapFile.nth(primeIndex);
+            if (prime !== null) {
+                return prime;
+            }
         }
 
         try {
@@ -107,35 +302,29 @@ class PrimeDatabase {
                 throw new Error(`Prime index ${primeIndex} not found in database`);
             }
 
-            // Check if we have this segment cached
-            const segmentCacheKey = `segment_${segment.segment_id}`;
-            let primes;
-
-            if (this.cache.has(segmentCacheKey)) {
-                primes = this.cache.get(segmentCacheKey);
-            } else {
-                // Decompress and reconstruct primes for this segment
-                const gaps = this.decompressDeltas(segment.compressed_deltas);
-                primes = this.reconstructPrimes(segment.start_prime, gaps);
-                
-                // Cache the segment (implement simple LRU)
-                if (this.cache.size >= this.maxCacheSize) {
-                    const firstKey = this.cache.keys().next().value;
-                    this.cache.delete(firstKey);
+            const positionInSegment = primeIndex - segment.start_index;
+            this.noteAccess(segment);
+            let primes = this.segmentCache.get(segment.segment_id);
+
+            if (!primes && addon && !this.seenSegments.has(segment.segment_id)) {
+                // First miss: the addon decodes only the gaps before the
+                // prime; the segment is cached if it is missed again
+                if (this.seenSegments.size >= SEEN_SEGMENTS_LIMIT) {
+                    this.seenSegments.clear();
                 }
-                this.cache.set(segmentCacheKey, primes);
+                this.seenSegments.add(segment.segment_id);
+                const prime = addon.primeAt(segment.compressed_deltas, segment.start_prime,
+                                            positionInSegment, this.compressionMethod);
+                if (prime === null) {
+                    throw new Error(`Prime index ${primeIndex} not found in segment ${segment.segment_id}`);
+                }
+                return prime;
             }
-
-            // Calculate the position within the segment
-            const positionInSegment = primeIndex - segment.start_index;
-            const prime = primes[positionInSegment];
-
-            // Cache the individual result
-            if (this.cache.size < this.maxCacheSize * 10) { // Allow more individual cache entries
-                this.cache.set(cacheKey, prime);
+            if (!primes) {
+                primes = this.loadSegment(segment);
             }
 
-            return prime;
+            return primes[positionInSegment];
 
         } catch (error) {
             console.error(`Error retrieving prime at index ${primeIndex}:`, error);
@@ -173,38 +362,68 @@ class PrimeDatabase {
         return primeIndex <= stats.max_prime_index;
     }
 
-    // Batch get multiple primes (for potential future optimization)
+    // Walk the segments covering startIndex..endIndex in order, decoding each
+    // once. Yields { startIndex, primes } runs; bulk reads bypass the cache so
+    // an export does not evict the hot segments.
+    async *iteratePrimeRange(startIndex, endIndex) {
+        if (!this.isInitialized) {
+            await this.initialize();
+        }
+
+        let index = startIndex;
+        while (index <= endIndex) {
+            const segment = await this.findSegmentForIndex(index);
+            if (!segment) {
+                throw new Error(`Prime index ${index} not found in database`);
+            }
+
+            const primes = this.segmentCache.peek(segment.segment_id)
+                || this.decodeSegment(segment.start_prime, segment.compressed_deltas);
+            const last = Math.min(endIndex, segment.end_index);
+            yield {
+                startIndex: index,
+                primes: primes.slice(index - segment.start_index, last - segment.start_index + 1)
+            };
+            index = last + 1;
+        }
+    }
+
+    // Batch get multiple primes, one segment decode per covering segment
     async getPrimesByIndexRange(startIndex, endIndex) {
         const results = [];
-        
-        for (let i = startIndex; i <= endIndex; i++) {
-            try {
-                const prime = await this.getPrimeByIndex(i);
-                results.push({ index: i, prime });
-            } catch (error) {
+
+        try {
+            for await (const run of this.iteratePrimeRange(startIndex, endIndex)) {
+                for (let i = 0; i < run.primes.length; i++) {
+                    results.push({ index: run.startIndex + i, prime: run.primes[i] });
+                }
+            }
+        } catch (error) {
+            for (let i = startIndex + results.length; i <= endIndex; i++) {
                 results.push({ index: i, error: error.message });
             }
         }
-        
+
         return results;
     }
 
     // Clean up resources
     async close() {
+        if (this.gapFile) {
+            this.gapFile.close();
+            this.gapFile = null;
+        }
         if (this.db) {
             this.db.close();
             this.isInitialized = false;
-            this.cache.clear();
+            this.segmentCache.clear();
+            this.seenSegments.clear();
         }
     }
 
     // Get cache statistics
     getCacheStats() {
-        return {
-            cacheSize: this.cache.size,
-            maxCacheSize: this.maxCacheSize,
-            hitRate: this.cacheHits / (this.cacheHits + this.cacheMisses) || 0
-        };
+        return this.segmentCache.stats();
     }
 }
 
@@ -0,0 +1,101 @@
+const fs = require('fs');
+const addon = require('./prime-native');
+
+// Header magic "PGPIDX01" as written by primeGapFile.c
+const GAP_FILE_MAGIC = 0x3130584449504750n;
+const HEADER_BYTES = 32;
+const CHECKPOINT_BYTES = 16;
+
+// Reader for the flat gap file + checkpoint index made by `primeGaps --convert`.
+// A lookup is one 16-byte checkpoint read and at most stride-1 varint gaps
+// read straight from the page cache - no SQLite query, no segment decode.
+// With the native addon both files are mmapped and decoded in C instead.
+class PrimeGapFile {
+    constructor(gapPath, indexPath = `${gapPath}.idx`) {
+        this.gapPath = gapPath;
+        this.indexPath = indexPath;
+        this.gapFd = null;
+        this.indexFd = null;
+        this.count = 0;
+        this.stride = 0;
+        this.checkpoint = Buffer.alloc(CHECKPOINT_BYTES);
+        this.gapBuffer = null;
+        this.handle = null;
+    }
+
+    // Open both files and validate the index header
+    open() {
+        if (addon) {
+            const mapped = addon.gapFileOpen(this.gapPath, this.indexPath);
+            this.handle = mapped.handle;
+            this.count = mapped.count;
+            this.stride = mapped.stride;
+            return this;
+        }
+
+        this.gapFd = fs.openSync(this.gapPath, 'r');
+        this.indexFd = fs.openSync(this.indexPath, 'r');
+
+        const header = Buffer.alloc(HEADER_BYTES);
+        fs.readSync(this.indexFd, header, 0, HEADER_BYTES, 0);
+        if (header.readBigUInt64LE(0) !== GAP_FILE_MAGIC) {
+            this.close();
+            throw new Error(`${this.indexPath} is not a prime gap index`);
+        }
+
+        this.count = Number(header.readBigUInt64LE(8));
+        this.stride = Number(header.readBigUInt64LE(16));
+        // Prime gaps below 2^64 are under 2^14, so two varint bytes at most
+        this.gapBuffer = Buffer.alloc(this.stride * 2);
+        return this;
+    }
+
+    // Get the nth prime (1-based), or null if outside 1..count
+    nth(n) {
+        if (!Number.isInteger(n) || n < 1 || n > this.count) {
+            return null;
+        }
+        if (this.handle) {
+            return addon.gapFileNth(this.handle, n);
+        }
+
+        const checkpointIndex = Math.floor((n - 1) / this.stride);
+        fs.readSync(this.indexFd, this.checkpoint, 0, CHECKPOINT_BYTES,
+                    HEADER_BYTES + checkpointIndex * CHECKPOINT_BYTES);
+        let prime = Number(this.checkpoint.readBigUInt64LE(0));
+        let steps = (n - 1) % this.stride;
+        if (steps === 0) {
+            return prime;
+        }
+
+        const offset = Number(this.checkpoint.readBigUInt64LE(8));
+        const bytesRead = fs.readSync(this.gapFd, this.gapBuffer, 0, this.gapBuffer.length, offset);
+        let gap = 0;
+        let multiplier = 1;
+        for (let i = 0; i < bytesRead && steps > 0; i++) {
+            const byte = this.gapBuffer[i];
+            gap += (byte & 127) * multiplier;
+            if (byte & 128) {
+                multiplier *= 128;
+            } else {
+                prime += gap;
+                gap = 0;
+                multiplier = 1;
+                steps--;
+            }
+        }
+
+        return prime;
+    }
+
+    close() {
+        if (this.handle) addon.gapFileClose(this.handle);
+        this.handle = null;
+        if (this.gapFd !== null) fs.closeSync(this.gapFd);
+        if (this.indexFd !== null) fs.closeSync(this.indexFd);
+        this.gapFd = null;
+        this.indexFd = null;
+    }
+}
+
+module.exports = { PrimeGapFile };
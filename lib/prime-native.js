@@ -0,0 +1,12 @@
+const path = require('path');
+
+// Optional native addon (native/primeAddon.c). Build it with
+// `npm run build-addon`; without it callers fall back to plain JS.
+let addon = null;
+try {
+    addon = require(path.join(__dirname, '../native/build/Release/primeAddon.node'));
+} catch (err) {
+    addon = null;
+}
+
+module.exports = addon;
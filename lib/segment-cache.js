@@ -0,0 +1,93 @@
+// Default budget for decoded segments: 32 segments of 1M primes as Float64Array
+const DEFAULT_MAX_BYTES = 256 * 1024 * 1024;
+
+// LRU cache of decoded segments (typed arrays or arrays of primes), bounded
+// by the bytes they hold rather than by entry count. A Map keeps insertion
+// order, so refreshing an entry on a hit is delete + set and the eviction
+// victim is always the first key.
+class SegmentCache {
+    constructor(maxBytes = DEFAULT_MAX_BYTES) {
+        this.maxBytes = maxBytes;
+        this.bytes = 0;
+        this.entries = new Map();
+        this.hits = 0;
+        this.misses = 0;
+        this.evictions = 0;
+        this.prefetches = 0;
+    }
+
+    // Bytes a segment's primes occupy (plain arrays count 8 bytes a number)
+    static sizeOf(primes) {
+        return primes.byteLength !== undefined ? primes.byteLength : primes.length * 8;
+    }
+
+    // Look a segment up, counting the hit or miss and refreshing it on a hit
+    get(segmentId) {
+        const primes = this.entries.get(segmentId);
+        if (primes === undefined) {
+            this.misses++;
+            return undefined;
+        }
+
+        this.hits++;
+        this.entries.delete(segmentId);
+        this.entries.set(segmentId, primes);
+        return primes;
+    }
+
+    // Look a segment up without touching the counters or the LRU order
+    peek(segmentId) {
+        return this.entries.get(segmentId);
+    }
+
+    has(segmentId) {
+        return this.entries.has(segmentId);
+    }
+
+    // Insert a segment, evicting least recently used ones to fit the budget.
+    // A segment larger than the whole budget is not cached.
+    set(segmentId, primes, prefetched = false) {
+        const size = SegmentCache.sizeOf(primes);
+        if (size > this.maxBytes) {
+            return;
+        }
+
+        if (this.entries.has(segmentId)) {
+            this.bytes -= SegmentCache.sizeOf(this.entries.get(segmentId));
+            this.entries.delete(segmentId);
+        }
+        while (this.bytes + size > this.maxBytes) {
+            const [oldestId, oldest] = this.entries.entries().next().value;
+            this.entries.delete(oldestId);
+            this.bytes -= SegmentCache.sizeOf(oldest);
+            this.evictions++;
+        }
+
+        this.entries.set(segmentId, primes);
+        this.bytes += size;
+        if (prefetched) {
+            this.prefetches++;
+        }
+    }
+
+    clear() {
+        this.entries.clear();
+        this.bytes = 0;
+    }
+
+    stats() {
+        const lookups = this.hits + this.misses;
+        return {
+            segments: this.entries.size,
+            bytes: this.bytes,
+            maxBytes: this.maxBytes,
+            hits: this.hits,
+            misses: this.misses,
+            hitRate: lookups ? this.hits / lookups : 0,
+            evictions: this.evictions,
+            prefetches: this.prefetches
+        };
+    }
+}
+
+module.exports = { SegmentCache, DEFAULT_MAX_BYTES };
@@ -0,0 +1,10 @@
+{
+  "targets": [
+    {
+      "target_name": "primeAddon",
+      "sources": ["primeAddon.c"],
+      "cflags": ["-O2", "-pthread"],
+      "libraries": ["-lm", "-pthread"]
+    }
+  ]
+}
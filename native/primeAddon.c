@@ -0,0 +1,380 @@
+/* Node addon for lib/prime-database.js: decodes segment blobs (in either
+    compression_method of gapCodec.c) off the JS heap and looks primes up in mapped gap files.
+    For lib/nth-prime-worker.js it also finds primes past the database.
+   Author:     Vincent T. Mossman
+   Compile by: node-gyp rebuild (in native/), or
+               gcc -O2 -shared -fPIC -I<node prefix>/include/node
+                   -o native/build/Release/primeAddon.node native/primeAddon.c -pthread -lm
+   Use by:     require('./native/build/Release/primeAddon.node')
+*/
+
+#define NAPI_VERSION 8
+#include <node_api.h>
+#ifndef NODE_GYP_MODULE_NAME
+#define NODE_GYP_MODULE_NAME primeAddon
+#endif
+#include "../primeGapFile.c"
+#include "../primeCounting.c"
+
+// content summary
+napi_value decodeSegment(napi_env env, napi_callback_info info);
+  /* decodeSegment(blob, startPrime[, asBigInt[, method]]) returns every
+      prime of a segment as a Float64Array (or BigUint64Array): startPrime
+      followed by the running sums of the blob's gaps. method is the
+      segment's compression_method, varint_delta by default.
+      */
+napi_value primeAt(napi_env env, napi_callback_info info);
+  /* primeAt(blob, startPrime, position[, method]) returns the prime at
+      position (0 = startPrime) of a segment, decoding only the gaps before
+      it. Returns null past the end of the blob.
+      */
+napi_value gapFileOpenJs(napi_env env, napi_callback_info info);
+  /* gapFileOpenJs(gapPath, indexPath) maps a gap file and returns a handle
+      {count, stride, handle}, or throws if it cannot be opened.
+      */
+napi_value gapFileNthJs(napi_env env, napi_callback_info info);
+  /* gapFileNthJs(handle, n) returns the nth prime from a mapped gap file, or
+      null outside 1..count.
+      */
+napi_value gapFileCloseJs(napi_env env, napi_callback_info info);
+  /* gapFileCloseJs(handle) unmaps the files early; the finalizer would
+      otherwise do it when the handle is collected.
+      */
+napi_value nthPrimeJs(napi_env env, napi_callback_info info);
+  /* nthPrimeJs(n[, anchorIndex, anchorPrime[, budgetMs]]) returns the n-th
+      prime, counting on from the known pair p_anchorIndex = anchorPrime
+      (below n) when that is nearer than nthPrimeAnchor's own anchor.
+      Returns null if sieving outlasts budgetMs; the Meissel-Lehmer count an
+      anchor may need is not interrupted.
+      */
+int getBlob(napi_env env, napi_value value, const unsigned char **data,
+            size_t *length);
+  /* getBlob reads the bytes of a Buffer or Uint8Array argument.
+      */
+int getCodec(napi_env env, size_t argc, napi_value *argv, size_t arg);
+  /* getCodec reads an optional compression_method argument: the codec, or -1
+      if it is not a known method name.
+      */
+int getNatural(napi_env env, napi_value value, uint64_t *n);
+  /* getNatural reads a non-negative Number or BigInt argument.
+      */
+napi_value makeNatural(napi_env env, uint64_t n);
+  /* makeNatural returns n as a Number, or as a BigInt past 2^53.
+      */
+
+// definitions
+#define MAX_SAFE_INTEGER 9007199254740991ULL
+
+/******************************************************************************
+* Function decodeSegment counts the gaps to size the result, decodes straight *
+*  into the typed array's backing store, then converts it to doubles in place *
+******************************************************************************/
+napi_value decodeSegment(napi_env env, napi_callback_info info) {
+
+  napi_value argv[4], buffer, result;
+  size_t argc = 4, length, count, k;
+  const unsigned char *blob;
+  uint64_t prime, *primes;
+  bool asBigInt = false;
+  void *data;
+  int codec;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 2 || !getBlob(env, argv[0], &blob, &length) || !getNatural(env, argv[1], &prime)
+      || (codec = getCodec(env, argc, argv, 3)) < 0) {
+    napi_throw_type_error(env, NULL, "decodeSegment(blob, startPrime[, asBigInt[, method]])");
+    return NULL;
+  } // end if
+  if (argc >= 3) {
+    napi_get_value_bool(env, argv[2], &asBigInt);
+  } // end if
+
+  count = 1 + countGaps(codec, blob, length);
+  napi_create_arraybuffer(env, count * 8, &data, &buffer);
+  primes = (uint64_t *) data;
+  primes[0] = prime;
+  decodePrimes(codec, blob, length, prime, primes + 1, count - 1);
+  if (!asBigInt) {
+    for (k = 0; k < count; k++) {
+      ((double *) data)[k] = (double) primes[k];
+    } // end for
+  } // end if
+  napi_create_typedarray(env, asBigInt ? napi_biguint64_array : napi_float64_array,
+                         count, buffer, 0, &result);
+
+  return result;
+
+} // end decodeSegment
+
+/******************************************************************************
+* Function primeAt stops decoding once position gaps have been added          *
+******************************************************************************/
+napi_value primeAt(napi_env env, napi_callback_info info) {
+
+  napi_value argv[4], result;
+  size_t argc = 4, length;
+  const unsigned char *blob;
+  long unsigned int prime, position;
+  int codec;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 3 || !getBlob(env, argv[0], &blob, &length) || !getNatural(env, argv[1], (uint64_t *) &prime)
+      || !getNatural(env, argv[2], (uint64_t *) &position) || (codec = getCodec(env, argc, argv, 3)) < 0) {
+    napi_throw_type_error(env, NULL, "primeAt(blob, startPrime, position[, method])");
+    return NULL;
+  } // end if
+
+  position = addGaps(codec, blob, length, &prime, position);
+  if (position > 0) {
+    napi_get_null(env, &result);
+    return result;
+  } // end if
+
+  return makeNatural(env, prime);
+
+} // end primeAt
+
+/******************************************************************************
+* Function finalizeGapFile is the handle's finalizer                          *
+******************************************************************************/
+void finalizeGapFile(napi_env env, void *data, void *hint) {
+
+  (void) env;
+  (void) hint;
+  gapFileClose((primeGapFile *) data);
+  free(data);
+
+} // end finalizeGapFile
+
+/******************************************************************************
+* Function gapFileOpenJs wraps gapFileOpen                                    *
+******************************************************************************/
+napi_value gapFileOpenJs(napi_env env, napi_callback_info info) {
+
+  napi_value argv[2], result, value;
+  size_t argc = 2;
+  char gapPath[4096], indexPath[4096];
+  primeGapFile *g;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 2
+      || napi_get_value_string_utf8(env, argv[0], gapPath, sizeof(gapPath), NULL) != napi_ok
+      || napi_get_value_string_utf8(env, argv[1], indexPath, sizeof(indexPath), NULL) != napi_ok) {
+    napi_throw_type_error(env, NULL, "gapFileOpen(gapPath, indexPath)");
+    return NULL;
+  } // end if
+
+  g = (primeGapFile *) malloc(sizeof(primeGapFile));
+  if (gapFileOpen(g, gapPath, indexPath) != 0) {
+    free(g);
+    napi_throw_error(env, NULL, "cannot open prime gap file");
+    return NULL;
+  } // end if
+
+  napi_create_object(env, &result);
+  napi_create_external(env, g, finalizeGapFile, NULL, &value);
+  napi_set_named_property(env, result, "handle", value);
+  napi_set_named_property(env, result, "count", makeNatural(env, g->count));
+  napi_set_named_property(env, result, "stride", makeNatural(env, g->stride));
+
+  return result;
+
+} // end gapFileOpenJs
+
+/******************************************************************************
+* Function gapFileNthJs wraps gapFileNth                                      *
+******************************************************************************/
+napi_value gapFileNthJs(napi_env env, napi_callback_info info) {
+
+  napi_value argv[2], result;
+  size_t argc = 2;
+  primeGapFile *g = NULL;
+  uint64_t n, prime;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 2 || napi_get_value_external(env, argv[0], (void **) &g) != napi_ok
+      || !getNatural(env, argv[1], &n)) {
+    napi_throw_type_error(env, NULL, "gapFileNth(handle, n)");
+    return NULL;
+  } // end if
+  if (g->index == NULL || (prime = gapFileNth(g, n)) == 0) {
+    napi_get_null(env, &result);
+    return result;
+  } // end if
+
+  return makeNatural(env, prime);
+
+} // end gapFileNthJs
+
+/******************************************************************************
+* Function gapFileCloseJs unmaps now; gapFileNth then sees a closed file     *
+******************************************************************************/
+napi_value gapFileCloseJs(napi_env env, napi_callback_info info) {
+
+  napi_value argv[1], result;
+  size_t argc = 1;
+  primeGapFile *g = NULL;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 1 || napi_get_value_external(env, argv[0], (void **) &g) != napi_ok) {
+    napi_throw_type_error(env, NULL, "gapFileClose(handle)");
+    return NULL;
+  } // end if
+  gapFileClose(g);
+  napi_get_undefined(env, &result);
+
+  return result;
+
+} // end gapFileCloseJs
+
+/******************************************************************************
+* Function nthPrimeJs takes the caller's anchor inside the checkpoint table   *
+*  only when it is past the checkpoint, and beyond the table when sieving its *
+*  gap to p_n (about (n - anchorIndex) ln p numbers) costs less than the      *
+*  2 x^(2/3) or so of primeCount                                              *
+******************************************************************************/
+napi_value nthPrimeJs(napi_env env, napi_callback_info info) {
+
+  napi_value argv[4], result;
+  size_t argc = 4;
+  uint64_t n, anchorIndex = 0, anchorPrime = 0, budget = 0, x, count, deadline, prime;
+  double reach;
+
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  if (argc < 1 || !getNatural(env, argv[0], &n) || n == 0 || n > PI_NTH_LIMIT
+      || (argc >= 3 && (!getNatural(env, argv[1], &anchorIndex) || !getNatural(env, argv[2], &anchorPrime)))
+      || (argc >= 4 && !getNatural(env, argv[3], &budget))) {
+    napi_throw_type_error(env, NULL, "nthPrime(n[, anchorIndex, anchorPrime[, budgetMs]])");
+    return NULL;
+  } // end if
+  if (n <= SMALL_TABLE_PRIMES) {
+    return makeNatural(env, smallPrimeTable[n-1]);
+  } // end if
+  deadline = budget ? monotonicNanoseconds() + budget * 1000000 : 0;
+
+  if (anchorIndex >= n || anchorPrime < 2) {
+    anchorIndex = 0;
+  } // end if
+  reach = 2.0 * pow((double) n * log((double) n), 2.0 / 3.0);
+  if (anchorIndex && n > piCheckpoints[PI_CHECKPOINTS-1]
+      && (double) (n - anchorIndex) * log((double) anchorPrime) <= reach) {
+    x = anchorPrime;
+    count = anchorIndex;
+  } else {
+    nthPrimeAnchor(n, &x, &count);
+    if (anchorIndex > count && anchorPrime > x) {
+      x = anchorPrime;
+      count = anchorIndex;
+    } // end if
+  } // end if
+
+  if ((prime = nthPrimeFrom(n, x, count, deadline)) == 0) {
+    napi_get_null(env, &result);
+    return result;
+  } // end if
+
+  return makeNatural(env, prime);
+
+} // end nthPrimeJs
+
+/******************************************************************************
+* Function getBlob accepts any typed array view (Buffer is a Uint8Array)      *
+******************************************************************************/
+int getBlob(napi_env env, napi_value value, const unsigned char **data,
+            size_t *length) {
+
+  napi_typedarray_type type;
+  bool isTyped = false;
+  void *bytes;
+
+  if (napi_is_typedarray(env, value, &isTyped) != napi_ok || !isTyped
+      || napi_get_typedarray_info(env, value, &type, length, &bytes, NULL, NULL) != napi_ok
+      || type != napi_uint8_array) {
+    return 0;
+  } // end if
+  *data = (const unsigned char *) bytes;
+
+  return 1;
+
+} // end getBlob
+
+/******************************************************************************
+* Function getCodec treats a missing or undefined method as varint_delta      *
+******************************************************************************/
+int getCodec(napi_env env, size_t argc, napi_value *argv, size_t arg) {
+
+  napi_valuetype type;
+  char name[32];
+
+  if (argc <= arg || napi_typeof(env, argv[arg], &type) != napi_ok || type == napi_undefined) {
+    return CODEC_VARINT_DELTA;
+  } // end if
+  if (napi_get_value_string_utf8(env, argv[arg], name, sizeof(name), NULL) != napi_ok) {
+    return -1;
+  } // end if
+
+  return codecFromName(name);
+
+} // end getCodec
+
+/******************************************************************************
+* Function getNatural                                                         *
+******************************************************************************/
+int getNatural(napi_env env, napi_value value, uint64_t *n) {
+
+  napi_valuetype type;
+  double number;
+  bool lossless;
+
+  napi_typeof(env, value, &type);
+  if (type == napi_bigint) {
+    return napi_get_value_bigint_uint64(env, value, n, &lossless) == napi_ok && lossless;
+  } // end if
+  if (type != napi_number || napi_get_value_double(env, value, &number) != napi_ok
+      || !(number >= 0) || number > 18446744073709551615.0) {
+    return 0;
+  } // end if
+  *n = (uint64_t) number;
+
+  return 1;
+
+} // end getNatural
+
+/******************************************************************************
+* Function makeNatural                                                        *
+******************************************************************************/
+napi_value makeNatural(napi_env env, uint64_t n) {
+
+  napi_value result;
+
+  if (n <= MAX_SAFE_INTEGER) {
+    napi_create_double(env, (double) n, &result);
+  } else {
+    napi_create_bigint_uint64(env, n, &result);
+  } // end if
+
+  return result;
+
+} // end makeNatural
+
+/******************************************************************************
+* Function init registers the exports                                         *
+******************************************************************************/
+napi_value init(napi_env env, napi_value exports) {
+
+  napi_property_descriptor properties[] = {
+    {"decodeSegment", NULL, decodeSegment, NULL, NULL, NULL, napi_default, NULL},
+    {"primeAt", NULL, primeAt, NULL, NULL, NULL, napi_default, NULL},
+    {"gapFileOpen", NULL, gapFileOpenJs, NULL, NULL, NULL, napi_default, NULL},
+    {"gapFileNth", NULL, gapFileNthJs, NULL, NULL, NULL, napi_default, NULL},
+    {"gapFileClose", NULL, gapFileCloseJs, NULL, NULL, NULL, napi_default, NULL},
+    {"nthPrime", NULL, nthPrimeJs, NULL, NULL, NULL, napi_default, NULL}
+  };
+
+  napi_define_properties(env, exports, sizeof(properties) / sizeof(properties[0]), properties);
+
+  return exports;
+
+} // end init
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, init)
@@ -2,8 +2,8 @@
   Some fun with prime numbers. Program lists all natural numbers to user
    defined maximum decomposed to the 1st degree.
   Author:     Vincent T. Mossman
-  Compile by: gcc -o naturalDecomposition naturalDecomposition.c
-  Run by:     ./naturalDecomposition <followed by [NAT maxumim]>
+  Compile by: gcc naturalDecomposition.c -pthread -lm -o naturalDecomposition
+  Run by:     ./naturalDecomposition [-t threads] <followed by [NAT maxumim]>
 */
 
 #include <stdlib.h>
@@ -12,9 +12,28 @@
 //#include <time.h>
 #include "eratosthenes.c"
 
+// content summary
+void *threadDecomposeSegment(void *rank);
+  /* threadDecomposeSegment sieves one smallest-prime-factor segment of the
+      current round and formats it into that thread's text buffer.
+      */
+
+// global variables
+long unsigned int decompositionMax;
+long unsigned int decompositionRound;
+long unsigned int decompositionThreads;
+uint32_t *decompositionBase;
+long unsigned int decompositionNumBase;
+uint32_t **segmentSpf;
+char **segmentText;
+long unsigned int *segmentLength;
+
 int main(int argc, char * argv[]) {
 
-  long unsigned int max, *sieve, i, lastPrime=1, j;
+  long unsigned int max, round, rounds, r, digits, threads;
+  int errorCode;
+  long rank;
+  pthread_t *threadHandles;
   FILE *f = fopen("naturalDecomposition.txt", "w");
   if (f == NULL) {
     printf("Error opening file!\n");
@@ -22,26 +41,101 @@ int main(int argc, char * argv[]) {
   }
 
   // get sieve size
-  if (argc != 2) {
-    printf("Usage: %s <followed by [NAT] maximum>\n", argv[0]);
+  if (parseThreadFlag(&argc, argv) != 0 || argc != 2) {
+    printf("Usage: %s [-t threads] <followed by [NAT] maximum>\n", argv[0]);
     exit(-1);
   }
   sscanf(argv[1], "%ld", &max);
 
-  // run sieve
-  sieve = eratosthenesFull(max);
+  // every thread owns one segment per round, and its text, so memory stays
+  //  at threads * (SPF segment + formatted segment) whatever max is
+  threads = sieveThreadCount();
+  rounds = (max + SPF_SEGMENT_SPAN - 1) / SPF_SEGMENT_SPAN;
+  if (threads > rounds) {
+    threads = rounds ? rounds : 1;
+  }
+  for (digits = 1, r = max; r >= 10; r /= 10) {
+    digits++;
+  }
+  decompositionMax = max;
+  decompositionThreads = threads;
+  decompositionBase = sievePrimesUpTo(isqrt(max), &decompositionNumBase);
+  segmentSpf = (uint32_t **) malloc(sizeof(uint32_t *)*threads);
+  segmentText = (char **) malloc(sizeof(char *)*threads);
+  segmentLength = (long unsigned int *) malloc(sizeof(long unsigned int)*threads);
+  for (r = 0; r < threads; r++) {
+    segmentSpf[r] = (uint32_t *) malloc(sizeof(uint32_t)*SPF_SEGMENT_ENTRIES);
+    segmentText[r] = (char *) malloc(SPF_SEGMENT_SPAN * (digits + 3));
+  }
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
 
-  // display natural decomposition
+  // display natural decomposition, one round of segments at a time
   fprintf(f,"{");
-  for (i = 0; i < max; i++) {
-    if (sieve[i] >= lastPrime) {
-      lastPrime = sieve[i];
-      fprintf(f,"%ld}\n{", sieve[i]);
-    } else {
-      fprintf(f,"%ld ",sieve[i]);
+  for (round = 0; round * threads < rounds; round++) {
+    decompositionRound = round;
+    for (rank = 0; rank < (long) threads; rank++) {
+      if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadDecomposeSegment, (void *) rank)) != 0) {
+        printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+      }
+    }
+    for (rank = 0; rank < (long) threads; rank++) {
+      if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+        printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+      }
+      fwrite(segmentText[rank], 1, segmentLength[rank], f);
     }
   }
+  fclose(f);
 
   printf("\nDone.\n\n");
 
 }
+
+void *threadDecomposeSegment(void *rank) {
+
+  long unsigned int segment, low, high, k, v, length, d;
+  uint32_t *spf;
+  char *text, digits[24];
+
+  segment = decompositionRound * decompositionThreads + (long unsigned int) rank;
+  spf = segmentSpf[(long) rank];
+  text = segmentText[(long) rank];
+  length = 0;
+  low = 1 + segment * SPF_SEGMENT_SPAN;
+  if (low > decompositionMax || low == 0) {
+    segmentLength[(long) rank] = 0;
+    return NULL;
+  }
+  high = (decompositionMax - low < SPF_SEGMENT_SPAN) ? decompositionMax
+                                                     : low + SPF_SEGMENT_SPAN - 1;
+
+  // smallest prime factors of the odd numbers in range
+  spfSegment(spf, low, high, decompositionBase, decompositionNumBase);
+
+  // a prime (or 1) closes its group, anything else is its smallest factor
+  for (k = low; k <= high; k++) {
+    if (k % 2 == 0) {
+      v = 2;
+    } else {
+      v = spf[(k - low) / 2] ? spf[(k - low) / 2] : k;
+    }
+    d = 0;
+    do {
+      digits[d++] = '0' + v % 10;
+      v /= 10;
+    } while (v);
+    while (d) {
+      text[length++] = digits[--d];
+    }
+    if (k % 2 ? spf[(k - low) / 2] == 0 : k == 2) {
+      memcpy(text + length, "}\n{", 3);
+      length += 3;
+    } else {
+      text[length++] = ' ';
+    }
+  }
+  segmentLength[(long) rank] = length;
+
+  return NULL;
+
+} // end threadDecomposeSegment
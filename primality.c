@@ -3,30 +3,403 @@
   Date:   October 18, 2016
 */
 
+#ifndef PRIMALITY_C
+#define PRIMALITY_C
+
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+typedef unsigned __int128 uint128_t;
+
+// content summary
+bool isPrime(long unsigned int n);
+  /* isPrime returns true if n is prime, else returns false. Exact for every
+      64-bit n: trial division by the small primes, then Miller-Rabin with a
+      base set known to admit no strong pseudoprime below 2^64.
+      */
+bool isPrime128(uint128_t n);
+  /* isPrime128 extends isPrime past 2^64 with the Baillie-PSW test (strong
+      base-2 Miller-Rabin plus a strong Lucas test). No BPSW pseudoprime is
+      known; for n < 2^64 it defers to isPrime and is exact.
+      */
+int smallPrimeDivisor(long unsigned int n);
+  /* smallPrimeDivisor returns the smallest of the first SMALL_PRIME_COUNT
+      primes dividing n, or 0 if none does.
+      */
+bool millerRabin64(uint64_t n, uint64_t base, uint64_t nInv, uint64_t one,
+                   uint64_t r2);
+  /* millerRabin64 runs one strong probable prime test of odd n to the given
+      base in Montgomery arithmetic. nInv, one and r2 come from montgomery64.
+      */
+void montgomery64(uint64_t n, uint64_t *nInv, uint64_t *one, uint64_t *r2);
+  /* montgomery64 sets up Montgomery arithmetic modulo odd n with R = 2^64:
+      nInv = n^-1 mod R, one = R mod n and r2 = R^2 mod n.
+      */
+uint64_t montMul64(uint64_t a, uint64_t b, uint64_t n, uint64_t nInv);
+  /* montMul64 returns a*b/R mod n for a, b in Montgomery form.
+      */
+uint128_t montMul128(uint128_t a, uint128_t b, uint128_t n, uint128_t nInv);
+  /* montMul128 is montMul64 with R = 2^128, for moduli above 2^64.
+      */
+
+// definitions
+#define SMALL_PRIME_COUNT 16
+
+const long unsigned int smallPrimes[SMALL_PRIME_COUNT] = {
+  2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53
+};
+
+// p | n exactly when n * (p^-1 mod 2^64) <= (2^64-1)/p, for odd p
+const uint64_t smallPrimeInverses[SMALL_PRIME_COUNT] = {
+  0, 0xaaaaaaaaaaaaaaabULL, 0xcccccccccccccccdULL, 0x6db6db6db6db6db7ULL,
+  0x2e8ba2e8ba2e8ba3ULL, 0x4ec4ec4ec4ec4ec5ULL, 0xf0f0f0f0f0f0f0f1ULL,
+  0x86bca1af286bca1bULL, 0xd37a6f4de9bd37a7ULL, 0x34f72c234f72c235ULL,
+  0xef7bdef7bdef7bdfULL, 0x14c1bacf914c1badULL, 0x8f9c18f9c18f9c19ULL,
+  0x82fa0be82fa0be83ULL, 0x51b3bea3677d46cfULL, 0x21cfb2b78c13521dULL
+};
+const uint64_t smallPrimeLimits[SMALL_PRIME_COUNT] = {
+  0, 0x5555555555555555ULL, 0x3333333333333333ULL, 0x2492492492492492ULL,
+  0x1745d1745d1745d1ULL, 0x13b13b13b13b13b1ULL, 0x0f0f0f0f0f0f0f0fULL,
+  0x0d79435e50d79435ULL, 0x0b21642c8590b216ULL, 0x08d3dcb08d3dcb08ULL,
+  0x0842108421084210ULL, 0x06eb3e45306eb3e4ULL, 0x063e7063e7063e70ULL,
+  0x05f417d05f417d05ULL, 0x0572620ae4c415c9ULL, 0x04d4873ecade304dULL
+};
+
+// Sinclair's bases: a strong probable prime to all seven is prime below 2^64
+const uint64_t millerRabinBases[7] = {
+  2, 325, 9375, 28178, 450775, 9780504, 1795265022
+};
 
 /******************************************************************************
 * Function isPrime returns true if n is prime, else returns false             *
 ******************************************************************************/
-bool isPrime(long int n) {
-  
-  long int i = 2;
-
-  // find divisor (if any)
-  while (n % i != 0) {
-    if (i > (n / 2)) {
-        i = n;
-        break;
-    }
-    i++;
-  } // end while
+bool isPrime(long unsigned int n) {
 
-  // determine primality
-  if (i < n) {
+  int i, divisor;
+  uint64_t nInv, one, r2;
+
+  // small n and small factors
+  if (n < 2) {
     return false;
-  }
-  else {
+  } // end if
+  divisor = smallPrimeDivisor(n);
+  if (divisor != 0) {
+    return (long unsigned int) divisor == n;
+  } // end if
+  if (n < 53 * 53) {
     return true;
   } // end if
 
+  // determine primality
+  montgomery64(n, &nInv, &one, &r2);
+  for (i = 0; i < 7; i++) {
+    if (!millerRabin64(n, millerRabinBases[i], nInv, one, r2)) {
+      return false;
+    } // end if
+  } // end for
+
+  return true;
+
 } // end isPrime
+
+/******************************************************************************
+* Function smallPrimeDivisor trial divides by the first few primes            *
+******************************************************************************/
+int smallPrimeDivisor(long unsigned int n) {
+
+  int i;
+
+  // multiply by inverses instead of dividing
+  if ((n & 1) == 0) {
+    return 2;
+  } // end if
+  for (i = 1; i < SMALL_PRIME_COUNT; i++) {
+    if (n * smallPrimeInverses[i] <= smallPrimeLimits[i]) {
+      return (int) smallPrimes[i];
+    } // end if
+  } // end for
+
+  return 0;
+
+} // end smallPrimeDivisor
+
+/******************************************************************************
+* Function montgomery64 precomputes the constants for modulus n               *
+******************************************************************************/
+void montgomery64(uint64_t n, uint64_t *nInv, uint64_t *one, uint64_t *r2) {
+
+  uint64_t x = n;
+  int i;
+
+  // Newton iteration doubles the correct low bits each step (3 -> 96)
+  for (i = 0; i < 5; i++) {
+    x *= 2 - n * x;
+  } // end for
+  *nInv = x;
+  *one = (0 - n) % n;
+  *r2 = (uint64_t) (((uint128_t) *one * *one) % n);
+
+} // end montgomery64
+
+/******************************************************************************
+* Function montMul64 multiplies and reduces in one step (REDC)                *
+******************************************************************************/
+uint64_t montMul64(uint64_t a, uint64_t b, uint64_t n, uint64_t nInv) {
+
+  uint128_t t = (uint128_t) a * b;
+  uint64_t m = (uint64_t) t * nInv;
+  uint64_t th = (uint64_t) (t >> 64);
+  uint64_t mh = (uint64_t) (((uint128_t) m * n) >> 64);
+
+  // the low halves of t and m*n agree, so only the high halves remain
+  return (th >= mh) ? th - mh : th - mh + n;
+
+} // end montMul64
+
+/******************************************************************************
+* Function millerRabin64 is one round of the strong probable prime test       *
+******************************************************************************/
+bool millerRabin64(uint64_t n, uint64_t base, uint64_t nInv, uint64_t one,
+                   uint64_t r2) {
+
+  uint64_t d, a, x, minusOne;
+  int s, r;
+
+  // n-1 = d*2^s with d odd
+  d = n - 1;
+  s = __builtin_ctzll(d);
+  d >>= s;
+
+  // a base divisible by n says nothing
+  a = base % n;
+  if (a == 0) {
+    return true;
+  } // end if
+
+  // x = a^d in Montgomery form
+  a = montMul64(a, r2, n, nInv);
+  x = one;
+  while (d) {
+    if (d & 1) {
+      x = montMul64(x, a, n, nInv);
+    } // end if
+    a = montMul64(a, a, n, nInv);
+    d >>= 1;
+  } // end while
+
+  minusOne = n - one;
+  if (x == one || x == minusOne) {
+    return true;
+  } // end if
+  for (r = 1; r < s; r++) {
+    x = montMul64(x, x, n, nInv);
+    if (x == minusOne) {
+      return true;
+    } // end if
+  } // end for
+
+  return false;
+
+} // end millerRabin64
+
+/******************************************************************************
+* Function montMul128 is REDC with 128-bit limbs: the 256-bit products are    *
+*  assembled from four 64x64 multiplies                                       *
+******************************************************************************/
+uint128_t montMul128(uint128_t a, uint128_t b, uint128_t n, uint128_t nInv) {
+
+  uint128_t aLo = (uint64_t) a, aHi = a >> 64, bLo = (uint64_t) b, bHi = b >> 64;
+  uint128_t ll, lh, hl, hh, mid, tLo, tHi, m, mLo, mHi, nLo, nHi, mnHi;
+
+  // t = a*b as (tHi, tLo)
+  ll = aLo * bLo;
+  lh = aLo * bHi;
+  hl = aHi * bLo;
+  hh = aHi * bHi;
+  mid = (ll >> 64) + (uint64_t) lh + (uint64_t) hl;
+  tLo = (mid << 64) | (uint64_t) ll;
+  tHi = hh + (lh >> 64) + (hl >> 64) + (mid >> 64);
+
+  // high half of m*n, where m = tLo * n^-1 mod 2^128
+  m = tLo * nInv;
+  mLo = (uint64_t) m;
+  mHi = m >> 64;
+  nLo = (uint64_t) n;
+  nHi = n >> 64;
+  ll = mLo * nLo;
+  lh = mLo * nHi;
+  hl = mHi * nLo;
+  hh = mHi * nHi;
+  mid = (ll >> 64) + (uint64_t) lh + (uint64_t) hl;
+  mnHi = hh + (lh >> 64) + (hl >> 64) + (mid >> 64);
+
+  return (tHi >= mnHi) ? tHi - mnHi : tHi - mnHi + n;
+
+} // end montMul128
+
+/******************************************************************************
+* Function isPrime128 is Baillie-PSW: strong base-2 test, then strong Lucas   *
+*  with Selfridge's parameters (first D in 5,-7,9,-11.. with (D/n) = -1,      *
+*  P = 1, Q = (1-D)/4), all in 128-bit Montgomery arithmetic                  *
+******************************************************************************/
+bool isPrime128(uint128_t n) {
+
+  uint128_t nInv, one, r2, minusOne, d, a, x, root, t;
+  uint128_t U, V, Qk, Qm, Dm, twoQ;
+  long int D;
+  int s, r, bit, jacobi;
+
+  if (n >> 64 == 0) {
+    return isPrime((long unsigned int) n);
+  } // end if
+  for (s = 0; s < SMALL_PRIME_COUNT; s++) {
+    if (n % smallPrimes[s] == 0) {
+      return false;
+    } // end if
+  } // end for
+
+  // Montgomery constants for R = 2^128
+  nInv = n;
+  for (s = 0; s < 7; s++) {
+    nInv *= 2 - n * nInv;
+  } // end for
+  one = (0 - n) % n;
+  r2 = one;
+  for (s = 0; s < 128; s++) {  // r2 = one * 2^128 by doubling
+    r2 = (r2 >= n - r2) ? r2 - (n - r2) : r2 + r2;
+  } // end for
+  minusOne = n - one;
+
+  // strong probable prime to base 2
+  d = n - 1;
+  s = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    s++;
+  } // end while
+  a = montMul128(2, r2, n, nInv);
+  x = one;
+  while (d) {
+    if (d & 1) {
+      x = montMul128(x, a, n, nInv);
+    } // end if
+    a = montMul128(a, a, n, nInv);
+    d >>= 1;
+  } // end while
+  if (x != one && x != minusOne) {
+    for (r = 1; r < s && x != minusOne; r++) {
+      x = montMul128(x, x, n, nInv);
+    } // end for
+    if (x != minusOne) {
+      return false;
+    } // end if
+  } // end if
+
+  // squares never yield (D/n) = -1
+  root = (uint128_t) sqrtl((long double) n);
+  if (root > UINT64_MAX) {
+    root = UINT64_MAX;
+  } // end if
+  while (root * root > n) {
+    root--;
+  } // end while
+  while (root < UINT64_MAX && (root + 1) * (root + 1) <= n) {
+    root++;
+  } // end while
+  if (root * root == n) {
+    return false;
+  } // end if
+
+  // Selfridge's D: Jacobi symbol by the binary algorithm
+  D = 5;
+  while (1) {
+    a = (D > 0) ? (uint128_t) D : n - (uint128_t) (-D);
+    x = n;
+    jacobi = 1;
+    while (a != 0) {
+      while ((a & 1) == 0) {
+        a >>= 1;
+        if ((x & 7) == 3 || (x & 7) == 5) {
+          jacobi = -jacobi;
+        } // end if
+      } // end while
+      t = a;
+      a = x;
+      x = t;
+      if ((a & 3) == 3 && (x & 3) == 3) {
+        jacobi = -jacobi;
+      } // end if
+      a %= x;
+    } // end while
+    if (x != 1) {
+      return false;            // gcd(D, n) > 1 and n is no small prime
+    } // end if
+    if (jacobi == -1) {
+      break;
+    } // end if
+    D = (D > 0) ? -(D + 2) : -D + 2;
+  } // end while
+
+  // D and Q in Montgomery form
+  Dm = montMul128((D > 0) ? (uint128_t) D : (uint128_t) (-D), r2, n, nInv);
+  if (D < 0) {
+    Dm = n - Dm;
+  } // end if
+  Qm = montMul128((uint128_t) ((D > 0 ? D - 1 : 1 - D) / 4), r2, n, nInv);
+  if (D > 0) {
+    Qm = n - Qm;               // Q = (1-D)/4 is negative for positive D
+  } // end if
+
+  // n+1 = d*2^s with d odd
+  d = n + 1;
+  s = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    s++;
+  } // end while
+
+  // U_d, V_d and Q^d by a left-to-right ladder, starting from k = 1
+  U = one;
+  V = one;
+  Qk = Qm;
+  for (bit = 127 - (int) (d >> 64 ? __builtin_clzll((uint64_t) (d >> 64))
+                                  : 64 + __builtin_clzll((uint64_t) d)) - 1;
+       bit >= 0; bit--) {
+    // k -> 2k
+    U = montMul128(U, V, n, nInv);
+    twoQ = (Qk >= n - Qk) ? Qk - (n - Qk) : Qk + Qk;
+    V = montMul128(V, V, n, nInv);
+    V = (V >= twoQ) ? V - twoQ : V + (n - twoQ);
+    Qk = montMul128(Qk, Qk, n, nInv);
+    if ((d >> bit) & 1) {
+      // k -> k+1: U' = (U + V)/2, V' = (D*U + V)/2
+      t = montMul128(Dm, U, n, nInv);
+      U = (U >= n - V) ? U - (n - V) : U + V;
+      V = (t >= n - V) ? t - (n - V) : t + V;
+      U = (U & 1) ? (U >> 1) + (n >> 1) + 1 : U >> 1;
+      V = (V & 1) ? (V >> 1) + (n >> 1) + 1 : V >> 1;
+      Qk = montMul128(Qk, Qm, n, nInv);
+    } // end if
+  } // end for
+
+  // strong Lucas probable prime: U_d = 0 or V_(d*2^r) = 0 for some r < s
+  if (U == 0 || V == 0) {
+    return true;
+  } // end if
+  for (r = 1; r < s; r++) {
+    twoQ = (Qk >= n - Qk) ? Qk - (n - Qk) : Qk + Qk;
+    V = montMul128(V, V, n, nInv);
+    V = (V >= twoQ) ? V - twoQ : V + (n - twoQ);
+    if (V == 0) {
+      return true;
+    } // end if
+    Qk = montMul128(Qk, Qk, n, nInv);
+  } // end for
+
+  return false;
+
+} // end isPrime128
+
+#endif
@@ -1,37 +1,243 @@
 /* Some fun with prime numbers
    Author:     Vincent T. Mossman
-   Compile by: gcc -o prime prime.c
-   Run by:     ./prime
+   Compile by: gcc -o prime prime.c -lm
+   Run by:     ./prime [-q] [NAT to test primality]
+               ./prime --batch [--bitmap] [file of NATs]
 */
 
-#include "primality.c"
+#include "primeBatch.c"
+#include "timer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+bool parseNatural(const char *s, uint128_t *n);
+int batchMain(int argc, char * argv[]);
+
+// numbers classified per isPrimeBatch call (a multiple of 8 for --bitmap)
+#define BATCH_BLOCK 65536
+#define BATCH_TOKEN_ECHO 40             // characters of a bad token reported
 
 int main(int argc, char * argv[]) {
 
-  if (argc != 2) {
-    printf("Usage: %s <followed by [NAT to test primality]>\n", argv[0]);
+  bool quiet = false, prime, neither;
+  uint128_t test;
+  char digits[40];
+  int i;
+  double start, finish, elapsed;
+
+  if (argc >= 2 && strcmp(argv[1], "--batch") == 0) {
+    return batchMain(argc, argv);
+  }
+
+  // -q: print only "prime"/"composite"/"neither" and report through the exit status
+  if (argc == 3 && strcmp(argv[1], "-q") == 0) {
+    quiet = true;
+  }
+
+  if (argc != 2 + quiet || !parseNatural(argv[1 + quiet], &test)) {
+    printf("Usage: %s [-q] <followed by [NAT to test primality] (below 2^128)>\n", argv[0]);
+    printf("       %s --batch [--bitmap] <optionally followed by [file of NATs]>\n", argv[0]);
     exit(-1);
   }
 
-  long int test;
-  sscanf(argv[1], "%lu", &test);
+  GET_TIME(start);
+
+  prime = isPrime128(test);
 
-  clock_t begin = clock();
+  GET_TIME(finish);
+  elapsed = finish - start;
 
-  if (isPrime(test)) {
-    printf("\n%lu is prime\n", test);
+  if (quiet) {
+    printf("%s\n", prime ? "prime" : (test < 2 ? "neither" : "composite"));
+    return prime ? 0 : 1;
+  }
+
+  // format test back to decimal
+  neither = test < 2;
+  i = sizeof(digits) - 1;
+  digits[i] = '\0';
+  do {
+    digits[--i] = '0' + (int) (test % 10);
+    test /= 10;
+  } while (test);
+
+  if (prime) {
+    printf("\n%s is prime\n", digits + i);
+  }
+  else if (neither) {
+    printf("\n%s is neither prime nor composite\n", digits + i);
   }
   else {
-    printf("\n%lu is composite\n", test);
+    printf("\n%s is composite\n", digits + i);
   }
 
-  clock_t end = clock();
-  double time_spent = (double) (end - begin) / CLOCKS_PER_SEC;
+  printf("\nCPU execution time: %0.6fs\n\n", elapsed);
 
-  printf("\nCPU execution time: %0.3fs\n\n", time_spent);
+  return 0;
 
 }
+
+/******************************************************************************
+* Function parseNatural reads a decimal natural below 2^128 into n. Returns   *
+*  false on anything else (signs, junk, overflow).                            *
+******************************************************************************/
+bool parseNatural(const char *s, uint128_t *n) {
+
+  uint128_t value = 0, limit = ~(uint128_t) 0;
+
+  if (*s == '\0') {
+    return false;
+  } // end if
+  for (; *s; s++) {
+    if (*s < '0' || *s > '9' || value > (limit - (*s - '0')) / 10) {
+      return false;
+    } // end if
+    value = value * 10 + (*s - '0');
+  } // end for
+  *n = value;
+
+  return true;
+
+} // end parseNatural
+
+/******************************************************************************
+* Function batchMain classifies every natural read from a file (or stdin).    *
+*  Numbers are separated by whitespace or commas, so primeList output can be  *
+*  piped straight in. Writes "<NAT> prime|composite|neither" lines (0 and 1   *
+*  are neither), or with --bitmap one bit per input (LSB first within each    *
+*  byte). A token that is not a natural below 2^64 is reported on stderr and  *
+*  skipped (a 0 bit in the bitmap), and the exit status is then 1.            *
+******************************************************************************/
+int batchMain(int argc, char * argv[]) {
+
+  FILE *in = stdin;
+  bool bitmap = false, *result, inToken = false, malformed = false, tooLarge = false;
+  long unsigned int *numbers, count = 0, total = 0, primes = 0, rejected = 0, value = 0;
+  long unsigned int i, j, length, n, tokenLength = 0;
+  char *readBuffer, *writeBuffer, digits[24], token[BATCH_TOKEN_ECHO + 1];
+  size_t got, used = 0;
+  unsigned char byte;
+  int arg, k, c;
+  double start, finish;
+
+  for (arg = 2; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--bitmap") == 0) {
+      bitmap = true;
+    } else if (in == stdin && (in = fopen(argv[arg], "r")) == NULL) {
+      printf("Error opening file!\n");
+      exit(1);
+    } // end if
+  } // end for
+
+  numbers = (long unsigned int *) malloc(sizeof(long unsigned int)*BATCH_BLOCK);
+  result = (bool *) malloc(sizeof(bool)*BATCH_BLOCK);
+  readBuffer = (char *) malloc(1 << 20);
+  writeBuffer = (char *) malloc((size_t) BATCH_BLOCK * 32);
+
+  GET_TIME(start);
+
+  do {
+    // parse as many numbers as fit in a block
+    got = fread(readBuffer, 1, 1 << 20, in);
+    for (i = 0; i <= got; i++) {
+      c = (i < got) ? (unsigned char) readBuffer[i] : (got ? -1 : ' ');
+      if (c == -1) {
+        break;                       // token may continue in the next read
+      } // end if
+      if (c != ' ' && c != ',' && (c < '\t' || c > '\r')) {
+        if (!inToken) {
+          inToken = true;
+          malformed = tooLarge = false;
+          value = 0;
+          tokenLength = 0;
+        } // end if
+        if (tokenLength < BATCH_TOKEN_ECHO) {
+          token[tokenLength] = (char) c;
+        } // end if
+        tokenLength++;
+        if (c >= '0' && c <= '9') {
+          tooLarge |= __builtin_mul_overflow(value, 10, &value) |
+                      __builtin_add_overflow(value, c - '0', &value);
+        } else {
+          malformed = true;
+        } // end if
+        continue;
+      } // end if
+      if (inToken) {
+        inToken = false;
+        if (malformed || tooLarge) {
+          token[tokenLength < BATCH_TOKEN_ECHO ? tokenLength : BATCH_TOKEN_ECHO] = '\0';
+          fprintf(stderr, "%s%s: %s\n", token, tokenLength > BATCH_TOKEN_ECHO ? "..." : "",
+                  malformed ? "not a natural number" : "too large for --batch (limit 2^64-1)");
+          rejected++;
+          if (bitmap) {
+            numbers[count++] = 0;
+          } // end if
+        } else {
+          numbers[count++] = value;
+        } // end if
+      } // end if
+
+      // classify and write a full block (or whatever is left at the end)
+      if (count == BATCH_BLOCK || (got == 0 && count > 0)) {
+        isPrimeBatch(numbers, count, result);
+        used = 0;
+        for (j = 0; j < count; j += 8) {
+          byte = 0;
+          for (k = 0; k < 8 && j + k < count; k++) {
+            byte |= (unsigned char) result[j+k] << k;
+            primes += result[j+k];
+            if (!bitmap) {
+              length = 0;
+              n = numbers[j+k];
+              do {
+                digits[length++] = '0' + n % 10;
+                n /= 10;
+              } while (n);
+              while (length) {
+                writeBuffer[used++] = digits[--length];
+              } // end while
+              if (numbers[j+k] < 2) {
+                memcpy(writeBuffer + used, " neither\n", 9);
+                used += 9;
+              } else {
+                memcpy(writeBuffer + used, result[j+k] ? " prime\n" : " composite\n",
+                       result[j+k] ? 7 : 11);
+                used += result[j+k] ? 7 : 11;
+              } // end if
+            } // end if
+          } // end for (k)
+          if (bitmap) {
+            writeBuffer[used++] = (char) byte;
+          } // end if
+        } // end for (j)
+        fwrite(writeBuffer, 1, used, stdout);
+        total += count;
+        count = 0;
+      } // end if
+    } // end for (i)
+  } while (got > 0);
+
+  GET_TIME(finish);
+
+  fflush(stdout);
+  fprintf(stderr, "Tested %lu numbers (%lu prime) in %0.6lfs: %0.0lf tests/s [%s]\n",
+          total, primes, finish - start, total / (finish - start),
+          batchKernelName());
+
+  if (rejected > 0) {
+    fprintf(stderr, "Rejected %lu tokens that are not naturals below 2^64\n", rejected);
+  }
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  free(writeBuffer);
+  free(readBuffer);
+  free(result);
+  free(numbers);
+
+  return rejected ? 1 : 0;
+
+} // end batchMain
@@ -0,0 +1,571 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMEBATCH_C
+#define PRIMEBATCH_C
+
+#include <stdlib.h>
+#include <immintrin.h>
+#include "primality.c"
+
+// content summary
+void isPrimeBatch(const long unsigned int *n, long unsigned int count,
+                  bool *result);
+  /* isPrimeBatch sets result[i] = isPrime(n[i]) for count numbers at once.
+      Small factors are screened out first, then each Miller-Rabin base runs
+      in SIMD lanes BATCH_LANES numbers at a time over the numbers that
+      passed every base before it.
+      */
+const char *batchKernelName(void);
+  /* batchKernelName names the strong-test kernel picked for this CPU:
+      "avx512", "avx2" or "scalar".
+      */
+void strongBatchScalar(const uint64_t *n, const uint64_t *one, uint64_t base,
+                       bool *pass, long unsigned int count);
+  /* strongBatchScalar is the portable strong test to one base over count
+      numbers. The SIMD kernels strongBatchAvx512 and strongBatchAvx2 have
+      the same contract, with count a multiple of BATCH_LANES.
+      */
+
+// definitions
+#define BATCH_LANES 32          // numbers per kernel block (4 zmm / 8 ymm)
+
+/* Both SIMD kernels split every lane's own n-1 into d*2^s with a variable
+    shift and raise the base to d from the top bit down. Base 2 squares and
+    doubles where the bit is set. Other bases are first taken into
+    Montgomery form, base * R mod n, by doubling and adding R mod n along
+    their bits (so no lane divides), then go four bits at a time: four
+    squarings and one multiply by base^digit, gathered per lane from a
+    table of base^0 .. base^15. A lane passes if base^d is 1 or -1, if -1
+    shows up in the s-1 squarings after it, or if n divides the base. Four
+    independent vectors are kept in flight so the multiply latency of one
+    Montgomery step hides behind the others. The 64x64-bit products are
+    built from 32x32 vpmuludq partial products (AVX-512 takes the low half
+    n^-1 * t with vpmullq). */
+
+/******************************************************************************
+* Function montMulAvx512 is montMul64 in each 64-bit lane                     *
+******************************************************************************/
+__attribute__((target("avx512f,avx512dq")))
+static inline __m512i montMulAvx512(__m512i a, __m512i b, __m512i n, __m512i nInv) {
+
+  __m512i lo32 = _mm512_set1_epi64(0xffffffffULL);
+  __m512i ll, lh, hl, hh, mid, tLo, tHi, m, mh, x;
+
+  // t = a*b
+  ll = _mm512_mul_epu32(a, b);
+  lh = _mm512_mul_epu32(a, _mm512_srli_epi64(b, 32));
+  hl = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b);
+  hh = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+  mid = _mm512_add_epi64(_mm512_srli_epi64(ll, 32),
+          _mm512_add_epi64(_mm512_and_si512(lh, lo32),
+                           _mm512_and_si512(hl, lo32)));
+  tLo = _mm512_or_si512(_mm512_slli_epi64(mid, 32),
+                        _mm512_and_si512(ll, lo32));
+  tHi = _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(mid, 32)),
+          _mm512_add_epi64(_mm512_srli_epi64(lh, 32),
+                           _mm512_srli_epi64(hl, 32)));
+
+  // m = tLo * n^-1 mod 2^64
+  m = _mm512_mullo_epi64(tLo, nInv);
+
+  // high half of m*n
+  hh = _mm512_srli_epi64(m, 32);
+  ll = _mm512_mul_epu32(m, n);
+  lh = _mm512_mul_epu32(m, _mm512_srli_epi64(n, 32));
+  hl = _mm512_mul_epu32(hh, n);
+  hh = _mm512_mul_epu32(hh, _mm512_srli_epi64(n, 32));
+  mid = _mm512_add_epi64(_mm512_srli_epi64(ll, 32),
+          _mm512_add_epi64(_mm512_and_si512(lh, lo32),
+                           _mm512_and_si512(hl, lo32)));
+  mh = _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(mid, 32)),
+         _mm512_add_epi64(_mm512_srli_epi64(lh, 32),
+                          _mm512_srli_epi64(hl, 32)));
+
+  // tHi - mh (mod n)
+  x = _mm512_sub_epi64(tHi, mh);
+  return _mm512_mask_add_epi64(x, _mm512_cmplt_epu64_mask(tHi, mh), x, n);
+
+} // end montMulAvx512
+
+/******************************************************************************
+* Function addModAvx512 returns a + b mod n for a, b < n in each lane         *
+******************************************************************************/
+__attribute__((target("avx512f,avx512dq")))
+static inline __m512i addModAvx512(__m512i a, __m512i b, __m512i n) {
+
+  __m512i sum = _mm512_add_epi64(a, b);
+  __mmask8 wrap = _mm512_cmplt_epu64_mask(sum, a) |
+                  _mm512_cmpge_epu64_mask(sum, n);
+
+  return _mm512_mask_sub_epi64(sum, wrap, sum, n);
+
+} // end addModAvx512
+
+/******************************************************************************
+* Function strongBatchAvx512 is the strong test, 8 lanes per zmm              *
+******************************************************************************/
+__attribute__((target("avx512f,avx512dq")))
+void strongBatchAvx512(const uint64_t *n, const uint64_t *one, uint64_t base,
+                       bool *pass, long unsigned int count) {
+
+  __m512i vn[4], vInv[4], vone[4], vm1[4], vd[4], vs[4], va[4], x[4];
+  __m512i ll, mid, m, lane, digit;
+  __mmask8 passed[4], bit;
+  long unsigned int b, j;
+  int i, k, u, top, maxS;
+  uint64_t s[BATCH_LANES], table[4][16][8];
+
+  lane = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+  for (b = 0; b < count; b += BATCH_LANES) {
+
+    // n-1 = d*2^s in every lane
+    top = 0;
+    maxS = 0;
+    for (j = 0; j < BATCH_LANES; j++) {
+      s[j] = __builtin_ctzll(n[b+j] - 1);
+      if (64 - __builtin_clzll(n[b+j] - 1) - (int) s[j] > top) {
+        top = 64 - __builtin_clzll(n[b+j] - 1) - (int) s[j];
+      } // end if
+      if ((int) s[j] > maxS) {
+        maxS = (int) s[j];
+      } // end if
+    } // end for (j)
+
+    for (u = 0; u < 4; u++) {
+      vn[u] = _mm512_loadu_si512((const void *) (n + b + 8*u));
+      vone[u] = _mm512_loadu_si512((const void *) (one + b + 8*u));
+      vs[u] = _mm512_loadu_si512((const void *) (s + 8*u));
+      vd[u] = _mm512_srlv_epi64(_mm512_sub_epi64(vn[u], _mm512_set1_epi64(1)),
+                                vs[u]);
+      vm1[u] = _mm512_sub_epi64(vn[u], vone[u]);
+
+      // n^-1 mod 2^64 by Newton iteration
+      vInv[u] = vn[u];
+      for (k = 0; k < 5; k++) {
+        ll = _mm512_mul_epu32(vn[u], vInv[u]);
+        mid = _mm512_add_epi64(
+                _mm512_mul_epu32(vn[u], _mm512_srli_epi64(vInv[u], 32)),
+                _mm512_mul_epu32(_mm512_srli_epi64(vn[u], 32), vInv[u]));
+        m = _mm512_add_epi64(ll, _mm512_slli_epi64(mid, 32));
+        m = _mm512_sub_epi64(_mm512_set1_epi64(2), m);
+        ll = _mm512_mul_epu32(vInv[u], m);
+        mid = _mm512_add_epi64(
+                _mm512_mul_epu32(vInv[u], _mm512_srli_epi64(m, 32)),
+                _mm512_mul_epu32(_mm512_srli_epi64(vInv[u], 32), m));
+        vInv[u] = _mm512_add_epi64(ll, _mm512_slli_epi64(mid, 32));
+      } // end for (k)
+    } // end for (u)
+
+    if (base == 2) {
+      // x = 2^d: square, and double where the bit of d is set
+      for (u = 0; u < 4; u++) {
+        x[u] = vone[u];
+        passed[u] = 0;
+      } // end for
+      for (i = top - 1; i >= 0; i--) {
+        for (u = 0; u < 4; u++) {
+          x[u] = montMulAvx512(x[u], x[u], vn[u], vInv[u]);
+          bit = _mm512_test_epi64_mask(_mm512_srli_epi64(vd[u], i),
+                                       _mm512_set1_epi64(1));
+          x[u] = _mm512_mask_mov_epi64(x[u], bit,
+                                       addModAvx512(x[u], x[u], vn[u]));
+        } // end for (u)
+      } // end for (i)
+    } else {
+      // base * R mod n and its powers up to base^15; a lane whose n divides
+      //  the base passes outright
+      for (u = 0; u < 4; u++) {
+        va[u] = _mm512_setzero_si512();
+        for (k = 63 - __builtin_clzll(base); k >= 0; k--) {
+          va[u] = addModAvx512(va[u], va[u], vn[u]);
+          if ((base >> k) & 1) {
+            va[u] = addModAvx512(va[u], vone[u], vn[u]);
+          } // end if
+        } // end for (k)
+        passed[u] = _mm512_cmpeq_epi64_mask(va[u], _mm512_setzero_si512());
+        _mm512_storeu_si512((void *) table[u][0], vone[u]);
+        _mm512_storeu_si512((void *) table[u][1], va[u]);
+        x[u] = va[u];
+      } // end for (u)
+      for (k = 2; k < 16; k++) {
+        for (u = 0; u < 4; u++) {
+          x[u] = montMulAvx512(x[u], va[u], vn[u], vInv[u]);
+          _mm512_storeu_si512((void *) table[u][k], x[u]);
+        } // end for (u)
+      } // end for (k)
+
+      // x = base^d four bits at a time, the top digit straight from the table
+      i = ((top + 3) / 4 - 1) * 4;
+      for (u = 0; u < 4; u++) {
+        digit = _mm512_and_si512(_mm512_srli_epi64(vd[u], i), _mm512_set1_epi64(15));
+        x[u] = _mm512_i64gather_epi64(_mm512_add_epi64(_mm512_slli_epi64(digit, 3), lane),
+                                      (const void *) table[u], 8);
+      } // end for (u)
+      for (i -= 4; i >= 0; i -= 4) {
+        for (k = 0; k < 4; k++) {
+          for (u = 0; u < 4; u++) {
+            x[u] = montMulAvx512(x[u], x[u], vn[u], vInv[u]);
+          } // end for (u)
+        } // end for (k)
+        for (u = 0; u < 4; u++) {
+          digit = _mm512_and_si512(_mm512_srli_epi64(vd[u], i), _mm512_set1_epi64(15));
+          x[u] = montMulAvx512(x[u], _mm512_i64gather_epi64(
+                                 _mm512_add_epi64(_mm512_slli_epi64(digit, 3), lane),
+                                 (const void *) table[u], 8), vn[u], vInv[u]);
+        } // end for (u)
+      } // end for (i)
+    } // end if
+
+    // base^d = 1 or -1, or -1 after r < s squarings
+    for (u = 0; u < 4; u++) {
+      passed[u] |= _mm512_cmpeq_epi64_mask(x[u], vone[u]) |
+                   _mm512_cmpeq_epi64_mask(x[u], vm1[u]);
+    } // end for
+    for (i = 1; i < maxS; i++) {
+      for (u = 0; u < 4; u++) {
+        x[u] = montMulAvx512(x[u], x[u], vn[u], vInv[u]);
+        passed[u] |= _mm512_cmpgt_epu64_mask(vs[u], _mm512_set1_epi64(i)) &
+                     _mm512_cmpeq_epi64_mask(x[u], vm1[u]);
+      } // end for (u)
+    } // end for (i)
+
+    for (j = 0; j < BATCH_LANES; j++) {
+      pass[b+j] = (passed[j / 8] >> (j % 8)) & 1;
+    } // end for
+  } // end for (b)
+
+} // end strongBatchAvx512
+
+/******************************************************************************
+* Function ltuAvx2 compares unsigned 64-bit lanes: all ones where a < b       *
+******************************************************************************/
+__attribute__((target("avx2")))
+static inline __m256i ltuAvx2(__m256i a, __m256i b) {
+
+  __m256i sign = _mm256_set1_epi64x((long long) 0x8000000000000000ULL);
+
+  return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+
+} // end ltuAvx2
+
+/******************************************************************************
+* Function montMulAvx2 is montMul64 in each 64-bit lane                       *
+******************************************************************************/
+__attribute__((target("avx2")))
+static inline __m256i montMulAvx2(__m256i a, __m256i b, __m256i n, __m256i nInv) {
+
+  __m256i lo32 = _mm256_set1_epi64x(0xffffffffULL);
+  __m256i ll, lh, hl, hh, mid, tLo, tHi, m, mh, x;
+
+  // t = a*b
+  ll = _mm256_mul_epu32(a, b);
+  lh = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+  hl = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  hh = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+  mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32),
+          _mm256_add_epi64(_mm256_and_si256(lh, lo32),
+                           _mm256_and_si256(hl, lo32)));
+  tLo = _mm256_or_si256(_mm256_slli_epi64(mid, 32),
+                        _mm256_and_si256(ll, lo32));
+  tHi = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+          _mm256_add_epi64(_mm256_srli_epi64(lh, 32),
+                           _mm256_srli_epi64(hl, 32)));
+
+  // m = tLo * n^-1 mod 2^64
+  m = _mm256_add_epi64(
+        _mm256_mul_epu32(tLo, _mm256_srli_epi64(nInv, 32)),
+        _mm256_mul_epu32(_mm256_srli_epi64(tLo, 32), nInv));
+  m = _mm256_add_epi64(_mm256_mul_epu32(tLo, nInv),
+                       _mm256_slli_epi64(m, 32));
+
+  // high half of m*n
+  hh = _mm256_srli_epi64(m, 32);
+  ll = _mm256_mul_epu32(m, n);
+  lh = _mm256_mul_epu32(m, _mm256_srli_epi64(n, 32));
+  hl = _mm256_mul_epu32(hh, n);
+  hh = _mm256_mul_epu32(hh, _mm256_srli_epi64(n, 32));
+  mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32),
+          _mm256_add_epi64(_mm256_and_si256(lh, lo32),
+                           _mm256_and_si256(hl, lo32)));
+  mh = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+         _mm256_add_epi64(_mm256_srli_epi64(lh, 32),
+                          _mm256_srli_epi64(hl, 32)));
+
+  // tHi - mh (mod n)
+  x = _mm256_sub_epi64(tHi, mh);
+  return _mm256_add_epi64(x, _mm256_and_si256(ltuAvx2(tHi, mh), n));
+
+} // end montMulAvx2
+
+/******************************************************************************
+* Function addModAvx2 returns a + b mod n for a, b < n in each lane           *
+******************************************************************************/
+__attribute__((target("avx2")))
+static inline __m256i addModAvx2(__m256i a, __m256i b, __m256i n) {
+
+  __m256i sum = _mm256_add_epi64(a, b);
+  __m256i wrap = _mm256_or_si256(ltuAvx2(sum, a),
+                                 _mm256_xor_si256(ltuAvx2(sum, n),
+                                                  _mm256_set1_epi64x(-1)));
+
+  return _mm256_sub_epi64(sum, _mm256_and_si256(wrap, n));
+
+} // end addModAvx2
+
+/******************************************************************************
+* Function strongBatchAvx2 is the same kernel, 4 lanes per ymm, run over each *
+*  block in two halves                                                        *
+******************************************************************************/
+__attribute__((target("avx2")))
+void strongBatchAvx2(const uint64_t *n, const uint64_t *one, uint64_t base,
+                     bool *pass, long unsigned int count) {
+
+  __m256i vn[4], vInv[4], vone[4], vm1[4], vd[4], vs[4], va[4], x[4], passed[4];
+  __m256i ll, mid, m, lane, digit, bit;
+  long unsigned int b, j;
+  int i, k, u, top, maxS;
+  uint64_t s[16], out[16], table[4][16][4];
+
+  lane = _mm256_set_epi64x(3, 2, 1, 0);
+  for (b = 0; b < count; b += 16) {
+
+    // n-1 = d*2^s in every lane
+    top = 0;
+    maxS = 0;
+    for (j = 0; j < 16; j++) {
+      s[j] = __builtin_ctzll(n[b+j] - 1);
+      if (64 - __builtin_clzll(n[b+j] - 1) - (int) s[j] > top) {
+        top = 64 - __builtin_clzll(n[b+j] - 1) - (int) s[j];
+      } // end if
+      if ((int) s[j] > maxS) {
+        maxS = (int) s[j];
+      } // end if
+    } // end for (j)
+
+    for (u = 0; u < 4; u++) {
+      vn[u] = _mm256_loadu_si256((const __m256i *) (n + b + 4*u));
+      vone[u] = _mm256_loadu_si256((const __m256i *) (one + b + 4*u));
+      vs[u] = _mm256_loadu_si256((const __m256i *) (s + 4*u));
+      vd[u] = _mm256_srlv_epi64(_mm256_sub_epi64(vn[u], _mm256_set1_epi64x(1)),
+                                vs[u]);
+      vm1[u] = _mm256_sub_epi64(vn[u], vone[u]);
+
+      // n^-1 mod 2^64 by Newton iteration
+      vInv[u] = vn[u];
+      for (k = 0; k < 5; k++) {
+        ll = _mm256_mul_epu32(vn[u], vInv[u]);
+        mid = _mm256_add_epi64(
+                _mm256_mul_epu32(vn[u], _mm256_srli_epi64(vInv[u], 32)),
+                _mm256_mul_epu32(_mm256_srli_epi64(vn[u], 32), vInv[u]));
+        m = _mm256_add_epi64(ll, _mm256_slli_epi64(mid, 32));
+        m = _mm256_sub_epi64(_mm256_set1_epi64x(2), m);
+        ll = _mm256_mul_epu32(vInv[u], m);
+        mid = _mm256_add_epi64(
+                _mm256_mul_epu32(vInv[u], _mm256_srli_epi64(m, 32)),
+                _mm256_mul_epu32(_mm256_srli_epi64(vInv[u], 32), m));
+        vInv[u] = _mm256_add_epi64(ll, _mm256_slli_epi64(mid, 32));
+      } // end for (k)
+    } // end for (u)
+
+    if (base == 2) {
+      // x = 2^d: square, and double where the bit of d is set
+      for (u = 0; u < 4; u++) {
+        x[u] = vone[u];
+        passed[u] = _mm256_setzero_si256();
+      } // end for
+      for (i = top - 1; i >= 0; i--) {
+        for (u = 0; u < 4; u++) {
+          x[u] = montMulAvx2(x[u], x[u], vn[u], vInv[u]);
+          bit = _mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(
+                  _mm256_srli_epi64(vd[u], i), _mm256_set1_epi64x(1)));
+          x[u] = _mm256_blendv_epi8(x[u], addModAvx2(x[u], x[u], vn[u]), bit);
+        } // end for (u)
+      } // end for (i)
+    } else {
+      // base * R mod n and its powers up to base^15; a lane whose n divides
+      //  the base passes outright
+      for (u = 0; u < 4; u++) {
+        va[u] = _mm256_setzero_si256();
+        for (k = 63 - __builtin_clzll(base); k >= 0; k--) {
+          va[u] = addModAvx2(va[u], va[u], vn[u]);
+          if ((base >> k) & 1) {
+            va[u] = addModAvx2(va[u], vone[u], vn[u]);
+          } // end if
+        } // end for (k)
+        passed[u] = _mm256_cmpeq_epi64(va[u], _mm256_setzero_si256());
+        _mm256_storeu_si256((__m256i *) table[u][0], vone[u]);
+        _mm256_storeu_si256((__m256i *) table[u][1], va[u]);
+        x[u] = va[u];
+      } // end for (u)
+      for (k = 2; k < 16; k++) {
+        for (u = 0; u < 4; u++) {
+          x[u] = montMulAvx2(x[u], va[u], vn[u], vInv[u]);
+          _mm256_storeu_si256((__m256i *) table[u][k], x[u]);
+        } // end for (u)
+      } // end for (k)
+
+      // x = base^d four bits at a time, the top digit straight from the table
+      i = ((top + 3) / 4 - 1) * 4;
+      for (u = 0; u < 4; u++) {
+        digit = _mm256_and_si256(_mm256_srli_epi64(vd[u], i), _mm256_set1_epi64x(15));
+        x[u] = _mm256_i64gather_epi64((const long long *) table[u],
+                                      _mm256_add_epi64(_mm256_slli_epi64(digit, 2), lane), 8);
+      } // end for (u)
+      for (i -= 4; i >= 0; i -= 4) {
+        for (k = 0; k < 4; k++) {
+          for (u = 0; u < 4; u++) {
+            x[u] = montMulAvx2(x[u], x[u], vn[u], vInv[u]);
+          } // end for (u)
+        } // end for (k)
+        for (u = 0; u < 4; u++) {
+          digit = _mm256_and_si256(_mm256_srli_epi64(vd[u], i), _mm256_set1_epi64x(15));
+          x[u] = montMulAvx2(x[u], _mm256_i64gather_epi64((const long long *) table[u],
+                                 _mm256_add_epi64(_mm256_slli_epi64(digit, 2), lane), 8),
+                             vn[u], vInv[u]);
+        } // end for (u)
+      } // end for (i)
+    } // end if
+
+    // base^d = 1 or -1, or -1 after r < s squarings
+    for (u = 0; u < 4; u++) {
+      passed[u] = _mm256_or_si256(passed[u], _mm256_or_si256(
+                    _mm256_cmpeq_epi64(x[u], vone[u]),
+                    _mm256_cmpeq_epi64(x[u], vm1[u])));
+    } // end for
+    for (i = 1; i < maxS; i++) {
+      for (u = 0; u < 4; u++) {
+        x[u] = montMulAvx2(x[u], x[u], vn[u], vInv[u]);
+        passed[u] = _mm256_or_si256(passed[u], _mm256_and_si256(
+                      _mm256_cmpgt_epi64(vs[u], _mm256_set1_epi64x(i)),
+                      _mm256_cmpeq_epi64(x[u], vm1[u])));
+      } // end for (u)
+    } // end for (i)
+
+    for (u = 0; u < 4; u++) {
+      _mm256_storeu_si256((__m256i *) (out + 4*u), passed[u]);
+    } // end for
+    for (j = 0; j < 16; j++) {
+      pass[b+j] = out[j] != 0;
+    } // end for
+  } // end for (b)
+
+} // end strongBatchAvx2
+
+// global variables
+void (*strongBatch)(const uint64_t *, const uint64_t *, uint64_t, bool *,
+                    long unsigned int) = NULL;
+
+/******************************************************************************
+* Function strongBatchScalar runs millerRabin64 number by number              *
+******************************************************************************/
+void strongBatchScalar(const uint64_t *n, const uint64_t *one, uint64_t base,
+                       bool *pass, long unsigned int count) {
+
+  long unsigned int i;
+  uint64_t nInv, r1, r2;
+
+  for (i = 0; i < count; i++) {
+    montgomery64(n[i], &nInv, &r1, &r2);
+    pass[i] = millerRabin64(n[i], base, nInv, one[i], r2);
+  } // end for
+
+} // end strongBatchScalar
+
+/******************************************************************************
+* Function batchKernelName resolves the kernel on first use                   *
+******************************************************************************/
+const char *batchKernelName(void) {
+
+  if (strongBatch == NULL) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512dq")) {
+      strongBatch = strongBatchAvx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+      strongBatch = strongBatchAvx2;
+    } else {
+      strongBatch = strongBatchScalar;
+    } // end if
+  } // end if
+
+  if (strongBatch == strongBatchAvx512) {
+    return "avx512";
+  } // end if
+  return (strongBatch == strongBatchAvx2) ? "avx2" : "scalar";
+
+} // end batchKernelName
+
+/******************************************************************************
+* Function isPrimeBatch classifies a block of numbers                         *
+******************************************************************************/
+void isPrimeBatch(const long unsigned int *n, long unsigned int count,
+                  bool *result) {
+
+  long unsigned int i, j, candidates, *index;
+  uint64_t *cn, *cone;
+  bool *pass;
+  int divisor, k;
+
+  batchKernelName();
+  index = (long unsigned int *) malloc(sizeof(long unsigned int)*
+                                       (count + BATCH_LANES));
+  cn = (uint64_t *) malloc(sizeof(uint64_t)*(count + BATCH_LANES));
+  cone = (uint64_t *) malloc(sizeof(uint64_t)*(count + BATCH_LANES));
+  pass = (bool *) malloc(sizeof(bool)*(count + BATCH_LANES));
+
+  // screen out small numbers and small factors, as isPrime does
+  candidates = 0;
+  for (i = 0; i < count; i++) {
+    result[i] = false;
+    if (n[i] < 2) {
+      continue;
+    } // end if
+    divisor = smallPrimeDivisor(n[i]);
+    if (divisor != 0 || n[i] < 53 * 53) {
+      result[i] = (divisor == 0) || (long unsigned int) divisor == n[i];
+      continue;
+    } // end if
+    index[candidates] = i;
+    cn[candidates] = n[i];
+    cone[candidates] = (0 - n[i]) % n[i];
+    candidates++;
+  } // end for
+
+  // each base in turn over the numbers that passed every base before it
+  for (k = 0; k < 7 && candidates > 0; k++) {
+
+    // pad to whole vectors with a harmless odd modulus
+    for (j = candidates; j % BATCH_LANES; j++) {
+      cn[j] = 2809;
+      cone[j] = (0 - 2809ULL) % 2809;
+    } // end for
+    strongBatch(cn, cone, millerRabinBases[k], pass,
+                strongBatch == strongBatchScalar ? candidates : j);
+
+    // keep the strong probable primes, in order
+    for (i = 0, j = 0; i < candidates; i++) {
+      if (pass[i]) {
+        index[j] = index[i];
+        cn[j] = cn[i];
+        cone[j] = cone[i];
+        j++;
+      } // end if
+    } // end for (i)
+    candidates = j;
+  } // end for (k)
+
+  for (i = 0; i < candidates; i++) {
+    result[index[i]] = true;
+  } // end for
+
+  free(pass);
+  free(cone);
+  free(cn);
+  free(index);
+
+} // end isPrimeBatch
+
+#endif
@@ -0,0 +1,293 @@
+/* Some fun with prime numbers. Program benchmarks the sieves, pi(x), isPrime
+    and the natural decomposition over a ladder of sizes 10^6 .. 10^max and
+    thread counts, checks every count against known values of pi(x), and
+    writes the timings as JSON.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primeBench primeBench.c -pthread -lm
+   Run by:     ./primeBench [-t max threads] [NAT max exponent] [JSON file]
+*/
+
+#include "primeCounting.c"
+#include "primality.c"
+#include "timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+// one benchmark run, measured in a child process so peak RSS is its own
+typedef struct {
+  double seconds;
+  long unsigned int n;                 // 10^exponent
+  long unsigned int numbers;           // numbers covered
+  long unsigned int count;             // primes found
+  long unsigned int expected;
+  long peakKilobytes;
+  int threads;
+  int benchmark;
+  int exponent;
+} benchResult;
+
+long unsigned int benchPrimeList(long unsigned int n, int threaded);
+long unsigned int benchDecomposition(long unsigned int n);
+long unsigned int benchIsPrime(long unsigned int n, long unsigned int *numbers);
+int runBenchmark(int benchmark, int exponent, int threads, benchResult *result);
+void writeReport(FILE *out, benchResult *results, int numResults);
+
+#define MIN_EXPONENT 6
+#define MAX_EXPONENT 13
+#define DEFAULT_EXPONENT 9
+#define DEFAULT_REPORT "bench.json"
+#define ISPRIME_WINDOW 1048576          // numbers tested above each 10^k
+#define MAX_RESULTS 1024
+
+enum {
+  BENCH_SIEVE, BENCH_PTH_SIEVE, BENCH_COUNT_SIEVE, BENCH_PRIME_COUNT,
+  BENCH_ISPRIME, BENCH_DECOMPOSITION, NUM_BENCHMARKS
+};
+
+// name, largest exponent worth running (by memory or time), threaded
+const char *benchNames[NUM_BENCHMARKS] = {
+  "eratosthenesPrime", "pth_eratosthenesPrime", "primeCountSieve",
+  "primeCountLMO", "isPrime", "eratosthenesFull"
+};
+const int benchMaxExponent[NUM_BENCHMARKS] = {9, 9, 10, 13, 13, 8};
+const int benchThreaded[NUM_BENCHMARKS] = {0, 1, 0, 0, 0, 0};
+
+// pi(10^k), k = 0 .. 13
+const long unsigned int knownPi[MAX_EXPONENT + 1] = {
+  0UL, 4UL, 25UL, 168UL, 1229UL, 9592UL, 78498UL, 664579UL, 5761455UL,
+  50847534UL, 455052511UL, 4118054813UL, 37607912018UL, 346065536839UL
+};
+
+int main(int argc, char * argv[]) {
+
+  benchResult *results;
+  int maxExponent = DEFAULT_EXPONENT, maxThreads, b, e, t, numResults = 0, failed = 0;
+  const char *reportPath = DEFAULT_REPORT;
+  FILE *out;
+
+  if (parseThreadFlag(&argc, argv) != 0 || argc > 3
+      || (argc >= 2 && ((maxExponent = atoi(argv[1])) < MIN_EXPONENT || maxExponent > MAX_EXPONENT))) {
+    printf("Usage: %s [-t max threads] <optionally followed by [NAT max exponent %d..%d] [JSON file]>\n",
+           argv[0], MIN_EXPONENT, MAX_EXPONENT);
+    exit(-1);
+  }
+  if (argc == 3) {
+    reportPath = argv[2];
+  }
+  maxThreads = sieveThreadCount();
+  results = (benchResult *) malloc(sizeof(benchResult)*MAX_RESULTS);
+
+  printf("%-22s %8s %7s %10s %14s %14s %10s %s\n", "benchmark", "n", "threads",
+         "seconds", "numbers/s", "primes/s", "peak RSS", "check");
+  for (b = 0; b < NUM_BENCHMARKS; b++) {
+    for (e = MIN_EXPONENT; e <= maxExponent && e <= benchMaxExponent[b]; e++) {
+
+      // threaded benchmarks climb 1, 2, 4, ... up to the thread limit
+      for (t = 1; t <= maxThreads; t = (t * 2 > maxThreads && t < maxThreads) ? maxThreads : t * 2) {
+        if (numResults == MAX_RESULTS || runBenchmark(b, e, t, &results[numResults]) != 0) {
+          printf("%-22s 1e%-6d %7d failed to run\n", benchNames[b], e, t);
+          failed++;
+          break;
+        }
+        printf("%-22s 1e%-6d %7d %10.4f %14.4g %14.4g %8ldMB %s\n", benchNames[b], e, t,
+               results[numResults].seconds,
+               results[numResults].numbers / results[numResults].seconds,
+               results[numResults].count / results[numResults].seconds,
+               results[numResults].peakKilobytes / 1024,
+               results[numResults].count == results[numResults].expected ? "ok" : "MISMATCH");
+        fflush(stdout);
+        if (results[numResults].count != results[numResults].expected) {
+          failed++;
+        }
+        numResults++;
+        if (!benchThreaded[b]) {
+          break;
+        }
+      } // end for (t)
+    } // end for (e)
+  } // end for (b)
+
+  if ((out = fopen(reportPath, "w")) == NULL) {
+    printf("Error writing %s\n", reportPath);
+    exit(1);
+  }
+  writeReport(out, results, numResults);
+  fclose(out);
+  printf("\n%d runs, %d failed; report written to %s\n\n", numResults, failed, reportPath);
+  free(results);
+
+  return failed ? 1 : 0;
+
+}
+
+/******************************************************************************
+* Function runBenchmark forks a child to run one benchmark, so its peak RSS   *
+*  and any crash are its own. The child reports back through a pipe. Returns  *
+*  0, or -1 if the child did not report.                                      *
+******************************************************************************/
+int runBenchmark(int benchmark, int exponent, int threads, benchResult *result) {
+
+  int fds[2], status;
+  long unsigned int n = 1, i;
+  double start, finish;
+  struct rusage usage;
+  pid_t child;
+
+  for (i = 0; i < (long unsigned int) exponent; i++) {
+    n *= 10;
+  } // end for
+  memset(result, 0, sizeof(benchResult));
+  result->benchmark = benchmark;
+  result->exponent = exponent;
+  result->threads = threads;
+  result->n = n;
+  result->numbers = n;
+  result->expected = knownPi[exponent];
+
+  if (pipe(fds) != 0) {
+    return -1;
+  } // end if
+  fflush(stdout);
+  if ((child = fork()) == 0) {
+    close(fds[0]);
+    numberOfThreads = threads;
+    GET_TIME(start);
+    switch (benchmark) {
+      case BENCH_SIEVE:
+      case BENCH_PTH_SIEVE:
+        result->count = benchPrimeList(n, benchmark == BENCH_PTH_SIEVE);
+        break;
+      case BENCH_COUNT_SIEVE:
+        result->count = primeCountSieve(n);
+        break;
+      case BENCH_PRIME_COUNT:
+        // LMO itself: primeCount answers most of the ladder from checkpoints
+        result->count = primeCountLMO(n);
+        break;
+      case BENCH_ISPRIME:
+        result->count = benchIsPrime(n, &result->numbers);
+        break;
+      case BENCH_DECOMPOSITION:
+        result->count = benchDecomposition(n);
+        break;
+    } // end switch
+    GET_TIME(finish);
+    result->seconds = finish - start;
+
+    // isPrime is checked against pi(x) on both sides of its window
+    if (benchmark == BENCH_ISPRIME) {
+      result->expected = primeCount(n + ISPRIME_WINDOW - 1) - knownPi[exponent];
+    } // end if
+    if (write(fds[1], result, sizeof(benchResult)) != sizeof(benchResult)) {
+      _exit(1);
+    } // end if
+    _exit(0);
+  } // end if
+
+  close(fds[1]);
+  if (child < 0 || read(fds[0], result, sizeof(benchResult)) != sizeof(benchResult)) {
+    close(fds[0]);
+    if (child > 0) {
+      wait4(child, &status, 0, &usage);
+    } // end if
+    return -1;
+  } // end if
+  close(fds[0]);
+  wait4(child, &status, 0, &usage);
+  result->peakKilobytes = usage.ru_maxrss;
+
+  return 0;
+
+} // end runBenchmark
+
+/******************************************************************************
+* Function benchPrimeList lists the primes to n (the list opens with 1)       *
+******************************************************************************/
+long unsigned int benchPrimeList(long unsigned int n, int threaded) {
+
+  long unsigned int *primes, size;
+
+  primes = threaded ? pth_eratosthenesPrime(n, &size) : eratosthenesPrime(n, &size);
+  free(primes);
+
+  return size - 1;
+
+} // end benchPrimeList
+
+/******************************************************************************
+* Function benchDecomposition counts the naturals that are their own smallest *
+*  prime factor                                                               *
+******************************************************************************/
+long unsigned int benchDecomposition(long unsigned int n) {
+
+  long unsigned int *sieve, i, count = 0;
+
+  sieve = eratosthenesFull(n);
+  for (i = 2; i <= n; i++) {
+    count += (sieve[i-1] == i);
+  } // end for
+  free(sieve);
+
+  return count;
+
+} // end benchDecomposition
+
+/******************************************************************************
+* Function benchIsPrime tests each number of [n, n + ISPRIME_WINDOW)          *
+******************************************************************************/
+long unsigned int benchIsPrime(long unsigned int n, long unsigned int *numbers) {
+
+  long unsigned int i, count = 0;
+
+  for (i = n; i < n + ISPRIME_WINDOW; i++) {
+    count += isPrime(i);
+  } // end for
+  *numbers = ISPRIME_WINDOW;
+
+  return count;
+
+} // end benchIsPrime
+
+/******************************************************************************
+* Function writeReport writes the runs as JSON. Scaling efficiency is the     *
+*  single-thread time over threads times the time, for the same benchmark     *
+*  and size.                                                                  *
+******************************************************************************/
+void writeReport(FILE *out, benchResult *results, int numResults) {
+
+  int i, j;
+  double single, efficiency;
+  char stamp[32];
+  time_t now = time(NULL);
+
+  strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+  fprintf(out, "{\n  \"timestamp\": \"%s\",\n  \"cores\": %ld,\n  \"results\": [\n",
+          stamp, sysconf(_SC_NPROCESSORS_ONLN));
+  for (i = 0; i < numResults; i++) {
+    single = 0;
+    for (j = 0; j < numResults; j++) {
+      if (results[j].benchmark == results[i].benchmark && results[j].exponent == results[i].exponent
+          && results[j].threads == 1) {
+        single = results[j].seconds;
+      } // end if
+    } // end for (j)
+    efficiency = (single > 0) ? single / (results[i].threads * results[i].seconds) : 0;
+    fprintf(out, "    {\"benchmark\": \"%s\", \"n\": %lu, \"threads\": %d, \"seconds\": %.6f, "
+                 "\"numbers_per_second\": %.0f, \"primes_per_second\": %.0f, "
+                 "\"peak_rss_kb\": %ld, \"count\": %lu, \"expected\": %lu, "
+                 "\"verified\": %s, \"scaling_efficiency\": %.3f}%s\n",
+            benchNames[results[i].benchmark], results[i].n,
+            results[i].threads, results[i].seconds,
+            results[i].numbers / results[i].seconds, results[i].count / results[i].seconds,
+            results[i].peakKilobytes, results[i].count, results[i].expected,
+            results[i].count == results[i].expected ? "true" : "false", efficiency,
+            (i + 1 < numResults) ? "," : "");
+  } // end for (i)
+  fprintf(out, "  ]\n}\n");
+
+} // end writeReport
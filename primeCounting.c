@@ -0,0 +1,747 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMECOUNTING_C
+#define PRIMECOUNTING_C
+
+#include "eratosthenes.c"
+#include "intervalSieve.c"
+
+// content summary
+long unsigned int primeCount(long unsigned int x);
+  /* primeCount returns pi(x), the number of primes <= x, for x < 2^63: by a
+      sieve for small x, from a nearby pi checkpoint up to PI_CHECKPOINT_LIMIT,
+      and otherwise by primeCountLMO.
+      */
+long unsigned int primeCountLMO(long unsigned int x);
+  /* primeCountLMO returns pi(x) for x < 2^63 using the Lagarias-Miller-
+      Odlyzko form of Meissel-Lehmer: roughly x^(2/3) time and x^(1/3)
+      memory instead of a sieve up to x. The special leaves and P2 are
+      spread over sieveThreadCount() threads. Below PI_DIRECT_LIMIT it just
+      sieves.
+      */
+long unsigned int primeCountRange(long unsigned int lo, long unsigned int hi);
+  /* primeCountRange returns the number of primes in [lo, hi] by an interval
+      sieve of just that range.
+      */
+long unsigned int nthPrime(long unsigned int n);
+  /* nthPrime returns the n-th prime (the first is 2) for n up to
+      PI_NTH_LIMIT: nthPrimeFrom the anchor nthPrimeAnchor picks.
+      */
+void nthPrimeAnchor(long unsigned int n, long unsigned int *x, long unsigned int *count);
+  /* nthPrimeAnchor sets *x to an exact anchor below p_n (n > 1) and *count
+      to pi(*x) < n: the last piCheckpoints entry with fewer than n primes,
+      or past the table primeCount at an inverse li estimate.
+      */
+long unsigned int nthPrimeFrom(long unsigned int n, long unsigned int x,
+                               long unsigned int count, long unsigned int deadline);
+  /* nthPrimeFrom sieves on from x (x >= 2, pi(x) = count < n) and returns
+      p_n, or 0 if monotonicNanoseconds() passes deadline first (0 for none).
+      */
+double logIntegral(double x);
+  /* logIntegral returns li(x) by Ramanujan's series.
+      */
+long unsigned int primeCountSieve(long unsigned int x);
+  /* primeCountSieve returns pi(x) by counting a segmented sieve up to x. It
+      is the small-x path of primeCount and an independent check of it.
+      */
+long int ordinaryLeaves(void);
+  /* ordinaryLeaves returns S1, the sum of mu(n) phi(x/n, c) over the
+      squarefree n <= y whose prime factors all exceed p_c.
+      */
+void *threadSpecialLeaves(void *rank);
+  /* threadSpecialLeaves claims chunks of [1, x/y] and sieves them segment by
+      segment, adding up the special leaves -mu(m) phi(x/(p m), b) that land
+      in each, relative to the start of its chunk.
+      */
+void *threadP2(void *rank);
+  /* threadP2 claims chunks of [1, x/y] and counts their primes, adding up
+      pi(x/p) - pi(chunk start) for the primes y < p <= sqrt(x) whose x/p
+      falls in each.
+      */
+long unsigned int icbrt(long unsigned int n);
+  /* icbrt returns floor(cbrt(n)) computed exactly.
+      */
+
+// definitions
+#define PI_DIRECT_LIMIT 1000000         // below this just sieve
+#define PI_NTH_LIMIT 216289611853439384UL       // pi(2^63)
+#define PHI_TINY_C 6                    // phi(n, c) by table: 2*3*5*7*11*13
+#define PI_CHUNKS_PER_THREAD 8          // load balancing for both passes
+
+// global variables
+long unsigned int piX;
+long unsigned int piY;
+long unsigned int piA;                  // pi(y)
+long unsigned int piC;
+long unsigned int piLimit;              // x/y + 1, sieve [1, piLimit)
+long unsigned int *piPrimes;            // piPrimes[1..]: 2, 3, 5, ...
+long unsigned int piNumPrimes;          // primes up to sqrt(x)
+uint32_t *piBasePrimes;                 // odd primes up to sqrt(x/y)
+long unsigned int piNumBase;
+uint32_t *piLpf;                        // least prime factor of n <= y
+uint32_t *piPi;                         // pi(n) for n <= y
+signed char *piMu;                      // Moebius function of n <= y
+uint16_t *phiTable;
+long unsigned int phiProduct, phiTotient;
+long unsigned int piSegmentSize;        // numbers per S2 segment (power of 2)
+int piCounterLog;                       // log2 numbers per counter block
+long unsigned int piChunks, piChunkSpan, piNextChunk;
+long int *chunkS2;                      // S2 of each chunk, local phi only
+long int **chunkMuSum;                  // chunk, b: sum of -mu(m) over leaves
+long int **chunkPhi;                    // chunk, b: unsieved count after b
+long unsigned int *chunkPrimeCount;     // P2: primes in chunk
+long unsigned int *chunkTargets;        // P2: x/p values in chunk
+long unsigned int *chunkLocalSum;       // P2: sum of local pi(x/p)
+
+/******************************************************************************
+* Function primeCount picks the cheapest exact way to pi(x)                   *
+******************************************************************************/
+long unsigned int primeCount(long unsigned int x) {
+
+  long unsigned int anchor, reach, count;
+
+  if (x < PI_DIRECT_LIMIT) {
+    return primeCountSieve(x);
+  } // end if
+
+  // within about 2 x^(2/3) of a checkpoint, counting the gap is quicker
+  if (x < PI_CHECKPOINT_LIMIT) {
+    reach = 2 * icbrt(x) * icbrt(x);
+    count = piCheckpoint(x, &anchor);
+    if (x - anchor <= reach) {
+      return count + primeCountRange(anchor + 1, x);
+    } // end if
+    if (anchor + PI_CHECKPOINT_STRIDE - x <= reach) {
+      count = piCheckpoint(anchor + PI_CHECKPOINT_STRIDE, &anchor);
+      return count - primeCountRange(x + 1, anchor);
+    } // end if
+  } // end if
+
+  return primeCountLMO(x);
+
+} // end primeCount
+
+/******************************************************************************
+* Function primeCountLMO: pi(x) = S1 + S2 + a - 1 - P2, y ~ alpha x^(1/3),   *
+*  a = pi(y). S1 and S2 make up phi(x, a); P2 counts the products of two      *
+*  primes above y.                                                            *
+******************************************************************************/
+long unsigned int primeCountLMO(long unsigned int x) {
+
+  long unsigned int sqrtX, i, j, k, numOdd, threads, chunk, b;
+  long unsigned int prefix, p2, *prefixPhi;
+  long int s1, s2, result;
+  uint32_t *oddPrimes;
+  double logX, alpha;
+  int errorCode, scope;
+  long rank;
+  pthread_t *threadHandles;
+
+  // y would round down to nothing for tiny x
+  if (x < PI_DIRECT_LIMIT) {
+    return primeCountSieve(x);
+  } // end if
+
+  // y: the larger alpha, the fewer S2 segments but the more S1 and leaves
+  logX = log10((double) x);
+  alpha = 1.0 + logX / 10.0;
+  piX = x;
+  piY = (long unsigned int) (alpha * icbrt(x));
+  sqrtX = isqrt(x);
+  if (piY > sqrtX) {
+    piY = sqrtX;
+  } // end if
+  piLimit = x / piY + 1;
+
+  // primes up to sqrt(x), 1-indexed with 2 in front
+  scope = profileBegin("base primes");
+  oddPrimes = sievePrimesUpTo(sqrtX, &numOdd);
+  piPrimes = (long unsigned int *) malloc(sizeof(long unsigned int)*(numOdd + 2));
+  piPrimes[0] = 0;
+  piPrimes[1] = 2;
+  for (i = 0; i < numOdd; i++) {
+    piPrimes[i+2] = oddPrimes[i];
+  } // end for
+  piNumPrimes = numOdd + 1;
+  free(oddPrimes);
+  profileEnd(scope);
+  for (piA = 0; piA < piNumPrimes && piPrimes[piA+1] <= piY; piA++);
+  piC = (piA < PHI_TINY_C) ? piA : PHI_TINY_C;
+
+  // least prime factor and Moebius function up to y
+  scope = profileBegin("sieve init");
+  piLpf = (uint32_t *) calloc(piY + 1, sizeof(uint32_t));
+  piMu = (signed char *) malloc(piY + 1);
+  memset(piMu, 1, piY + 1);
+  for (i = 2; i <= piY; i++) {
+    if (piLpf[i] == 0) {
+      for (j = i; j <= piY; j += i) {
+        if (piLpf[j] == 0) {
+          piLpf[j] = i;
+        } // end if
+        piMu[j] = -piMu[j];
+      } // end for (j)
+      for (j = i * i; j <= piY; j += i * i) {
+        piMu[j] = 0;
+      } // end for (j)
+    } // end if
+  } // end for (i)
+  piLpf[1] = UINT32_MAX;
+  piPi = (uint32_t *) malloc(sizeof(uint32_t)*(piY + 1));
+  piPi[0] = piPi[1] = 0;
+  for (i = 2; i <= piY; i++) {
+    piPi[i] = piPi[i-1] + (piLpf[i] == i);
+  } // end for
+
+  // phi(n, c) = (n / product) * totient + phiTable[n % product]
+  phiProduct = 1;
+  phiTotient = 1;
+  for (i = 1; i <= piC; i++) {
+    phiProduct *= piPrimes[i];
+    phiTotient *= piPrimes[i] - 1;
+  } // end for
+  phiTable = (uint16_t *) malloc(sizeof(uint16_t)*phiProduct);
+  phiTable[0] = 0;
+  for (k = 1; k < phiProduct; k++) {
+    for (i = 1; i <= piC && k % piPrimes[i]; i++);
+    phiTable[k] = phiTable[k-1] + (i > piC);
+  } // end for (k)
+  profileEnd(scope);
+
+  scope = profileBegin("ordinary leaves");
+  s1 = ordinaryLeaves();
+  profileEnd(scope);
+
+  // S2 segments: about sqrt(x/y) numbers, counters of about sqrt of that
+  for (piSegmentSize = 1 << 16; piSegmentSize * piSegmentSize < piLimit;
+       piSegmentSize <<= 1);
+  for (piCounterLog = 6; (1UL << (2 * piCounterLog)) < piSegmentSize;
+       piCounterLog++);
+
+  threads = sieveThreadCount();
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  piChunks = (piLimit + piSegmentSize - 1) / piSegmentSize;
+  if (piChunks > threads * PI_CHUNKS_PER_THREAD) {
+    piChunks = threads * PI_CHUNKS_PER_THREAD;
+  } // end if
+  piChunkSpan = ((piLimit + piChunks - 1) / piChunks + piSegmentSize - 1)
+                / piSegmentSize * piSegmentSize;
+  piChunks = (piLimit + piChunkSpan - 1) / piChunkSpan;
+  chunkS2 = (long int *) calloc(piChunks, sizeof(long int));
+  chunkMuSum = (long int **) malloc(sizeof(long int *)*piChunks);
+  chunkPhi = (long int **) malloc(sizeof(long int *)*piChunks);
+  for (chunk = 0; chunk < piChunks; chunk++) {
+    chunkMuSum[chunk] = (long int *) calloc(piA + 1, sizeof(long int));
+    chunkPhi[chunk] = (long int *) calloc(piA + 1, sizeof(long int));
+  } // end for
+
+  scope = profileBegin("special leaves");
+  piNextChunk = 0;
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadSpecialLeaves, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+    } // end if
+  } // end for
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+    } // end if
+  } // end for
+
+  // each chunk's leaves still need the phi of every chunk before it
+  prefixPhi = (long unsigned int *) calloc(piA + 1, sizeof(long unsigned int));
+  s2 = 0;
+  for (chunk = 0; chunk < piChunks; chunk++) {
+    s2 += chunkS2[chunk];
+    for (b = piC; b < piA; b++) {
+      s2 += chunkMuSum[chunk][b] * (long int) prefixPhi[b];
+      prefixPhi[b] += chunkPhi[chunk][b];
+    } // end for (b)
+    free(chunkMuSum[chunk]);
+    free(chunkPhi[chunk]);
+  } // end for (chunk)
+  free(prefixPhi);
+  free(chunkPhi);
+  free(chunkMuSum);
+  free(chunkS2);
+  profileEnd(scope);
+
+  // P2 over chunks of whole odd sieve segments
+  scope = profileBegin("P2");
+  piBasePrimes = sievePrimesUpTo(isqrt(piLimit), &piNumBase);
+  piChunkSpan = (piLimit / (threads * PI_CHUNKS_PER_THREAD) / SIEVE_SEGMENT_SPAN + 1)
+                * SIEVE_SEGMENT_SPAN;
+  piChunks = (piLimit + piChunkSpan - 1) / piChunkSpan;
+  chunkPrimeCount = (long unsigned int *) calloc(piChunks, sizeof(long unsigned int));
+  chunkTargets = (long unsigned int *) calloc(piChunks, sizeof(long unsigned int));
+  chunkLocalSum = (long unsigned int *) calloc(piChunks, sizeof(long unsigned int));
+  piNextChunk = 0;
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadP2, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+    } // end if
+  } // end for
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+    } // end if
+  } // end for
+
+  // pi(x/p) = primes in earlier chunks (and 2) + local count
+  p2 = 0;
+  prefix = 1;
+  for (chunk = 0; chunk < piChunks; chunk++) {
+    p2 += chunkLocalSum[chunk] + chunkTargets[chunk] * prefix;
+    prefix += chunkPrimeCount[chunk];
+  } // end for
+  for (b = piA + 1; b <= piNumPrimes; b++) {
+    p2 -= b - 1;
+  } // end for
+  free(chunkLocalSum);
+  free(chunkTargets);
+  free(chunkPrimeCount);
+  profileEnd(scope);
+
+  result = s1 + s2 + (long int) piA - 1 - (long int) p2;
+
+  free(threadHandles);
+  free(phiTable);
+  free(piPi);
+  free(piMu);
+  free(piLpf);
+  free(piBasePrimes);
+  free(piPrimes);
+
+  return (long unsigned int) result;
+
+} // end primeCountLMO
+
+/******************************************************************************
+* Function ordinaryLeaves: S1 straight from the phi(n, c) table               *
+******************************************************************************/
+long int ordinaryLeaves(void) {
+
+  long unsigned int n, q;
+  long int s1 = 0;
+
+  for (n = 1; n <= piY; n++) {
+    if (piMu[n] != 0 && piLpf[n] > piPrimes[piC]) {
+      q = piX / n;
+      s1 += piMu[n] * (long int) ((q / phiProduct) * phiTotient
+                                  + phiTable[q % phiProduct]);
+    } // end if
+  } // end for
+
+  return s1;
+
+} // end ordinaryLeaves
+
+/******************************************************************************
+* Function threadSpecialLeaves walks a chunk one segment at a time. Bit i of  *
+*  a segment stands for low+i and stays set while low+i has no prime factor   *
+*  among those sieved so far; counters[] holds the set bits per block so a    *
+*  leaf's phi is a counter sum plus one partial block of popcounts. For each  *
+*  b the leaves come in increasing order of x/(p m), so the sums only ever    *
+*  move forward.                                                              *
+******************************************************************************/
+void *threadSpecialLeaves(void *rank) {
+
+  long unsigned int chunk, low, high, chunkEnd, span, words, b, p, m;
+  long unsigned int minM, maxM, rel, block, start, k, w, lastWord;
+  long unsigned int total, before, partial, j;
+  long int s2, *muSum, *phi;
+  uint64_t *bits;
+  uint32_t *counters;
+  int counterLog = piCounterLog;
+
+// add -mu phi(x/(p m), b): counter blocks up to x/(p m), then popcounts
+#define SPECIAL_LEAF(m, mu) { \
+  rel = piX / (p * (m)) - low; \
+  while (((block + 1) << counterLog) <= rel) { \
+    before += counters[block++]; \
+  } \
+  partial = 0; \
+  for (w = (block << counterLog) / 64; w < rel / 64; w++) { \
+    partial += __builtin_popcountll(bits[w]); \
+  } \
+  partial += __builtin_popcountll(bits[rel / 64] & (~0ULL >> (63 - rel % 64))); \
+  s2 -= (mu) * (phi[b] + (long int) (before + partial)); \
+  muSum[b] -= (mu); \
+}
+
+  bits = (uint64_t *) malloc(piSegmentSize / 8);
+  counters = (uint32_t *) malloc(sizeof(uint32_t)*(piSegmentSize >> counterLog));
+  (void) rank;
+
+  while ((chunk = __atomic_fetch_add(&piNextChunk, 1, __ATOMIC_RELAXED)) < piChunks) {
+    s2 = 0;
+    muSum = chunkMuSum[chunk];
+    phi = chunkPhi[chunk];
+    chunkEnd = (chunk + 1) * piChunkSpan + 1;
+    if (chunkEnd > piLimit) {
+      chunkEnd = piLimit;
+    } // end if
+
+    for (low = chunk * piChunkSpan + 1; low < chunkEnd; low += piSegmentSize) {
+      high = (chunkEnd - low < piSegmentSize) ? chunkEnd : low + piSegmentSize;
+      span = high - low;
+      words = (span + 63) / 64;
+      memset(bits, 0xff, sizeof(uint64_t)*words);
+      if (span % 64) {
+        bits[words-1] = (1ULL << (span % 64)) - 1;
+      } // end if
+
+      // sieve out the first c primes
+      for (b = 1; b <= piC; b++) {
+        p = piPrimes[b];
+        for (k = (low + p - 1) / p * p - low; k < span; k += p) {
+          bits[k >> 6] &= ~(1ULL << (k & 63));
+        } // end for (k)
+      } // end for (b)
+      total = 0;
+      for (block = 0; (block << counterLog) < span; block++) {
+        lastWord = (((block + 1) << counterLog) < span)
+                   ? ((block + 1) << counterLog) / 64 : words;
+        counters[block] = 0;
+        for (w = (block << counterLog) / 64; w < lastWord; w++) {
+          counters[block] += __builtin_popcountll(bits[w]);
+        } // end for (w)
+        total += counters[block];
+      } // end for (block)
+
+      for (b = piC; b < piA; b++) {
+        p = piPrimes[b+1];
+
+        // leaves p*m with y/p < m <= y, lpf(m) > p and x/(p m) in segment
+        minM = piX / (p * high);
+        if (minM < piY / p) {
+          minM = piY / p;
+        } // end if
+        maxM = piX / (p * low);
+        if (maxM > piY) {
+          maxM = piY;
+        } // end if
+        block = 0;
+        before = 0;
+        if (p < maxM && p * p <= piY) {
+          for (m = maxM; m > minM; m--) {
+            if (piMu[m] != 0 && piLpf[m] > p) {
+              SPECIAL_LEAF(m, piMu[m]);
+            } // end if
+          } // end for (m)
+        } else if (p < maxM) {
+          // p > sqrt(y): lpf(m) > p and m <= y leave only primes m > p
+          for (j = piPi[maxM]; j > b + 1 && piPrimes[j] > minM; j--) {
+            SPECIAL_LEAF(piPrimes[j], -1);
+          } // end for (j)
+        } // end if
+        phi[b] += total;
+
+        // cross off the odd multiples of p
+        start = (low + p - 1) / p * p;
+        if (start % 2 == 0) {
+          start += p;
+        } // end if
+        for (k = start - low; k < span; k += 2 * p) {
+          if (bits[k >> 6] & (1ULL << (k & 63))) {
+            bits[k >> 6] &= ~(1ULL << (k & 63));
+            counters[k >> counterLog]--;
+            total--;
+          } // end if
+        } // end for (k)
+      } // end for (b)
+    } // end for (low)
+
+    chunkS2[chunk] = s2;
+  } // end while
+
+  free(counters);
+  free(bits);
+
+#undef SPECIAL_LEAF
+
+  return NULL;
+
+} // end threadSpecialLeaves
+
+/******************************************************************************
+* Function threadP2 sieves its chunks with the odd-only segment sieve. The    *
+*  targets x/p of a chunk come from a contiguous run of p (descending p,      *
+*  ascending x/p), so one pass of popcounts answers them all.                 *
+******************************************************************************/
+void *threadP2(void *rank) {
+
+  long unsigned int chunk, low, high, chunkLow, chunkHigh, words, w, b, bLow;
+  long unsigned int count, target, rel, targets, localSum, pos;
+  uint64_t *bits;
+
+  (void) rank;
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+
+  while ((chunk = __atomic_fetch_add(&piNextChunk, 1, __ATOMIC_RELAXED)) < piChunks) {
+    chunkLow = 1 + chunk * piChunkSpan;
+    chunkHigh = chunkLow + piChunkSpan - 1;
+    if (chunkHigh > piLimit - 1) {
+      chunkHigh = piLimit - 1;
+    } // end if
+
+    // smallest index b with x/p_b <= chunkHigh, but p_b > y
+    for (bLow = piNumPrimes; bLow > piA && piX / piPrimes[bLow] < chunkLow; bLow--);
+
+    count = 0;
+    targets = 0;
+    localSum = 0;
+    b = bLow;
+    for (low = chunkLow; low <= chunkHigh; low += SIEVE_SEGMENT_SPAN) {
+      high = (chunkHigh - low < SIEVE_SEGMENT_SPAN) ? chunkHigh
+                                                     : low + SIEVE_SEGMENT_SPAN - 1;
+      sieveSegment(bits, low, high, piBasePrimes, piNumBase);
+      words = ((high - low) / 2 + 64) / 64;
+
+      // answer the targets in this segment, counting forward as we go
+      pos = 0;
+      for (; b > piA && piX / piPrimes[b] <= high; b--) {
+        target = piX / piPrimes[b];
+        rel = (target - low) / 2;
+        for (; pos < rel / 64; pos++) {
+          count += __builtin_popcountll(bits[pos]);
+        } // end for
+        localSum += count + __builtin_popcountll(bits[pos] & (~0ULL >> (63 - rel % 64)));
+        targets++;
+      } // end for (b)
+      for (w = pos; w < words; w++) {
+        count += __builtin_popcountll(bits[w]);
+      } // end for (w)
+    } // end for (low)
+
+    chunkPrimeCount[chunk] = count;
+    chunkTargets[chunk] = targets;
+    chunkLocalSum[chunk] = localSum;
+  } // end while
+
+  free(bits);
+
+  return NULL;
+
+} // end threadP2
+
+/******************************************************************************
+* Function primeCountRange                                                    *
+******************************************************************************/
+long unsigned int primeCountRange(long unsigned int lo, long unsigned int hi) {
+
+  intervalSieve s;
+  long unsigned int count, w;
+
+  count = (lo <= 2 && hi >= 2) ? 1 : 0;
+  intervalSieveInit(&s, lo, hi);
+  while (intervalSieveNext(&s)) {
+    for (w = 0; w < SIEVE_SEGMENT_WORDS; w++) {
+      count += __builtin_popcountll(s.bits[w]);
+    } // end for
+  } // end while
+  intervalSieveFree(&s);
+
+  return count;
+
+} // end primeCountRange
+
+/******************************************************************************
+* Function nthPrime                                                           *
+******************************************************************************/
+long unsigned int nthPrime(long unsigned int n) {
+
+  long unsigned int x, count;
+
+  if (n == 0) {
+    return 0;
+  } // end if
+  if (n <= SMALL_TABLE_PRIMES) {
+    return smallPrimeTable[n-1];
+  } // end if
+  nthPrimeAnchor(n, &x, &count);
+
+  return nthPrimeFrom(n, x, count, 0);
+
+} // end nthPrime
+
+/******************************************************************************
+* Function nthPrimeAnchor                                                     *
+******************************************************************************/
+void nthPrimeAnchor(long unsigned int n, long unsigned int *x, long unsigned int *count) {
+
+  long unsigned int low, high, mid;
+  double estimate;
+  int scope, i;
+
+  scope = profileBegin("anchor");
+  if (n <= piCheckpoints[PI_CHECKPOINTS-1]) {
+    // last checkpoint with fewer than n primes
+    low = 0;
+    high = PI_CHECKPOINTS - 1;
+    while (high - low > 1) {
+      mid = (low + high) / 2;
+      if (piCheckpoints[mid] < n) {
+        low = mid;
+      } else {
+        high = mid;
+      } // end if
+    } // end while
+    *x = low * PI_CHECKPOINT_STRIDE;
+    *count = piCheckpoints[low];
+  } else {
+    // li^-1(n) by Newton's method; pi(x) < li(x) well past 2^63, so the
+    //  count comes out short of n but only by about sqrt(x) / ln x
+    estimate = (double) n * log((double) n);
+    for (i = 0; i < 8; i++) {
+      estimate -= (logIntegral(estimate) - (double) n) * log(estimate);
+    } // end for
+    *x = (long unsigned int) estimate;
+    *count = primeCount(*x);
+    while (*count >= n) {
+      *x -= (*count - n + 1) * (long unsigned int) log((double) *x) + isqrt(*x);
+      *count = primeCount(*x);
+    } // end while
+  } // end if
+  if (*x < 2) {
+    *x = 2;
+    *count = 1;
+  } // end if
+  profileEnd(scope);
+
+} // end nthPrimeAnchor
+
+/******************************************************************************
+* Function nthPrimeFrom sieves an interval a little past the expected p_n at  *
+*  a time until the (n - count)-th prime after x turns up                     *
+******************************************************************************/
+long unsigned int nthPrimeFrom(long unsigned int n, long unsigned int x,
+                               long unsigned int count, long unsigned int deadline) {
+
+  intervalSieve s;
+  long unsigned int hi, w, bits;
+  uint64_t word;
+  int scope;
+
+  scope = profileBegin("counting");
+  while (1) {
+    hi = x + (long unsigned int) (1.5 * (double) (n - count) * log((double) x)) + SIEVE_SEGMENT_SPAN;
+    intervalSieveInit(&s, x + 1, hi);
+    while (intervalSieveNext(&s)) {
+      if (deadline && monotonicNanoseconds() > deadline) {
+        intervalSieveFree(&s);
+        profileEnd(scope);
+        return 0;
+      } // end if
+      for (w = 0; w < SIEVE_SEGMENT_WORDS; w++) {
+        bits = __builtin_popcountll(s.bits[w]);
+        if (count + bits < n) {
+          count += bits;
+          continue;
+        } // end if
+        for (word = s.bits[w]; count + 1 < n; word &= word - 1) {
+          count++;
+        } // end for
+        x = s.low + 2 * (w * 64 + __builtin_ctzll(word));
+        intervalSieveFree(&s);
+        profileEnd(scope);
+        return x;
+      } // end for (w)
+    } // end while
+    intervalSieveFree(&s);
+    x = hi;
+  } // end while
+
+} // end nthPrimeFrom
+
+/******************************************************************************
+* Function logIntegral sums gamma + ln ln x + sqrt(x) sum_n (-1)^(n-1)        *
+*  (ln x)^n / (n! 2^(n-1)) sum_(k < n/2) 1/(2k+1) until the terms vanish      *
+******************************************************************************/
+double logIntegral(double x) {
+
+  double logX, term, inner, sum;
+  int n, k = 0;
+
+  logX = log(x);
+  term = logX;
+  inner = 0.0;
+  sum = 0.0;
+  for (n = 1; n < 200; n++) {
+    if (n > 1) {
+      term *= -logX / (2.0 * n);
+    } // end if
+    if (n % 2 == 1) {
+      inner += 1.0 / (2 * k + 1);
+      k++;
+    } // end if
+    sum += term * inner;
+    if (fabs(term * inner) < 1e-17 * fabs(sum)) {
+      break;
+    } // end if
+  } // end for
+
+  return 0.5772156649015329 + log(logX) + sqrt(x) * sum;
+
+} // end logIntegral
+
+/******************************************************************************
+* Function primeCountSieve counts the set bits of each odd sieve segment      *
+******************************************************************************/
+long unsigned int primeCountSieve(long unsigned int x) {
+
+  long unsigned int count, low, high, words, w, numBase;
+  uint32_t *basePrimes;
+  uint64_t *bits;
+  int scope;
+
+  if (x < 2) {
+    return 0;
+  } // end if
+  scope = profileBegin("base primes");
+  basePrimes = sievePrimesUpTo(isqrt(x), &numBase);
+  profileEnd(scope);
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+  count = 1;
+  for (low = 1; low <= x && low != 0; low += SIEVE_SEGMENT_SPAN) {
+    high = (x - low < SIEVE_SEGMENT_SPAN) ? x : low + SIEVE_SEGMENT_SPAN - 1;
+    scope = profileBegin("segment marking");
+    sieveSegment(bits, low, high, basePrimes, numBase);
+    profileEnd(scope);
+    scope = profileBegin("extraction");
+    words = ((high - low) / 2 + 64) / 64;
+    for (w = 0; w < words; w++) {
+      count += __builtin_popcountll(bits[w]);
+    } // end for
+    profileEnd(scope);
+  } // end for
+  free(bits);
+  free(basePrimes);
+
+  return count;
+
+} // end primeCountSieve
+
+/******************************************************************************
+* Function icbrt corrects the floating point cube root by at most a step      *
+******************************************************************************/
+long unsigned int icbrt(long unsigned int n) {
+
+  long unsigned int r;
+
+  r = (long unsigned int) cbrt((double) n);
+  while (r > 0 && r * r * r > n) {
+    r--;
+  } // end while
+  while ((r + 1) * (r + 1) * (r + 1) <= n) {
+    r++;
+  } // end while
+
+  return r;
+
+} // end icbrt
+
+#endif
@@ -1,115 +1,87 @@
-/* Some fun with prime numbers
+/* Some fun with prime numbers. Program studies the gaps between the primes
+    up to n in one pass of the segmented sieve: average and maximal gaps,
+    the gap histogram, and runs of k equal consecutive gaps (bi-series for
+    k = 2, tri-series for k = 3).
    Author:     Vincent T. Mossman
-   Compile by: gcc -o primeDifference primeDifference.c
-   Run by:     ./prime
+   Compile by: gcc -O2 -o primeDifference primeDifference.c -pthread -lm
+   Run by:     ./primeDifference [-t threads] [--profile[=json]] [NAT to count to] [NAT run length]
 */
 
-#include "primality.c"
+#include "gapAnalysis.c"
+#include "timer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include <limits.h>
+
+int compareSeriesFirst(const void *a, const void *b);
+
+const gapStats *stats;
 
 int main(int argc, char * argv[]) {
 
-  if (argc != 2) {
-    printf("Usage: %s <followed by [NAT to count to]>\n", argv[0]);
+  long unsigned int n, k = 2, b, total = 0, order[GAP_BUCKETS], numOrder = 0;
+  double start, finish;
+
+  if (parseThreadFlag(&argc, argv) != 0 || profileInit(&argc, argv) != 0 || argc < 2 || argc > 3
+      || (n = strtoul(argv[1], NULL, 10)) < 2 || n > ULONG_MAX - (1UL << 32)
+      || (argc == 3 && (k = strtoul(argv[2], NULL, 10)) < 2)) {
+    printf("Usage: %s [-t threads] [--profile[=json]] <followed by [NAT to count to] optionally followed by [NAT run length >= 2]>\n", argv[0]);
     exit(-1);
   }
 
-  int COUNT_TO, i, max = 0;
-  sscanf(argv[1], "%d", &COUNT_TO);
-  int track[3] = {1, 0, 0}; //Previous Prime Position, Total Distance, Total Primes
- 
-  //triSeries vars
-  int triSeries[2] = {0, 0};
-  int luciferCounter = 0, othersCounter = 0, j, lastUnique = 1;
-  int findUnique[120]; //max difference under 1 mil is 114
-
-  for (i = 0; j < 120; i++) {
-    findUnique[i] = 0;
+  GET_TIME(start);
+  stats = analyzeGaps(n, k);
+  GET_TIME(finish);
+
+  printf("\n%lu primes up to %lu, the largest %lu\n", stats->count, n, stats->last);
+  printf("Average difference between primes: %0.3lf\n", averageGap(stats));
+  printf("Max difference between primes: %lu (after %lu)\n\n",
+         stats->numRecords ? stats->records[stats->numRecords-1].gap : 0,
+         stats->numRecords ? stats->records[stats->numRecords-1].prime : 0);
+
+  printf("Maximal gaps:\n");
+  for (b = 0; b < stats->numRecords; b++) {
+    printf("  %lu after %lu\n", stats->records[b].gap, stats->records[b].prime);
   }
 
-  printf("\n");
-  clock_t begin = clock();
-	
-  for (i = 1; i <= COUNT_TO; i++) {
-    if (isPrime(i)){
-      track[1] = track[1] + (i - track[0]);
-      if (i - track[0] > max) {
-	max = i - track[0];
-      }
-
-      /*
-      //triSeries test
-      if (triSeries[1] == i - track[0]) {
-	if (findUnique[lastUnique - 1] < i - track[0]) {
-	  printf("{%d %d %d} \n", i - track[0], i - track[0], i - track[0]);
-	  findUnique[lastUnique] = i - track[0];
-	  lastUnique++;
-	}
-	      
-	if (i - track[0] == 6) {
-	  luciferCounter++;
-	}
-	else {
-	  othersCounter++;
-	}
-	triSeries[0] = 0;
-	triSeries[1] = 0;
-        }
-        else if (triSeries[0] == i - track[0]) {
-	  triSeries[1] = i - track[0];
-	}
-	else {
-	  triSeries[0] = i - track[0];
-	} //end triSeries test
-      */
-      
-      //biSeries test
-      if (triSeries[0] == i - track[0]) {
-
-	int k, previouslyFound = 0;
-	for (k = 0; k < lastUnique; k++) {
-	  if (findUnique[k] == i - track[0]) {
-	    previouslyFound = 1;
-	    break;
-	  }
-	}
-
-        if (previouslyFound == 0) {
-          printf("{%d %d} \n", i - track[0], i - track[0]);
-          findUnique[lastUnique] = i - track[0];
-          lastUnique++;
-        }
-
-	othersCounter++;
-
-        triSeries[0] = 0;
-        triSeries[1] = 0;
-      }
-      else {
-	triSeries[0] = i - track[0];
-      }
-
-      track[0] = i;
-      track[2]++;
+  printf("\nGap histogram:\n");
+  for (b = 0; b < GAP_BUCKETS; b++) {
+    if (stats->histogram[b]) {
+      printf("  %s%4lu %lu\n", (b == GAP_BUCKETS - 1) ? ">=" : "  ", b ? 2 * b : 1, stats->histogram[b]);
     }
   }
 
-  clock_t end = clock();
-  double time_spent = (double) (end - begin) / CLOCKS_PER_SEC;
- 
-  printf("\nCPU execution time: %0.3lfs\n", time_spent);
-  printf("Average difference between primes: %0.3lf\n", (double) track[1] / (double) track[2]);
-  printf("Max difference between primes: %d\n\n", max);
-
-  /*  
-  //triSeries results
-  printf("Lucifer Prime Series: %d\n", luciferCounter);
-  printf("All other tri-series: %d\n\n", othersCounter);
-  */
-
-  //biSeries results
-  printf("All bi-series: %d\n\n", othersCounter);
+  // series by gap, in order of first appearance
+  for (b = 0; b < GAP_BUCKETS; b++) {
+    if (stats->series[b]) {
+      order[numOrder++] = b;
+      total += stats->series[b];
+    }
+  }
+  qsort(order, numOrder, sizeof(long unsigned int), compareSeriesFirst);
+  printf("\nRuns of %lu equal gaps:\n", k);
+  for (b = 0; b < numOrder; b++) {
+    printf("  {%lu x %lu} %lu times, first after %lu\n", order[b] ? 2 * order[b] : 1, k,
+           stats->series[order[b]], stats->seriesFirst[order[b]]);
+  }
+  printf("All %lu-series: %lu\n", k, total);
+
+  printf("\nCPU execution time: %0.6fs\n\n", finish - start);
+  free((void *) stats);
+
+  return 0;
+
 }
+
+/******************************************************************************
+* Function compareSeriesFirst orders gap buckets by their first series        *
+******************************************************************************/
+int compareSeriesFirst(const void *a, const void *b) {
+
+  long unsigned int x = stats->seriesFirst[*(const long unsigned int *) a];
+  long unsigned int y = stats->seriesFirst[*(const long unsigned int *) b];
+
+  return (x > y) - (x < y);
+
+} // end compareSeriesFirst
@@ -0,0 +1,238 @@
+/* Some fun with prime numbers. Program writes the prime factorization of
+    naturals below 2^64, e.g. 360 = 2^3 * 3^2 * 5
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primeFactor primeFactor.c -pthread -lm
+   Run by:     ./primeFactor [NAT to factor] ...
+               ./primeFactor [-t threads] --batch [file of NATs]
+*/
+
+#include "factorization.c"
+#include "timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+
+int formatFactorization(long unsigned int n, char *out);
+int factorBatchMain(int argc, char * argv[]);
+void *threadFactorSlice(void *rank);
+
+// numbers factored per block in --batch mode
+#define FACTOR_BLOCK 65536
+
+// global variables
+long unsigned int *blockNumbers;
+long unsigned int blockCount;
+long unsigned int blockThreads;
+char *blockText;                     // 400 bytes per number, fits the worst
+int *blockLength;
+
+int main(int argc, char * argv[]) {
+
+  long unsigned int n;
+  char *end, text[400];
+  int arg;
+  double start, finish;
+
+  if (parseThreadFlag(&argc, argv) != 0) {
+    argc = 1;
+  }
+  if (argc >= 2 && strcmp(argv[1], "--batch") == 0) {
+    return factorBatchMain(argc, argv);
+  }
+
+  if (argc < 2) {
+    printf("Usage: %s <followed by [NAT to factor] (below 2^64) ...>\n", argv[0]);
+    printf("       %s [-t threads] --batch <optionally followed by [file of NATs]>\n", argv[0]);
+    exit(-1);
+  }
+
+  GET_TIME(start);
+
+  for (arg = 1; arg < argc; arg++) {
+    errno = 0;
+    n = strtoul(argv[arg], &end, 10);
+    if (*argv[arg] < '0' || *argv[arg] > '9' || *end != '\0' || errno == ERANGE) {
+      printf("%s: not a natural below 2^64\n", argv[arg]);
+      continue;
+    }
+    formatFactorization(n, text);
+    printf("%s", text);
+  }
+
+  GET_TIME(finish);
+
+  printf("\nCPU execution time: %0.6fs\n\n", finish - start);
+
+  return 0;
+
+}
+
+/******************************************************************************
+* Function formatFactorization writes "n = p^e * q * ..." and a newline to    *
+*  out and returns its length. 0 and 1 are written as themselves.             *
+******************************************************************************/
+int formatFactorization(long unsigned int n, char *out) {
+
+  long unsigned int primes[MAX_DISTINCT_FACTORS], v;
+  int exponents[MAX_DISTINCT_FACTORS], count, i, length = 0, d;
+  char digits[24];
+
+// append the decimal digits of v to out
+#define APPEND_DECIMAL(v) { \
+  d = 0; \
+  do { \
+    digits[d++] = '0' + v % 10; \
+    v /= 10; \
+  } while (v); \
+  while (d) { \
+    out[length++] = digits[--d]; \
+  } \
+}
+
+  v = n;
+  APPEND_DECIMAL(v);
+  memcpy(out + length, " = ", 3);
+  length += 3;
+  count = factorize(n, primes, exponents);
+  if (count == 0) {
+    v = n;
+    APPEND_DECIMAL(v);
+  } // end if
+  for (i = 0; i < count; i++) {
+    if (i > 0) {
+      memcpy(out + length, " * ", 3);
+      length += 3;
+    } // end if
+    v = primes[i];
+    APPEND_DECIMAL(v);
+    if (exponents[i] > 1) {
+      out[length++] = '^';
+      v = exponents[i];
+      APPEND_DECIMAL(v);
+    } // end if
+  } // end for
+  out[length++] = '\n';
+  out[length] = '\0';
+
+#undef APPEND_DECIMAL
+
+  return length;
+
+} // end formatFactorization
+
+/******************************************************************************
+* Function factorBatchMain factors every natural read from a file (or stdin), *
+*  one "n = ..." line each. As with prime --batch anything that is not a      *
+*  digit separates numbers. Blocks are split across the threads and written  *
+*  back in input order.                                                       *
+******************************************************************************/
+int factorBatchMain(int argc, char * argv[]) {
+
+  FILE *in = stdin;
+  bool inNumber = false;
+  long unsigned int total = 0, value = 0, i, t;
+  char *readBuffer;
+  size_t got;
+  int c, errorCode;
+  long rank;
+  pthread_t *threadHandles;
+  double start, finish;
+
+  if (argc > 3) {
+    printf("Usage: %s [-t threads] --batch <optionally followed by [file of NATs]>\n", argv[0]);
+    exit(-1);
+  } else if (argc == 3 && (in = fopen(argv[2], "r")) == NULL) {
+    printf("Error opening file!\n");
+    exit(1);
+  } // end if
+
+  blockThreads = sieveThreadCount();
+  blockNumbers = (long unsigned int *) malloc(sizeof(long unsigned int)*FACTOR_BLOCK);
+  blockText = (char *) malloc((size_t) FACTOR_BLOCK * 400);
+  blockLength = (int *) malloc(sizeof(int)*FACTOR_BLOCK);
+  readBuffer = (char *) malloc(1 << 20);
+  threadHandles = (pthread_t *) malloc(blockThreads * sizeof(pthread_t));
+  blockCount = 0;
+
+  GET_TIME(start);
+
+  do {
+    got = fread(readBuffer, 1, 1 << 20, in);
+    for (i = 0; i <= got; i++) {
+      c = (i < got) ? (unsigned char) readBuffer[i] : (got ? -1 : ' ');
+      if (c == -1) {
+        break;                       // number may continue in the next read
+      } // end if
+      if (c >= '0' && c <= '9') {
+        if (value > (ULONG_MAX - (c - '0')) / 10) {
+          fprintf(stderr, "Number too large for --batch (limit 2^64-1)\n");
+          exit(-1);
+        } // end if
+        value = value * 10 + (c - '0');
+        inNumber = true;
+        continue;
+      } // end if
+      if (inNumber) {
+        blockNumbers[blockCount++] = value;
+        value = 0;
+        inNumber = false;
+      } // end if
+
+      // factor and write a full block (or whatever is left at the end)
+      if (blockCount == FACTOR_BLOCK || (got == 0 && blockCount > 0)) {
+        for (rank = 0; rank < (long) blockThreads; rank++) {
+          if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadFactorSlice, (void *) rank)) != 0) {
+            printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
+          }
+        } // end for (rank)
+        for (rank = 0; rank < (long) blockThreads; rank++) {
+          if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+            printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
+          }
+        } // end for (rank)
+        for (t = 0; t < blockCount; t++) {
+          fwrite(blockText + t * 400, 1, blockLength[t], stdout);
+        } // end for (t)
+        total += blockCount;
+        blockCount = 0;
+      } // end if
+    } // end for (i)
+  } while (got > 0);
+
+  GET_TIME(finish);
+
+  fflush(stdout);
+  fprintf(stderr, "Factored %lu numbers in %0.6lfs: %0.0lf numbers/s\n",
+          total, finish - start, total / (finish - start));
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  free(threadHandles);
+  free(readBuffer);
+  free(blockLength);
+  free(blockText);
+  free(blockNumbers);
+
+  return 0;
+
+} // end factorBatchMain
+
+/******************************************************************************
+* Function threadFactorSlice formats this thread's share of the block; the    *
+*  slices are interleaved so one slow rho split does not hold up a thread    *
+*  that happens to own a run of them.                                         *
+******************************************************************************/
+void *threadFactorSlice(void *rank) {
+
+  long unsigned int t;
+
+  for (t = (long unsigned int) rank; t < blockCount; t += blockThreads) {
+    blockLength[t] = formatFactorization(blockNumbers[t], blockText + t * 400);
+  } // end for
+
+  return NULL;
+
+} // end threadFactorSlice
@@ -1,69 +1,278 @@
 /* Some fun with prime numbers
    Author:     Vincent T. Mossman
-   Compile by: gcc -o primeFrequency primeFrequency.c
-   Run by:     ./prime
+   Compile by: gcc -O2 primeFrequency.c -pthread -lm -o primeFrequency
+   Run by:     ./primeFrequency [-t threads] [NAT to count to] [NAT to count by]
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "timer.h"
 #include "eratosthenes.c"
 
+void *threadCountBuckets(void *rank);
+long unsigned int popcountRange(const uint64_t *bits, long unsigned int from,
+                                long unsigned int to);
+int appendDecimal(char *out, long unsigned int v);
+
+// global variables
+long unsigned int countTo, countBy;
+long unsigned int numBuckets;                // including a partial last one
+long unsigned int fullBuckets;
+long unsigned int bucketsPerChunk, numChunks, nextChunk;
+long unsigned int *bucketCounts;
+uint32_t *frequencyBase;
+long unsigned int frequencyNumBase;
+long unsigned int *chunkMin, *chunkMax, *chunkN;
+double *chunkMean, *chunkM2;                 // Welford, merged at the end
+
 int main(int argc, char * argv[]) {
 
-  if (argc != 3) {
-    printf("Usage: %s <followed by [NAT to count to] followed by [NAT to count by]>\n", argv[0]);
+  if (parseThreadFlag(&argc, argv) != 0 || argc != 3) {
+    printf("Usage: %s [-t threads] <followed by [NAT to count to] followed by [NAT to count by]>\n", argv[0]);
     exit(-1);
   }
 
-  int COUNT_TO, COUNT_BY;
-  long unsigned int *primes, numPrimes;
-  sscanf(argv[1], "%d", &COUNT_TO);
-  sscanf(argv[2], "%d", &COUNT_BY);
-  int stats[3] = {COUNT_BY + 1, 0, 0}; //FREQ MIN, FREQ MAX, TOT
-  int i, startCount = 1, primeCount = 0, lastPrime = 0;
+  long unsigned int i, threads, n = 0, total = 0, lowest = ULONG_MAX, highest = 0;
+  long unsigned int first, last;
+  double mean = 0, m2 = 0, delta;
   double start, finish, elapsed;
+  char *text;
+  size_t used;
+  int errorCode;
+  long rank;
+  pthread_t *threadHandles;
+
+  sscanf(argv[1], "%lu", &countTo);
+  sscanf(argv[2], "%lu", &countBy);
+  if (countBy == 0) {
+    printf("Usage: %s [-t threads] <followed by [NAT to count to] followed by [NAT to count by]>\n", argv[0]);
+    exit(-1);
+  }
 
   FILE *f = fopen("primeFrequency.txt", "w");
   if (f == NULL) {
     printf("Error opening file!\n");
     exit(1);
-  }f
+  }
 
   GET_TIME(start);
 
-  // run sieve
-  primes = pth_eratosthenesPrime(COUNT_TO, &numPrimes);
+  // buckets are [k*by + 1, (k+1)*by]; chunks of them go to the threads
+  fullBuckets = countTo / countBy;
+  numBuckets = (countTo + countBy - 1) / countBy;
+  bucketsPerChunk = (16 * SIEVE_SEGMENT_SPAN) / countBy + 1;
+  numChunks = (numBuckets + bucketsPerChunk - 1) / bucketsPerChunk;
+  bucketCounts = (long unsigned int *) malloc(sizeof(long unsigned int)*(numBuckets + 1));
+  chunkMin = (long unsigned int *) malloc(sizeof(long unsigned int)*(numChunks + 1));
+  chunkMax = (long unsigned int *) malloc(sizeof(long unsigned int)*(numChunks + 1));
+  chunkN = (long unsigned int *) malloc(sizeof(long unsigned int)*(numChunks + 1));
+  chunkMean = (double *) malloc(sizeof(double)*(numChunks + 1));
+  chunkM2 = (double *) malloc(sizeof(double)*(numChunks + 1));
+  frequencyBase = sievePrimesUpTo(isqrt(countTo), &frequencyNumBase);
 
-  for (i = 1; i <= COUNT_TO; i++) {
-    if (primes[lastPrime] <= COUNT_BY+startCount-1 && lastPrime < numPrimes) {
-      primeCount++;
-      lastPrime++;
+  threads = sieveThreadCount();
+  threadHandles = (pthread_t *) malloc(threads * sizeof(pthread_t));
+  nextChunk = 0;
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_create(&threadHandles[rank], NULL, threadCountBuckets, (void *) rank)) != 0) {
+      printf("pthread %ld failed to be created with error code %d\n", rank, errorCode);
     }
-    if (i % COUNT_BY == 0) {
-        fprintf(f,"%d primes between %d and %d (inclusive)\n", primeCount, startCount, i);
-        if (primeCount < stats[0]) {
-          stats[0] = primeCount;
-        }
-        if (primeCount > stats[1]) {
-          stats[1] = primeCount;
-        }
-
-        stats[2] = stats[2] + primeCount;
-        primeCount = 0;
-        startCount = i+1;
+  }
+  for (rank = 0; rank < (long) threads; rank++) {
+    if ((errorCode = pthread_join(threadHandles[rank], (void **) NULL)) != 0) {
+      printf("pthread %ld failed to be joined with error code %d\n", rank, errorCode);
     }
   }
 
+  // merge the per-chunk statistics of the full buckets (Chan et al.)
+  for (i = 0; i < numChunks; i++) {
+    if (chunkN[i] == 0) {
+      continue;
+    }
+    delta = chunkMean[i] - mean;
+    mean += delta * chunkN[i] / (n + chunkN[i]);
+    m2 += chunkM2[i] + delta * delta * ((double) n * chunkN[i] / (n + chunkN[i]));
+    n += chunkN[i];
+    if (chunkMin[i] < lowest) {
+      lowest = chunkMin[i];
+    }
+    if (chunkMax[i] > highest) {
+      highest = chunkMax[i];
+    }
+  }
+
+  // write the buckets a megabyte at a time
+  text = (char *) malloc((1 << 20) + 128);
+  used = 0;
+  for (i = 0; i < numBuckets; i++) {
+    first = i * countBy + 1;
+    last = (i + 1 < numBuckets || countTo % countBy == 0) ? (i + 1) * countBy : countTo;
+    total += bucketCounts[i];
+    used += appendDecimal(text + used, bucketCounts[i]);
+    memcpy(text + used, " primes between ", 16);
+    used += 16;
+    used += appendDecimal(text + used, first);
+    memcpy(text + used, " and ", 5);
+    used += 5;
+    used += appendDecimal(text + used, last);
+    memcpy(text + used, " (inclusive)\n", 13);
+    used += 13;
+    if (used >= (1 << 20)) {
+      fwrite(text, 1, used, f);
+      used = 0;
+    }
+  }
+  fwrite(text, 1, used, f);
+  free(text);
+
   GET_TIME(finish);
   elapsed=finish-start;
 
   printf("\nDone.\n");
   printf("\nCPU execution time: %0.6lfs\n", elapsed);
-  fprintf(f,"\nLowest frequency per %d: %d\n", COUNT_BY, stats[0]);
-  fprintf(f,"Highest frequency per %d: %d\n", COUNT_BY, stats[1]);
-  fprintf(f,"Total Primes under %d: %d\n", COUNT_TO, stats[2]);
-  fprintf(f,"Average frequency: %0.3lf%% (to %d)\n\n", 100 * ((double) stats[2] / (double) COUNT_TO), COUNT_TO);
+  if (n == 0) {
+    lowest = 0;
+  }
+  fprintf(f,"\nLowest frequency per %lu: %lu\n", countBy, lowest);
+  fprintf(f,"Highest frequency per %lu: %lu\n", countBy, highest);
+  fprintf(f,"Mean frequency per %lu: %0.3lf\n", countBy, mean);
+  fprintf(f,"Variance of frequency per %lu: %0.3lf\n", countBy, n > 1 ? m2 / (n - 1) : 0.0);
+  fprintf(f,"Total Primes under %lu: %lu\n", countTo, total);
+  fprintf(f,"Average frequency: %0.3lf%% (to %lu)\n\n", countTo ? 100 * ((double) total / (double) countTo) : 0.0, countTo);
+  fclose(f);
+
+  free(threadHandles);
+  free(frequencyBase);
+  free(chunkM2);
+  free(chunkMean);
+  free(chunkN);
+  free(chunkMax);
+  free(chunkMin);
+  free(bucketCounts);
 
 }
+
+/******************************************************************************
+* Function threadCountBuckets claims chunks of buckets and sieves them one    *
+*  odd-only segment at a time. Each bucket's primes are the popcount of its   *
+*  slice of the segment bits, so no prime is ever listed. Statistics of the   *
+*  chunk's full buckets are kept as count, min, max, mean and M2.             *
+******************************************************************************/
+void *threadCountBuckets(void *rank) {
+
+  long unsigned int chunk, b, firstBucket, lastBucket, low, high, end, v;
+  long unsigned int bucketEnd, count, lo, hi;
+  long unsigned int n, minimum, maximum;
+  double mean, m2, delta;
+  uint64_t *bits;
+
+  (void) rank;
+  bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS);
+
+  while ((chunk = __atomic_fetch_add(&nextChunk, 1, __ATOMIC_RELAXED)) < numChunks) {
+    firstBucket = chunk * bucketsPerChunk;
+    lastBucket = firstBucket + bucketsPerChunk;
+    if (lastBucket > numBuckets) {
+      lastBucket = numBuckets;
+    } // end if
+    for (b = firstBucket; b < lastBucket; b++) {
+      bucketCounts[b] = (b == 1 / countBy && countTo >= 2); // the prime 2
+    } // end for
+
+    // odd numbers of the chunk, segment by segment
+    lo = firstBucket * countBy + 1;
+    hi = (lastBucket * countBy < countTo) ? lastBucket * countBy : countTo;
+    for (low = lo | 1; low <= hi; low += SIEVE_SEGMENT_SPAN) {
+      high = (hi - low < SIEVE_SEGMENT_SPAN) ? hi : low + SIEVE_SEGMENT_SPAN - 1;
+      sieveSegment(bits, low, high, frequencyBase, frequencyNumBase);
+
+      // hand each bucket overlapping the segment its slice of bits
+      for (v = low; v <= high; v = end + 1 + end % 2) {
+        b = (v - 1) / countBy;
+        bucketEnd = (b + 1) * countBy;
+        end = (bucketEnd < high) ? bucketEnd : high;
+        bucketCounts[b] += popcountRange(bits, (v - low) / 2, (end - low) / 2);
+        if (end == high) {
+          break;
+        } // end if
+      } // end for (v)
+    } // end for (low)
+
+    // statistics over the full buckets only
+    n = 0;
+    mean = 0;
+    m2 = 0;
+    minimum = ULONG_MAX;
+    maximum = 0;
+    for (b = firstBucket; b < lastBucket && b < fullBuckets; b++) {
+      count = bucketCounts[b];
+      n++;
+      delta = count - mean;
+      mean += delta / n;
+      m2 += delta * (count - mean);
+      if (count < minimum) {
+        minimum = count;
+      } // end if
+      if (count > maximum) {
+        maximum = count;
+      } // end if
+    } // end for (b)
+    chunkN[chunk] = n;
+    chunkMean[chunk] = mean;
+    chunkM2[chunk] = m2;
+    chunkMin[chunk] = minimum;
+    chunkMax[chunk] = maximum;
+  } // end while
+
+  free(bits);
+
+  return NULL;
+
+} // end threadCountBuckets
+
+/******************************************************************************
+* Function popcountRange counts the set bits from bit from to bit to          *
+*  (inclusive) a word at a time                                               *
+******************************************************************************/
+long unsigned int popcountRange(const uint64_t *bits, long unsigned int from,
+                                long unsigned int to) {
+
+  long unsigned int w, count;
+  uint64_t first, last;
+
+  first = ~0ULL << (from % 64);
+  last = ~0ULL >> (63 - to % 64);
+  if (from / 64 == to / 64) {
+    return __builtin_popcountll(bits[from / 64] & first & last);
+  } // end if
+  count = __builtin_popcountll(bits[from / 64] & first);
+  for (w = from / 64 + 1; w < to / 64; w++) {
+    count += __builtin_popcountll(bits[w]);
+  } // end for
+  count += __builtin_popcountll(bits[to / 64] & last);
+
+  return count;
+
+} // end popcountRange
+
+/******************************************************************************
+* Function appendDecimal writes v in decimal to out, returning its length     *
+******************************************************************************/
+int appendDecimal(char *out, long unsigned int v) {
+
+  char digits[24];
+  int d = 0, length = 0;
+
+  do {
+    digits[d++] = '0' + v % 10;
+    v /= 10;
+  } while (v);
+  while (d) {
+    out[length++] = digits[--d];
+  } // end while
+
+  return length;
+
+} // end appendDecimal
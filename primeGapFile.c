@@ -0,0 +1,272 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMEGAPFILE_C
+#define PRIMEGAPFILE_C
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "gapCodec.c"
+
+/* A prime gap file is the flat alternative to prime_segments. The gap file
+    (primes.gaps) is the varint gaps between consecutive primes, starting at
+    2 -> 3, and is only ever appended to. The index file (primes.gaps.idx)
+    is a header followed by one checkpoint per GAP_STRIDE primes: the prime
+    with index 1 + i*stride and the offset of the gap that follows it. Both
+    are mapped read-only, so finding the nth prime is one checkpoint read and
+    at most stride - 1 varints decoded from the page cache.
+
+    Index header (little-endian uint64): magic, primes, stride, reserved. */
+
+// content summary
+typedef struct {
+  int gapFd, indexFd;
+  const unsigned char *gaps;
+  const uint64_t *index;        // header, then (prime, offset) pairs
+  long unsigned int gapBytes, indexBytes;
+  long unsigned int count;      // primes covered
+  long unsigned int stride;
+} primeGapFile;
+  /* primeGapFile is an open, mapped pair of gap and index files.
+      */
+typedef struct {
+  FILE *gaps, *index;
+  long unsigned int count, stride, offset, last;
+  char gapPath[4096], indexPath[4096];
+  char gapTemp[4100], indexTemp[4100];  // written, then renamed into place
+} primeGapWriter;
+  /* primeGapWriter appends primes to a gap file and its index.
+      */
+int gapFileOpen(primeGapFile *g, const char *gapPath, const char *indexPath);
+  /* gapFileOpen maps both files read-only. Returns 0, or -1 if either is
+      missing or the index header does not match.
+      */
+long unsigned int gapFileNth(const primeGapFile *g, long unsigned int n);
+  /* gapFileNth returns the nth prime (1-based), or 0 if n is outside
+      1..g->count.
+      */
+void gapFileClose(primeGapFile *g);
+  /* gapFileClose unmaps and closes both files.
+      */
+int gapWriterOpen(primeGapWriter *w, const char *gapPath,
+                  const char *indexPath, long unsigned int stride);
+  /* gapWriterOpen creates temporary gap and index files (the paths plus
+      ".tmp") for primes to be appended in order from 2; the files at the
+      paths are left alone until gapWriterClose. Returns 0, or -1 if a file
+      cannot be created.
+      */
+void gapWriterAppend(primeGapWriter *w, long unsigned int prime);
+  /* gapWriterAppend appends the next prime.
+      */
+int gapWriterClose(primeGapWriter *w);
+  /* gapWriterClose writes the final count to the index header, closes both
+      files and renames them over the paths. Returns 0, or -1 (leaving the
+      old files in place) if any write failed.
+      */
+void gapWriterAbort(primeGapWriter *w);
+  /* gapWriterAbort closes and removes the temporary files.
+      */
+
+// definitions
+#define GAP_FILE_MAGIC 0x3130584449504750ULL   // "PGPIDX01"
+#define GAP_STRIDE 1024                        // primes per checkpoint
+
+/******************************************************************************
+* Function gapFileOpen maps the gap file and its index                        *
+******************************************************************************/
+int gapFileOpen(primeGapFile *g, const char *gapPath, const char *indexPath) {
+
+  struct stat st;
+
+  memset(g, 0, sizeof(primeGapFile));
+  g->gapFd = open(gapPath, O_RDONLY);
+  g->indexFd = open(indexPath, O_RDONLY);
+  if (g->gapFd < 0 || g->indexFd < 0) {
+    gapFileClose(g);
+    return -1;
+  } // end if
+
+  fstat(g->indexFd, &st);
+  g->indexBytes = st.st_size;
+  fstat(g->gapFd, &st);
+  g->gapBytes = st.st_size;
+  if (g->indexBytes < 4 * sizeof(uint64_t)) {
+    gapFileClose(g);
+    return -1;
+  } // end if
+  g->index = (const uint64_t *) mmap(NULL, g->indexBytes, PROT_READ, MAP_SHARED, g->indexFd, 0);
+  g->gaps = (g->gapBytes == 0) ? NULL
+          : (const unsigned char *) mmap(NULL, g->gapBytes, PROT_READ, MAP_SHARED, g->gapFd, 0);
+  if (g->index == MAP_FAILED || g->gaps == MAP_FAILED || g->index[0] != GAP_FILE_MAGIC
+      || g->index[2] == 0
+      || g->indexBytes < (4 + 2 * ((g->index[1] + g->index[2] - 1) / g->index[2])) * sizeof(uint64_t)) {
+    gapFileClose(g);
+    return -1;
+  } // end if
+  g->count = g->index[1];
+  g->stride = g->index[2];
+
+  // lookups only touch a checkpoint and the bytes after it
+  madvise((void *) g->gaps, g->gapBytes, MADV_RANDOM);
+
+  return 0;
+
+} // end gapFileOpen
+
+/******************************************************************************
+* Function gapFileNth starts at the checkpoint at or below n and adds gaps    *
+******************************************************************************/
+long unsigned int gapFileNth(const primeGapFile *g, long unsigned int n) {
+
+  long unsigned int i, prime, offset;
+
+  if (n == 0 || n > g->count) {
+    return 0;
+  } // end if
+  i = (n - 1) / g->stride;
+  prime = g->index[4 + 2 * i];
+  offset = g->index[5 + 2 * i];
+  addGaps(CODEC_VARINT_DELTA, g->gaps + offset, g->gapBytes - offset, &prime, (n - 1) % g->stride);
+
+  return prime;
+
+} // end gapFileNth
+
+/******************************************************************************
+* Function gapFileClose releases whatever gapFileOpen got as far as mapping   *
+******************************************************************************/
+void gapFileClose(primeGapFile *g) {
+
+  if (g->index != NULL && g->index != MAP_FAILED) {
+    munmap((void *) g->index, g->indexBytes);
+  } // end if
+  if (g->gaps != NULL && g->gaps != MAP_FAILED) {
+    munmap((void *) g->gaps, g->gapBytes);
+  } // end if
+  if (g->indexFd >= 0) {
+    close(g->indexFd);
+  } // end if
+  if (g->gapFd >= 0) {
+    close(g->gapFd);
+  } // end if
+  g->index = NULL;
+  g->gaps = NULL;
+  g->indexFd = g->gapFd = -1;
+
+} // end gapFileClose
+
+/******************************************************************************
+* Function gapWriterOpen creates both files next to their final paths, so a  *
+*  server mapping the old ones never sees them truncated; the header is      *
+*  rewritten on close                                                         *
+******************************************************************************/
+int gapWriterOpen(primeGapWriter *w, const char *gapPath,
+                  const char *indexPath, long unsigned int stride) {
+
+  uint64_t header[4] = {GAP_FILE_MAGIC, 0, 0, 0};
+
+  snprintf(w->gapPath, sizeof(w->gapPath), "%s", gapPath);
+  snprintf(w->indexPath, sizeof(w->indexPath), "%s", indexPath);
+  snprintf(w->gapTemp, sizeof(w->gapTemp), "%s.tmp", gapPath);
+  snprintf(w->indexTemp, sizeof(w->indexTemp), "%s.tmp", indexPath);
+  w->gaps = fopen(w->gapTemp, "wb");
+  w->index = fopen(w->indexTemp, "wb");
+  if (w->gaps == NULL || w->index == NULL) {
+    gapWriterAbort(w);
+    return -1;
+  } // end if
+  setvbuf(w->gaps, NULL, _IOFBF, 1 << 20);
+  header[2] = stride;
+  fwrite(header, sizeof(uint64_t), 4, w->index);
+  w->count = 0;
+  w->stride = stride;
+  w->offset = 0;
+  w->last = 0;
+
+  return 0;
+
+} // end gapWriterOpen
+
+/******************************************************************************
+* Function gapWriterAppend writes the gap to prime, and a checkpoint for      *
+*  every stride-th prime                                                      *
+******************************************************************************/
+void gapWriterAppend(primeGapWriter *w, long unsigned int prime) {
+
+  unsigned char bytes[10];
+  long unsigned int gap;
+  uint64_t checkpoint[2];
+  int length = 0;
+
+  if (w->count > 0) {
+    gap = prime - w->last;
+    while (gap >= 128) {
+      bytes[length++] = (unsigned char) ((gap & 127) | 128);
+      gap >>= 7;
+    } // end while
+    bytes[length++] = (unsigned char) gap;
+    fwrite(bytes, 1, length, w->gaps);
+    w->offset += length;
+  } // end if
+  if (w->count % w->stride == 0) {
+    checkpoint[0] = prime;
+    checkpoint[1] = w->offset;
+    fwrite(checkpoint, sizeof(uint64_t), 2, w->index);
+  } // end if
+  w->last = prime;
+  w->count++;
+
+} // end gapWriterAppend
+
+/******************************************************************************
+* Function gapWriterClose renames the gap file first: until the index follows *
+*  a reader pairs the old index with a longer copy of the same gaps          *
+******************************************************************************/
+int gapWriterClose(primeGapWriter *w) {
+
+  uint64_t count = w->count;
+  int failed;
+
+  failed = fseek(w->index, sizeof(uint64_t), SEEK_SET) != 0
+           || fwrite(&count, sizeof(uint64_t), 1, w->index) != 1;
+  failed |= ferror(w->index) || ferror(w->gaps);
+  failed |= fclose(w->index) != 0;
+  failed |= fclose(w->gaps) != 0;
+  w->index = NULL;
+  w->gaps = NULL;
+  if (failed || rename(w->gapTemp, w->gapPath) != 0 || rename(w->indexTemp, w->indexPath) != 0) {
+    gapWriterAbort(w);
+    return -1;
+  } // end if
+
+  return 0;
+
+} // end gapWriterClose
+
+/******************************************************************************
+* Function gapWriterAbort                                                     *
+******************************************************************************/
+void gapWriterAbort(primeGapWriter *w) {
+
+  if (w->gaps != NULL) {
+    fclose(w->gaps);
+    w->gaps = NULL;
+  } // end if
+  if (w->index != NULL) {
+    fclose(w->index);
+    w->index = NULL;
+  } // end if
+  remove(w->gapTemp);
+  remove(w->indexTemp);
+
+} // end gapWriterAbort
+
+#endif
@@ -0,0 +1,148 @@
+/* Some fun with prime numbers. Program converts the prime_segments of the
+    prime database (in either compression_method) into a flat,
+    memory-mapped gap file with a checkpoint index, and looks up nth primes
+    in it.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primeGaps primeGaps.c -lsqlite3
+   Run by:     ./primeGaps --convert [database] [gap file] [stride]
+               ./primeGaps [--file gap file] [NAT index] ...
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sqlite3.h>
+#include "timer.h"
+#include "primeGapFile.c"
+
+int convertDatabase(const char *databasePath, const char *gapPath,
+                    long unsigned int stride);
+
+#define DEFAULT_DATABASE "database/primes.db"
+#define DEFAULT_GAP_FILE "database/primes.gaps"
+
+int main(int argc, char * argv[]) {
+
+  const char *gapPath = DEFAULT_GAP_FILE;
+  char indexPath[4096];
+  primeGapFile g;
+  long unsigned int n, prime;
+  int arg = 1;
+  double start, finish;
+
+  if (argc >= 2 && strcmp(argv[1], "--convert") == 0 && argc <= 5) {
+    return convertDatabase(argc >= 3 ? argv[2] : DEFAULT_DATABASE,
+                           argc >= 4 ? argv[3] : DEFAULT_GAP_FILE,
+                           argc == 5 ? strtoul(argv[4], NULL, 10) : GAP_STRIDE);
+  }
+  if (argc >= 3 && strcmp(argv[1], "--file") == 0) {
+    gapPath = argv[2];
+    arg = 3;
+  }
+  if (arg >= argc) {
+    printf("Usage: %s --convert <optionally followed by [database] [gap file] [stride]>\n", argv[0]);
+    printf("       %s [--file gap file] <followed by [NAT index] ...>\n", argv[0]);
+    exit(-1);
+  }
+
+  snprintf(indexPath, sizeof(indexPath), "%s.idx", gapPath);
+  if (gapFileOpen(&g, gapPath, indexPath) != 0) {
+    printf("Error opening %s and %s (run --convert first)\n", gapPath, indexPath);
+    exit(1);
+  }
+
+  for (; arg < argc; arg++) {
+    n = strtoul(argv[arg], NULL, 10);
+    GET_TIME(start);
+    prime = gapFileNth(&g, n);
+    GET_TIME(finish);
+    if (prime == 0) {
+      printf("Index %s is outside 1..%lu\n", argv[arg], g.count);
+    } else {
+      printf("Prime #%lu: %lu (%0.6fs)\n", n, prime, finish - start);
+    }
+  }
+  gapFileClose(&g);
+
+  return 0;
+
+}
+
+/******************************************************************************
+* Function convertDatabase streams prime_segments in index order into a new   *
+*  gap file and index. Segments must cover 1..max_prime_index without holes.  *
+******************************************************************************/
+int convertDatabase(const char *databasePath, const char *gapPath,
+                    long unsigned int stride) {
+
+  sqlite3 *db;
+  sqlite3_stmt *stmt;
+  primeGapWriter w;
+  char indexPath[4096];
+  const unsigned char *blob;
+  long unsigned int startIndex, size, prime, decoded, i;
+  int bytes, codec;
+  double start, finish;
+
+  if (stride == 0) {
+    printf("Stride must be at least 1\n");
+    exit(-1);
+  } // end if
+  if (sqlite3_open_v2(databasePath, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+    printf("Error opening database %s: %s\n", databasePath, sqlite3_errmsg(db));
+    exit(1);
+  } // end if
+  if ((codec = databaseCodec(db)) < 0) {
+    printf("%s uses an unknown compression_method\n", databasePath);
+    exit(1);
+  } // end if
+  snprintf(indexPath, sizeof(indexPath), "%s.idx", gapPath);
+  if (gapWriterOpen(&w, gapPath, indexPath, stride) != 0) {
+    printf("Error creating %s\n", gapPath);
+    exit(1);
+  } // end if
+
+  GET_TIME(start);
+
+  sqlite3_prepare_v2(db, "SELECT start_index, start_prime, segment_size, compressed_deltas "
+                         "FROM prime_segments ORDER BY start_index", -1, &stmt, NULL);
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    startIndex = (long unsigned int) sqlite3_column_int64(stmt, 0);
+    prime = (long unsigned int) sqlite3_column_int64(stmt, 1);
+    size = (long unsigned int) sqlite3_column_int64(stmt, 2);
+    blob = (const unsigned char *) sqlite3_column_blob(stmt, 3);
+    bytes = sqlite3_column_bytes(stmt, 3);
+    if (startIndex != w.count + 1) {
+      printf("Segment starting at index %lu does not follow index %lu\n", startIndex, w.count);
+      gapWriterAbort(&w);
+      exit(1);
+    } // end if
+
+    gapWriterAppend(&w, prime);
+    decoded = 1;
+    for (i = 0; i < (long unsigned int) bytes && completeGap(codec, blob, i, bytes) > 0; decoded++) {
+      prime += decodeGap(codec, blob, &i);
+      gapWriterAppend(&w, prime);
+    } // end for
+    if (decoded != size) {
+      printf("Segment starting at index %lu holds %lu primes, not %lu\n", startIndex, decoded, size);
+      gapWriterAbort(&w);
+      exit(1);
+    } // end if
+  } // end while
+  sqlite3_finalize(stmt);
+  sqlite3_close(db);
+  if (gapWriterClose(&w) != 0) {
+    perror("Error writing the gap file");
+    exit(1);
+  } // end if
+
+  GET_TIME(finish);
+
+  printf("Wrote %lu primes (%lu bytes of gaps, stride %lu) to %s and %s\n",
+         w.count, w.offset, stride, gapPath, indexPath);
+  printf("\nCPU execution time: %0.6fs\n\n", finish - start);
+
+  return 0;
+
+} // end convertDatabase
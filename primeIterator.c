@@ -0,0 +1,397 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMEITERATOR_C
+#define PRIMEITERATOR_C
+
+#include <limits.h>
+#include "eratosthenes.c"
+
+// content summary
+#define ITERATOR_UNBOUNDED ULONG_MAX    // stop for streaming without end
+
+typedef struct {
+  long unsigned int low;          // first number in the window (1 + k*SPAN)
+  long unsigned int high;         // last number in the window
+  long unsigned int segments;     // window length, in segments
+  long unsigned int ramp;         // length of the next window to load
+  uint64_t *bits;                 // sieved odd numbers of the window
+  uint32_t *basePrimes;           // sieving primes, grown on demand
+  long unsigned int numBase;
+  long unsigned int baseLimit;
+  long unsigned int current;      // cursor (see primeIteratorSkipTo)
+  int inclusive;                  // next() may return current itself
+  long unsigned int stop;         // largest prime next() will return
+  long unsigned int threads;      // widest window, in segments
+  pthread_t *workers;             // threads - 1 helpers, started once
+  pthread_mutex_t lock;
+  pthread_cond_t wake;            // a new window (or quit) for the workers
+  pthread_cond_t done;            // the window's last segment is sieved
+  long unsigned int window;       // windows loaded so far
+  long unsigned int nextSegment;  // next segment of the window to claim
+  long unsigned int pending;      // segments of the window not yet sieved
+  long unsigned int busy;         // workers still inside the window
+  int open;                       // workers may still join the window
+  int quit;
+} primeIterator;
+
+void primeIteratorInit(primeIterator *it, long unsigned int start,
+                       long unsigned int stop);
+  /* primeIteratorInit prepares it to stream primes from start up to stop
+      (inclusive; ITERATOR_UNBOUNDED for no upper bound) without
+      materializing them. A stop below 2 yields no primes. Nothing
+      is sieved until the first call to next() or prev(), but the worker
+      threads that share out each window start here.
+      */
+long unsigned int primeIteratorNext(primeIterator *it);
+  /* primeIteratorNext advances to and returns the next prime, or 0 once the
+      next prime would exceed stop.
+      */
+long unsigned int primeIteratorPrev(primeIterator *it);
+  /* primeIteratorPrev steps back to and returns the previous prime, or 0 if
+      there is none.
+      */
+void primeIteratorSkipTo(primeIterator *it, long unsigned int x);
+  /* primeIteratorSkipTo repositions the cursor just before x: next() then
+      returns the smallest prime >= x and prev() the largest prime < x.
+      */
+void primeIteratorFree(primeIterator *it);
+  /* primeIteratorFree stops the workers and releases the window and sieving
+      primes of it.
+      */
+void primeIteratorLoad(primeIterator *it, long unsigned int n, int forward);
+  /* primeIteratorLoad sieves a window of it->ramp segments containing n,
+      extending forward or backward from n's segment. Segments of one window
+      are sieved in parallel, so the window never exceeds the thread count.
+      */
+void iteratorClaimSegments(primeIterator *it);
+  /* iteratorClaimSegments sieves segments of the current window, claimed
+      one at a time, until none are left, and signals the window done when
+      it finishes the last one.
+      */
+void *threadIteratorWorker(void *iterator);
+  /* threadIteratorWorker is the pthread body of the workers: it sleeps until
+      primeIteratorLoad posts a window, helps sieve it, and exits on quit.
+      It joins a window only while it is open and counts as busy inside it;
+      the window is not done until no worker is.
+      */
+
+/******************************************************************************
+* Function primeIteratorInit sets up an empty iterator                        *
+******************************************************************************/
+void primeIteratorInit(primeIterator *it, long unsigned int start,
+                       long unsigned int stop) {
+
+  long unsigned int rank;
+  int errorCode;
+
+  it->low = 1;
+  it->high = 0;                   // empty window: any lookup loads one
+  it->segments = 0;
+  it->threads = sieveThreadCount();
+  it->bits = (uint64_t *) malloc(sizeof(uint64_t)*SIEVE_SEGMENT_WORDS*
+                                 it->threads);
+  it->basePrimes = NULL;
+  it->numBase = 0;
+  it->baseLimit = 0;
+  it->stop = stop;
+  primeIteratorSkipTo(it, start);
+
+  // the workers wait for windows from here to primeIteratorFree
+  pthread_mutex_init(&it->lock, NULL);
+  pthread_cond_init(&it->wake, NULL);
+  pthread_cond_init(&it->done, NULL);
+  it->window = 0;
+  it->nextSegment = 0;
+  it->pending = 0;
+  it->busy = 0;
+  it->open = FALSE;
+  it->quit = FALSE;
+  it->workers = (pthread_t *) malloc(sizeof(pthread_t)*it->threads);
+  for (rank = 1; rank < it->threads; rank++) {
+    if ((errorCode = pthread_create(&it->workers[rank], NULL, threadIteratorWorker, (void *) it)) != 0) {
+      printf("pthread %lu failed to be created with error code %d\n", rank, errorCode);
+      exit(1);
+    } // end if
+  } // end for
+
+} // end primeIteratorInit
+
+/******************************************************************************
+* Function primeIteratorSkipTo moves the cursor without sieving anything      *
+******************************************************************************/
+void primeIteratorSkipTo(primeIterator *it, long unsigned int x) {
+
+  it->current = x;
+  it->inclusive = TRUE;
+  it->ramp = 1;                   // first window after a jump is one segment
+
+} // end primeIteratorSkipTo
+
+/******************************************************************************
+* Function primeIteratorNext scans the window bitmap forward for a set bit,   *
+*  sliding the window ahead whenever it runs off the end                      *
+******************************************************************************/
+long unsigned int primeIteratorNext(primeIterator *it) {
+
+  long unsigned int from, k, w, words;
+  uint64_t word;
+
+  // first candidate
+  from = it->current;
+  if (!it->inclusive) {
+    if (from == ULONG_MAX) {
+      return 0;
+    } // end if
+    from++;
+  } // end if
+  if (from <= 2) {
+    if (it->stop < 2) {
+      return 0;
+    } // end if
+    it->current = 2;
+    it->inclusive = FALSE;
+    return 2;
+  } // end if
+  from |= 1;
+
+  while (from <= it->stop) {
+    if (from < it->low || from > it->high) {
+      primeIteratorLoad(it, from, TRUE);
+    } // end if
+
+    // find the first set bit at or after from
+    words = it->segments * SIEVE_SEGMENT_WORDS;
+    k = (from - it->low) / 2;
+    w = k >> 6;
+    word = it->bits[w] & (~0ULL << (k & 63));
+    while (!word && ++w < words) {
+      word = it->bits[w];
+    } // end while
+    if (word) {
+      from = it->low + 2 * (w * 64 + __builtin_ctzll(word));
+      if (from > it->stop) {
+        break;
+      } // end if
+      it->current = from;
+      it->inclusive = FALSE;
+      return from;
+    } // end if
+
+    // nothing left in this window
+    if (it->high == ULONG_MAX) {
+      break;
+    } // end if
+    from = it->high + 1;
+  } // end while
+
+  return 0;
+
+} // end primeIteratorNext
+
+/******************************************************************************
+* Function primeIteratorPrev is the mirror image of primeIteratorNext         *
+******************************************************************************/
+long unsigned int primeIteratorPrev(primeIterator *it) {
+
+  long unsigned int from, k, w;
+  long int v;
+  uint64_t word;
+
+  // primes below 5 are not in an odd bitmap worth loading
+  if (it->current <= 2) {
+    return 0;
+  } // end if
+  if (it->current == 3) {
+    it->current = 2;
+    it->inclusive = FALSE;
+    return 2;
+  } // end if
+  from = (it->current - 1) | 1;
+  if (from >= it->current) {
+    from -= 2;
+  } // end if
+
+  while (from >= 3) {
+    if (from < it->low || from > it->high) {
+      primeIteratorLoad(it, from, FALSE);
+    } // end if
+
+    // find the last set bit at or before from
+    k = (from - it->low) / 2;
+    w = k >> 6;
+    word = it->bits[w] & (~0ULL >> (63 - (k & 63)));
+    v = (long int) w;
+    while (!word && --v >= 0) {
+      word = it->bits[v];
+    } // end while
+    if (word) {
+      from = it->low + 2 * (v * 64 + 63 - __builtin_clzll(word));
+      it->current = from;
+      it->inclusive = FALSE;
+      return from;
+    } // end if
+
+    // nothing left in this window
+    if (it->low == 1) {
+      break;
+    } // end if
+    from = it->low - 2;
+  } // end while
+
+  it->current = 2;
+  it->inclusive = FALSE;
+  return 2;
+
+} // end primeIteratorPrev
+
+/******************************************************************************
+* Function primeIteratorLoad sieves the window holding n. Windows start at    *
+*  one segment so the first prime comes out at once, then double up to the   *
+*  thread count while the cursor keeps moving in the same direction.         *
+******************************************************************************/
+void primeIteratorLoad(primeIterator *it, long unsigned int n, int forward) {
+
+  int scope;
+  long unsigned int first, last, limit;
+
+  // pick the segments of the window
+  first = (n - 1) / SIEVE_SEGMENT_SPAN;
+  if (!forward) {
+    first = (first + 1 > it->ramp) ? first + 1 - it->ramp : 0;
+  } // end if
+  last = first + it->ramp - 1;
+  if (last > (ULONG_MAX - 1) / SIEVE_SEGMENT_SPAN) {
+    last = (ULONG_MAX - 1) / SIEVE_SEGMENT_SPAN;
+  } // end if
+  it->segments = last - first + 1;
+  it->low = 1 + first * SIEVE_SEGMENT_SPAN;
+  it->high = (ULONG_MAX - it->low < it->segments * SIEVE_SEGMENT_SPAN)
+               ? ULONG_MAX : it->low + it->segments * SIEVE_SEGMENT_SPAN - 1;
+
+  // composites <= stop all have a factor <= sqrt(stop), so never sieve past it
+  limit = isqrt(it->high < it->stop ? it->high : it->stop);
+  if (limit > it->baseLimit) {
+    if (limit < 2 * it->baseLimit) {
+      limit = 2 * it->baseLimit;
+    } // end if
+    if (limit > UINT32_MAX) {
+      limit = UINT32_MAX;
+    } // end if
+    scope = profileBegin("base primes");
+    free(it->basePrimes);
+    it->basePrimes = sievePrimesUpTo(limit, &it->numBase);
+    profileEnd(scope);
+    it->baseLimit = limit;
+  } // end if
+
+  // post the window to the workers and help sieve it; the window is closed
+  //  again, under the lock, before its geometry or base primes can change
+  scope = profileBegin("segment marking");
+  pthread_mutex_lock(&it->lock);
+  it->pending = it->segments;
+  __atomic_store_n(&it->nextSegment, 0, __ATOMIC_RELEASE);
+  it->window++;
+  it->open = TRUE;
+  pthread_cond_broadcast(&it->wake);
+  pthread_mutex_unlock(&it->lock);
+  iteratorClaimSegments(it);
+  pthread_mutex_lock(&it->lock);
+  while (it->pending > 0 || it->busy > 0) {
+    pthread_cond_wait(&it->done, &it->lock);
+  } // end while
+  it->open = FALSE;
+  pthread_mutex_unlock(&it->lock);
+  profileEnd(scope);
+
+  // grow the next window
+  it->ramp = (2 * it->ramp < it->threads) ? 2 * it->ramp : it->threads;
+
+} // end primeIteratorLoad
+
+/******************************************************************************
+* Function iteratorClaimSegments takes segments off the window's counter.    *
+*  Workers only join an open window, and primeIteratorLoad closes it (under  *
+*  the lock, once no worker is busy) before it sets up the next one, so a    *
+*  worker that wakes late waits for the next window instead                   *
+******************************************************************************/
+void iteratorClaimSegments(primeIterator *it) {
+
+  long unsigned int s, low, high;
+
+  while ((s = __atomic_fetch_add(&it->nextSegment, 1, __ATOMIC_ACQ_REL)) < it->segments) {
+    low = it->low + s * SIEVE_SEGMENT_SPAN;
+    high = (ULONG_MAX - low < SIEVE_SEGMENT_SPAN - 1)
+             ? ULONG_MAX : low + SIEVE_SEGMENT_SPAN - 1;
+    sieveSegment(it->bits + s * SIEVE_SEGMENT_WORDS, low, high,
+                 it->basePrimes, it->numBase);
+    pthread_mutex_lock(&it->lock);
+    if (--it->pending == 0 && it->busy == 0) {
+      pthread_cond_signal(&it->done);
+    } // end if
+    pthread_mutex_unlock(&it->lock);
+  } // end while
+
+} // end iteratorClaimSegments
+
+/******************************************************************************
+* Function threadIteratorWorker                                               *
+******************************************************************************/
+void *threadIteratorWorker(void *iterator) {
+
+  primeIterator *it = (primeIterator *) iterator;
+  long unsigned int seen = 0;
+
+  while (1) {
+    pthread_mutex_lock(&it->lock);
+    while (!it->quit && (it->window == seen || !it->open)) {
+      pthread_cond_wait(&it->wake, &it->lock);
+    } // end while
+    if (it->quit) {
+      pthread_mutex_unlock(&it->lock);
+      break;
+    } // end if
+    seen = it->window;
+    it->busy++;
+    pthread_mutex_unlock(&it->lock);
+    iteratorClaimSegments(it);
+    pthread_mutex_lock(&it->lock);
+    if (--it->busy == 0 && it->pending == 0) {
+      pthread_cond_signal(&it->done);
+    } // end if
+    pthread_mutex_unlock(&it->lock);
+  } // end while
+
+  return NULL;
+
+} // end threadIteratorWorker
+
+/******************************************************************************
+* Function primeIteratorFree releases iterator memory                         *
+******************************************************************************/
+void primeIteratorFree(primeIterator *it) {
+
+  long unsigned int rank;
+
+  pthread_mutex_lock(&it->lock);
+  it->quit = TRUE;
+  pthread_cond_broadcast(&it->wake);
+  pthread_mutex_unlock(&it->lock);
+  for (rank = 1; rank < it->threads; rank++) {
+    pthread_join(it->workers[rank], NULL);
+  } // end for
+  free(it->workers);
+  pthread_mutex_destroy(&it->lock);
+  pthread_cond_destroy(&it->wake);
+  pthread_cond_destroy(&it->done);
+
+  free(it->bits);
+  free(it->basePrimes);
+  it->bits = NULL;
+  it->basePrimes = NULL;
+
+} // end primeIteratorFree
+
+#endif
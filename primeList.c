@@ -1,55 +1,96 @@
 /* Some fun with prime numbers
    Author:     Vincent T. Mossman
-   Compile by: gcc primeList.c -pthread -lm -o primeList
-   Run by:     ./primeList [NAT to list primes to]
+   Compile by: gcc -O2 primeList.c -pthread -lm -o primeList
+   Run by:     ./primeList [-t threads] [-f format] [--profile[=json]] [NAT from] [NAT to list primes to]
+               formats: text (default), uint64, half_gap32, varint_delta
 */
 
-#include "eratosthenes.c"
+#include "primeIterator.c"
+#include "intervalSieve.c"
+#include "primeOutput.c"
 #include "timer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 
 int main(int argc, char * argv[]) {
 
-  if ((argc < 2) || (argc > 3)) {
-    printf("Usage: %s <followed by [NAT to list primes to]>\n", argv[0]);
+  int format, arg, valid;
+  long unsigned int bounds[2] = {0, 0};
+  char *end;
+
+  valid = parseThreadFlag(&argc, argv) == 0 && (format = parseFormatFlag(&argc, argv)) >= 0
+          && profileInit(&argc, argv) == 0 && argc >= 2 && argc <= 3;
+  // bounds are plain naturals that fit 64 bits (strtoul would accept "-1")
+  for (arg = 1; valid && arg < argc; arg++) {
+    errno = 0;
+    bounds[arg + 2 - argc] = strtoul(argv[arg], &end, 10);
+    valid = *argv[arg] >= '0' && *argv[arg] <= '9' && *end == '\0' && errno != ERANGE;
+  }
+  if (!valid) {
+    printf("Usage: %s [-t threads] [-f text|uint64|half_gap32|varint_delta] [--profile[=json]] <optionally followed by [NAT from] followed by [NAT to list primes to]>\n", argv[0]);
     exit(-1);
   }
 
-  double p_start, p_finish, p_elapsed;
   double start, finish, elapsed;
-  long unsigned int max, min, *primes, numPrimes, i;
-
-  if (argc == 2) {
-    min = 0;
-    sscanf(argv[1], "%ld", &max);
-  } else if (argc == 3) {
-    sscanf(argv[1], "%ld", &min);
-    sscanf(argv[2], "%ld", &max);
+  long unsigned int max, min, prime, w;
+  primeIterator primes;
+  intervalSieve interval;
+  primeOutput out;
+  uint64_t word;
+  int scope;
+
+  min = bounds[0];
+  max = bounds[1];
+  if (max > ULONG_MAX - (1UL << 32)) {
+    printf("%lu: the range must end below 2^64 - 2^32\n", max);
+    exit(-1);
   }
 
   GET_TIME(start);
 
-  // get prime array
-  primes = pth_eratosthenesPrime(max, &numPrimes);
-
-  GET_TIME(finish);
-  elapsed = finish-start;
-  GET_TIME(p_start);
-
-  // display prime list
-  for (i = 0; i < numPrimes; i++) {
-    if (primes[i] >= min) {
-      printf("%ld, ",primes[i]);
+  // stream prime list straight from the sieve into output batches, which a
+  //  writer thread formats and writes while sieving goes on; the window
+  //  sieving nests inside output
+  if (primeOutputOpen(&out, STDOUT_FILENO, format, sieveThreadCount() > 1) != 0) {
+    printf("Error allocating output buffers\n");
+    exit(1);
+  }
+  scope = profileBegin("output");
+  if (max < 2 || max < min) {
+    // empty range: nothing to list
+  } else if (min > 0 && isqrt(max) >= SIEVE_SEGMENT_SPAN / 2) {
+    // a bounded interval far out: bucket-sieve just [min, max]
+    if (min <= 2 && max >= 2) {
+      primeOutputPrime(&out, 2);
+    }
+    intervalSieveInit(&interval, min, max);
+    while (intervalSieveNext(&interval)) {
+      for (w = 0; w < SIEVE_SEGMENT_WORDS; w++) {
+        for (word = interval.bits[w]; word; word &= word - 1) {
+          primeOutputPrime(&out, interval.low + 2 * (w * 64 + __builtin_ctzll(word)));
+        }
+      }
+    }
+    intervalSieveFree(&interval);
+  } else {
+    primeIteratorInit(&primes, min, max);
+    while ((prime = primeIteratorNext(&primes)) != 0) {
+      primeOutputPrime(&out, prime);
     }
+    primeIteratorFree(&primes);
   }
-  printf("\n");
+  if (primeOutputClose(&out) != 0) {
+    perror("Error writing primes");
+    exit(1);
+  }
+  profileEnd(scope);
 
-  GET_TIME(p_finish);
-  p_elapsed = p_finish-p_start;
+  GET_TIME(finish);
+  elapsed = finish-start;
 
-  printf("\nCPU execution time to run sieve: %0.6lf seconds\n", elapsed);
-  printf("CPU execution time to print: %0.6lf seconds\n\n", p_elapsed);
+  // keep the list clean for pipes (prime --batch reads the text format)
+  fprintf(stderr, "\nCPU execution time to sieve and print: %0.6lf seconds\n\n", elapsed);
 
 }
@@ -0,0 +1,444 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMEOUTPUT_C
+#define PRIMEOUTPUT_C
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/uio.h>
+#include "gapCodec.c"
+
+/* Buffered output of a rising sequence of primes, in one of the formats:
+
+    text          decimal, each followed by ", ", then a final newline (what
+                   primeList has always printed)
+    uint64        each prime as a little-endian uint64
+    half_gap32    the first prime as a little-endian uint64, then each gap
+                   g as the little-endian uint32 g/2 (0 stands for the one
+                   odd gap, 2 -> 3)
+    varint_delta  the first prime as a little-endian uint64, then each gap
+                   as a varint, as in the database and the /api range body
+
+    The caller only appends primes to a batch of OUTPUT_BATCH. Full batches
+    queue in a ring of OUTPUT_QUEUE, from which a writer thread formats
+    every waiting batch into its own page-aligned buffer and writes them all
+    with one writev, while the caller goes on sieving into the next free
+    batch. Without the thread, each batch is formatted and written in turn. */
+
+// content summary
+#define OUTPUT_BATCH 65536              // primes per batch
+#define OUTPUT_QUEUE 8                  // batches in the ring
+#define OUTPUT_RECORD 22                // bytes the longest record takes
+
+typedef struct {
+  int fd;
+  int format;
+  long unsigned int previous;     // last prime formatted, 0 before the first
+  long unsigned int *batch;       // batch being filled (= batches[head])
+  long unsigned int used;
+  long unsigned int *batches[OUTPUT_QUEUE];
+  long unsigned int counts[OUTPUT_QUEUE];
+  unsigned char *buffers[OUTPUT_QUEUE];
+  int head;                       // slot the caller is filling
+  int tail;                       // oldest slot waiting to be written
+  int filled;                     // slots waiting to be written
+  int threaded;
+  int done;
+  int error;                      // errno of a failed write, or 0
+  pthread_t writer;
+  pthread_mutex_t mutex;
+  pthread_cond_t changed;
+} primeOutput;
+
+int outputFormatFromName(const char *name);
+  /* outputFormatFromName returns the format called name, or -1 if there is
+      none.
+      */
+int parseFormatFlag(int *argc, char *argv[]);
+  /* parseFormatFlag strips "-f <format>" out of the argument list and
+      returns the format named, text if there is no flag, or -1 if the format
+      is unknown.
+      */
+int primeOutputOpen(primeOutput *out, int fd, int format, int threaded);
+  /* primeOutputOpen prepares out to write to fd, with a writer thread if
+      threaded. Returns 0, or -1 if memory or the thread cannot be had.
+      */
+static inline void primeOutputPrime(primeOutput *out, long unsigned int prime);
+  /* primeOutputPrime appends prime, which must exceed the one before.
+      */
+size_t formatBatch(primeOutput *out, const long unsigned int *primes,
+                   long unsigned int count, unsigned char *buffer);
+  /* formatBatch writes count primes into buffer in the format of out and
+      returns the bytes written.
+      */
+int primeOutputClose(primeOutput *out);
+  /* primeOutputClose writes what is buffered (and the text format's newline),
+      stops the writer and frees out. Returns 0, or -1 with errno set if any
+      write failed.
+      */
+size_t formatDecimal(unsigned char *out, uint64_t n);
+  /* formatDecimal writes n in decimal at out (at most 20 bytes) and returns
+      its length.
+      */
+void primeOutputFlush(primeOutput *out);
+  /* primeOutputFlush hands the batch being filled to the writer (or formats
+      and writes it) and switches to a free one.
+      */
+int writeBuffers(int fd, struct iovec *iov, int count);
+  /* writeBuffers writes iov[0..count) in full, resuming after short writes.
+      Returns 0, or -1 with errno set.
+      */
+void *threadOutputWriter(void *output);
+  /* threadOutputWriter is the pthread body that formats and writes queued
+      batches.
+      */
+
+// definitions
+enum {
+  OUTPUT_TEXT, OUTPUT_UINT64, OUTPUT_HALF_GAP32, OUTPUT_VARINT_DELTA, OUTPUT_FORMATS
+};
+
+const char *outputFormatNames[OUTPUT_FORMATS] = {
+  "text", "uint64", "half_gap32", "varint_delta"
+};
+
+// "00" "01" ... "99": two digits per division by 100
+const char decimalPairs[201] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/******************************************************************************
+* Function outputFormatFromName                                               *
+******************************************************************************/
+int outputFormatFromName(const char *name) {
+
+  int format;
+
+  for (format = 0; format < OUTPUT_FORMATS; format++) {
+    if (strcmp(name, outputFormatNames[format]) == 0) {
+      return format;
+    } // end if
+  } // end for
+
+  return -1;
+
+} // end outputFormatFromName
+
+/******************************************************************************
+* Function parseFormatFlag works like parseThreadFlag                         *
+******************************************************************************/
+int parseFormatFlag(int *argc, char *argv[]) {
+
+  int i, j, format = OUTPUT_TEXT;
+
+  for (i = 1; i < *argc; i++) {
+    if (strcmp(argv[i], "-f") == 0) {
+      if (i + 1 >= *argc || (format = outputFormatFromName(argv[i+1])) < 0) {
+        return -1;
+      } // end if
+      for (j = i; j + 2 <= *argc; j++) {
+        argv[j] = argv[j+2];
+      } // end for (j)
+      *argc -= 2;
+      i--;
+    } // end if
+  } // end for (i)
+
+  return format;
+
+} // end parseFormatFlag
+
+/******************************************************************************
+* Function primeOutputOpen                                                    *
+******************************************************************************/
+int primeOutputOpen(primeOutput *out, int fd, int format, int threaded) {
+
+  int slot;
+
+  memset(out, 0, sizeof(primeOutput));
+  out->fd = fd;
+  out->format = format;
+  out->threaded = threaded;
+  for (slot = 0; slot < (threaded ? OUTPUT_QUEUE : 1); slot++) {
+    out->batches[slot] = (long unsigned int *) malloc(sizeof(long unsigned int)*OUTPUT_BATCH);
+    if (out->batches[slot] == NULL
+        || posix_memalign((void **) &out->buffers[slot], 4096, OUTPUT_BATCH * OUTPUT_RECORD) != 0) {
+      return -1;
+    } // end if
+  } // end for
+  out->batch = out->batches[0];
+  pthread_mutex_init(&out->mutex, NULL);
+  pthread_cond_init(&out->changed, NULL);
+  if (threaded && pthread_create(&out->writer, NULL, threadOutputWriter, (void *) out) != 0) {
+    return -1;
+  } // end if
+
+  return 0;
+
+} // end primeOutputOpen
+
+/******************************************************************************
+* Function formatDecimal writes two digits per step from the right, through   *
+*  the pair table, then copies the digits into place                          *
+******************************************************************************/
+size_t formatDecimal(unsigned char *out, uint64_t n) {
+
+  unsigned char digits[20], *p = digits + 20;
+  size_t length;
+
+  while (n >= 100) {
+    p -= 2;
+    memcpy(p, decimalPairs + 2 * (n % 100), 2);
+    n /= 100;
+  } // end while
+  if (n >= 10) {
+    p -= 2;
+    memcpy(p, decimalPairs + 2 * n, 2);
+  } else {
+    *--p = (unsigned char) ('0' + n);
+  } // end if
+  length = digits + 20 - p;
+  memcpy(out, p, length);
+
+  return length;
+
+} // end formatDecimal
+
+/******************************************************************************
+* Function putLittle64 stores n as a little-endian uint64                     *
+******************************************************************************/
+static inline void putLittle64(unsigned char *out, uint64_t n) {
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  n = __builtin_bswap64(n);
+#endif
+  memcpy(out, &n, 8);
+
+} // end putLittle64
+
+/******************************************************************************
+* Function primeOutputPrime                                                   *
+******************************************************************************/
+static inline void primeOutputPrime(primeOutput *out, long unsigned int prime) {
+
+  out->batch[out->used++] = prime;
+  if (out->used == OUTPUT_BATCH) {
+    primeOutputFlush(out);
+  } // end if
+
+} // end primeOutputPrime
+
+/******************************************************************************
+* Function formatBatch                                                        *
+******************************************************************************/
+size_t formatBatch(primeOutput *out, const long unsigned int *primes,
+                   long unsigned int count, unsigned char *buffer) {
+
+  unsigned char *p = buffer;
+  long unsigned int i, previous = out->previous;
+  uint32_t half;
+
+  i = 0;
+  if (count > 0 && previous == 0 && out->format != OUTPUT_TEXT) {
+    putLittle64(p, primes[0]);
+    p += 8;
+    previous = primes[i++];
+  } // end if
+
+  switch (out->format) {
+    case OUTPUT_TEXT:
+      for (; i < count; i++) {
+        p += formatDecimal(p, primes[i]);
+        p[0] = ',';
+        p[1] = ' ';
+        p += 2;
+      } // end for
+      break;
+    case OUTPUT_UINT64:
+      for (; i < count; i++) {
+        putLittle64(p, primes[i]);
+        p += 8;
+      } // end for
+      break;
+    case OUTPUT_HALF_GAP32:
+      for (; i < count; i++) {
+        half = (uint32_t) ((primes[i] - previous) / 2);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        half = __builtin_bswap32(half);
+#endif
+        memcpy(p, &half, 4);
+        p += 4;
+        previous = primes[i];
+      } // end for
+      break;
+    case OUTPUT_VARINT_DELTA:
+      for (; i < count; i++) {
+        p += encodeGap(CODEC_VARINT_DELTA, p, primes[i] - previous);
+        previous = primes[i];
+      } // end for
+      break;
+  } // end switch
+  if (count > 0) {
+    out->previous = primes[count - 1];
+  } // end if
+
+  return p - buffer;
+
+} // end formatBatch
+
+/******************************************************************************
+* Function writeBuffers                                                       *
+******************************************************************************/
+int writeBuffers(int fd, struct iovec *iov, int count) {
+
+  ssize_t written;
+
+  while (count > 0) {
+    written = writev(fd, iov, count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      } // end if
+      return -1;
+    } // end if
+
+    // drop the buffers written in full, trim a partly written one
+    while (count > 0 && (size_t) written >= iov->iov_len) {
+      written -= iov->iov_len;
+      iov++;
+      count--;
+    } // end while
+    if (count > 0) {
+      iov->iov_base = (char *) iov->iov_base + written;
+      iov->iov_len -= written;
+    } // end if
+  } // end while
+
+  return 0;
+
+} // end writeBuffers
+
+/******************************************************************************
+* Function primeOutputFlush waits, if every other slot is queued, for the     *
+*  writer to free one                                                         *
+******************************************************************************/
+void primeOutputFlush(primeOutput *out) {
+
+  struct iovec iov;
+
+  if (!out->threaded) {
+    iov.iov_base = out->buffers[0];
+    iov.iov_len = formatBatch(out, out->batch, out->used, out->buffers[0]);
+    if (iov.iov_len > 0 && !out->error && writeBuffers(out->fd, &iov, 1) != 0) {
+      out->error = errno;
+    } // end if
+    out->used = 0;
+    return;
+  } // end if
+
+  pthread_mutex_lock(&out->mutex);
+  out->counts[out->head] = out->used;
+  out->head = (out->head + 1) % OUTPUT_QUEUE;
+  out->filled++;
+  pthread_cond_broadcast(&out->changed);
+  while (out->filled == OUTPUT_QUEUE) {
+    pthread_cond_wait(&out->changed, &out->mutex);
+  } // end while
+  pthread_mutex_unlock(&out->mutex);
+  out->batch = out->batches[out->head];
+  out->used = 0;
+
+} // end primeOutputFlush
+
+/******************************************************************************
+* Function threadOutputWriter takes every queued slot at once: formats each   *
+*  batch into its slot's buffer, then writes them in one writev. The caller   *
+*  never touches a queued slot, so all of it runs unlocked.                   *
+******************************************************************************/
+void *threadOutputWriter(void *output) {
+
+  primeOutput *out = (primeOutput *) output;
+  struct iovec iov[OUTPUT_QUEUE];
+  int count, k, slot;
+
+  pthread_mutex_lock(&out->mutex);
+  while (1) {
+    while (out->filled == 0 && !out->done) {
+      pthread_cond_wait(&out->changed, &out->mutex);
+    } // end while
+    if (out->filled == 0) {
+      break;
+    } // end if
+    count = out->filled;
+    pthread_mutex_unlock(&out->mutex);
+
+    for (k = 0; k < count; k++) {
+      slot = (out->tail + k) % OUTPUT_QUEUE;
+      iov[k].iov_base = out->buffers[slot];
+      iov[k].iov_len = formatBatch(out, out->batches[slot], out->counts[slot], out->buffers[slot]);
+    } // end for
+
+    // after a failed write, keep draining so the caller is not blocked
+    if (!out->error && writeBuffers(out->fd, iov, count) != 0) {
+      out->error = errno;
+    } // end if
+
+    pthread_mutex_lock(&out->mutex);
+    out->tail = (out->tail + count) % OUTPUT_QUEUE;
+    out->filled -= count;
+    pthread_cond_broadcast(&out->changed);
+  } // end while
+  pthread_mutex_unlock(&out->mutex);
+
+  return NULL;
+
+} // end threadOutputWriter
+
+/******************************************************************************
+* Function primeOutputClose                                                   *
+******************************************************************************/
+int primeOutputClose(primeOutput *out) {
+
+  struct iovec iov;
+  int slot;
+
+  primeOutputFlush(out);
+  if (out->threaded) {
+    pthread_mutex_lock(&out->mutex);
+    out->done = 1;
+    pthread_cond_broadcast(&out->changed);
+    pthread_mutex_unlock(&out->mutex);
+    pthread_join(out->writer, NULL);
+  } // end if
+  if (out->format == OUTPUT_TEXT && !out->error) {
+    iov.iov_base = "\n";
+    iov.iov_len = 1;
+    if (writeBuffers(out->fd, &iov, 1) != 0) {
+      out->error = errno;
+    } // end if
+  } // end if
+  for (slot = 0; slot < OUTPUT_QUEUE; slot++) {
+    free(out->batches[slot]);
+    free(out->buffers[slot]);
+  } // end for
+  pthread_mutex_destroy(&out->mutex);
+  pthread_cond_destroy(&out->changed);
+  if (out->error) {
+    errno = out->error;
+    return -1;
+  } // end if
+
+  return 0;
+
+} // end primeOutputClose
+
+#endif
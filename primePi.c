@@ -0,0 +1,157 @@
+/* Some fun with prime numbers. Program counts the primes up to x without
+    listing them, finds the n-th prime, and checks the counts stored in the
+    prime database.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primePi primePi.c -pthread -lm -lsqlite3
+   Run by:     ./primePi [-t threads] [--profile[=json]] [--sieve] [NAT x] ...
+               ./primePi [-t threads] [--profile[=json]] --nth [NAT n] ...
+               ./primePi [-t threads] --check [database] [samples]
+*/
+
+#include "primeCounting.c"
+#include "timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sqlite3.h>
+#include "gapCodec.c"
+
+int checkDatabase(const char *path, long unsigned int samples);
+
+// segments checked by --check unless told otherwise
+#define CHECK_SAMPLES 16
+
+int main(int argc, char * argv[]) {
+
+  long unsigned int x, count;
+  int arg, sieve = 0, nth = 0;
+  char *end;
+  double start, finish;
+
+  if (parseThreadFlag(&argc, argv) != 0 || profileInit(&argc, argv) != 0) {
+    argc = 1;
+  }
+  if (argc >= 2 && strcmp(argv[1], "--check") == 0 && argc <= 4) {
+    return checkDatabase(argc >= 3 ? argv[2] : "database/primes.db",
+                         argc == 4 ? strtoul(argv[3], NULL, 10) : CHECK_SAMPLES);
+  }
+  if (argc >= 2 && strcmp(argv[1], "--sieve") == 0) {
+    sieve = 1;
+  }
+  if (argc >= 2 && strcmp(argv[1], "--nth") == 0) {
+    nth = 1;
+  }
+  if (argc < 2 + sieve + nth) {
+    printf("Usage: %s [-t threads] [--profile[=json]] [--sieve] <followed by [NAT x] (below 2^63) ...>\n", argv[0]);
+    printf("       %s [-t threads] [--profile[=json]] --nth <followed by [NAT n] (p_n below 2^63) ...>\n", argv[0]);
+    printf("       %s [-t threads] --check <optionally followed by [database] [samples]>\n", argv[0]);
+    exit(-1);
+  }
+
+  for (arg = 1 + sieve + nth; arg < argc; arg++) {
+    errno = 0;
+    x = strtoul(argv[arg], &end, 10);
+    if (*argv[arg] < '0' || *argv[arg] > '9' || *end != '\0' || errno == ERANGE
+        || x >> 63) {
+      printf("%s: not a natural below 2^63\n", argv[arg]);
+      continue;
+    }
+
+    if (nth && x > PI_NTH_LIMIT) {
+      printf("%s: p_n would pass 2^63\n", argv[arg]);
+      continue;
+    }
+
+    GET_TIME(start);
+    count = nth ? nthPrime(x) : sieve ? primeCountSieve(x) : primeCount(x);
+    GET_TIME(finish);
+
+    if (nth) {
+      printf("p_%lu = %lu\n", x, count);
+    } else {
+      printf("pi(%lu) = %lu\n", x, count);
+    }
+    printf("CPU execution time: %0.6fs\n", finish - start);
+  }
+
+  return 0;
+
+}
+
+/******************************************************************************
+* Function checkDatabase recounts an evenly spaced sample of prime_segments   *
+*  (always the first and last) with primeCount: pi(start_prime) must be       *
+*  start_index, the decoded gaps must end on a prime whose pi is end_index,   *
+*  and segment_size must agree with both. Returns 0 if every check holds.     *
+******************************************************************************/
+int checkDatabase(const char *path, long unsigned int samples) {
+
+  sqlite3 *db;
+  sqlite3_stmt *stmt;
+  long unsigned int segments, s, every, checked = 0, failed = 0, gaps;
+  long unsigned int startIndex, endIndex, startPrime, size, last, pi, id;
+  const unsigned char *blob;
+  int bytes, codec;
+
+  if (sqlite3_open_v2(path, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) {
+    printf("Error opening database %s: %s\n", path, sqlite3_errmsg(db));
+    sqlite3_close(db);
+    exit(1);
+  } // end if
+
+  sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM prime_segments", -1, &stmt, NULL);
+  segments = (sqlite3_step(stmt) == SQLITE_ROW) ? (long unsigned int) sqlite3_column_int64(stmt, 0) : 0;
+  sqlite3_finalize(stmt);
+  if (segments == 0) {
+    printf("%s has no prime_segments to check\n", path);
+    sqlite3_close(db);
+    return 1;
+  } // end if
+  if ((codec = databaseCodec(db)) < 0) {
+    printf("%s uses an unknown compression_method\n", path);
+    sqlite3_close(db);
+    return 1;
+  } // end if
+  every = (samples > 1 && segments > samples) ? (segments - 1) / (samples - 1) : 1;
+
+  sqlite3_prepare_v2(db, "SELECT segment_id, start_index, end_index, start_prime, "
+                         "segment_size, compressed_deltas FROM prime_segments "
+                         "ORDER BY start_index", -1, &stmt, NULL);
+  for (s = 0; sqlite3_step(stmt) == SQLITE_ROW; s++) {
+    if (s % every != 0 && s != segments - 1) {
+      continue;
+    } // end if
+    id = (long unsigned int) sqlite3_column_int64(stmt, 0);
+    startIndex = (long unsigned int) sqlite3_column_int64(stmt, 1);
+    endIndex = (long unsigned int) sqlite3_column_int64(stmt, 2);
+    startPrime = (long unsigned int) sqlite3_column_int64(stmt, 3);
+    size = (long unsigned int) sqlite3_column_int64(stmt, 4);
+    blob = (const unsigned char *) sqlite3_column_blob(stmt, 5);
+    bytes = sqlite3_column_bytes(stmt, 5);
+
+    // walk the gaps to the segment's last prime
+    last = startPrime;
+    gaps = countGaps(codec, blob, bytes);
+    addGaps(codec, blob, bytes, &last, gaps);
+
+    checked++;
+    if ((pi = primeCount(startPrime)) != startIndex) {
+      printf("segment %lu: pi(%lu) = %lu but start_index is %lu\n", id, startPrime, pi, startIndex);
+      failed++;
+    } else if (gaps + 1 != size || endIndex - startIndex + 1 != size) {
+      printf("segment %lu: segment_size %lu, %lu gaps, indexes %lu..%lu\n", id, size, gaps, startIndex, endIndex);
+      failed++;
+    } else if ((pi = primeCount(last)) != endIndex || primeCount(last - 1) != endIndex - 1) {
+      printf("segment %lu: ends on %lu (pi %lu) but end_index is %lu\n", id, last, pi, endIndex);
+      failed++;
+    } // end if
+  } // end for (s)
+  sqlite3_finalize(stmt);
+  sqlite3_close(db);
+
+  printf("Checked %lu of %lu segments against pi(x): %lu mismatched\n", checked, segments, failed);
+
+  return failed ? 1 : 0;
+
+} // end checkDatabase
@@ -1,7 +1,7 @@
 /* Some fun with prime numbers
    Author:     Vincent T. Mossman
-   Compile by: gcc -o primeSieveDifference primeSieveDifference.c
-   Run by:     ./prime
+   Compile by: gcc primeSieveDifference.c -pthread -lm -o primeSieveDifference
+   Run by:     ./primeSieveDifference [-t threads] [NAT to count to]
 */
 
 #include <stdio.h>
@@ -9,24 +9,28 @@
 #include <string.h>
 #include <time.h>
 #include <stdbool.h>
-#include "eratosthenes.c"
+#include "primeIterator.c"
 
 bool allEqual(long unsigned int *, long unsigned int, long unsigned int);
+void appendDif(long unsigned int *, long unsigned int, long unsigned int);
 
 int main(int argc, char * argv[]) {
 
-  if (argc != 2) {
-    printf("Usage: %s <followed by [NAT to count to]>\n", argv[0]);
+  if (parseThreadFlag(&argc, argv) != 0 || argc != 2) {
+    printf("Usage: %s [-t threads] <followed by [NAT to count to]>\n", argv[0]);
     exit(-1);
   }
 
-  long unsigned int max, i, *primes, numPrimes, dif, degreeTwo[2] = {0, 0};
+  long unsigned int max, prime, lastPrime, dif, degreeTwo[2] = {0, 0};
+  primeIterator primes;
   sscanf(argv[1], "%ld", &max);
 
-  primes = pth_eratosthenesPrime(max, &numPrimes);
+  primeIteratorInit(&primes, 1, max);
+  lastPrime = primeIteratorNext(&primes);
 
-  for (i = 1; i < numPrimes; i++) {
-    dif = primes[i] - primes[i-1];
+  while (lastPrime != 0 && (prime = primeIteratorNext(&primes)) != 0) {
+    dif = prime - lastPrime;
+    lastPrime = prime;
     if (allEqual(degreeTwo,2,dif)) {
       printf("{%ld %ld} ",dif,dif);
       degreeTwo[0]=0; degreeTwo[1]=0;
@@ -36,7 +40,9 @@ int main(int argc, char * argv[]) {
     //printf("%ld ", dif);
   }
   printf("\n");
+  primeIteratorFree(&primes);
 
+}
 
 bool allEqual(long unsigned int *array,
               long unsigned int arraySize,
@@ -0,0 +1,1340 @@
+/*
+  Generated by primeTablesGen.c (npm run gen-tables); do not edit.
+*/
+
+#ifndef PRIMETABLEDATA_C
+#define PRIMETABLEDATA_C
+
+#include <stdint.h>
+
+#define SMALL_TABLE_PRIMES 6542
+#define PRESIEVE_PRODUCT 15015UL
+#define PRESIEVE_LARGEST 13
+#define PRESIEVE_COUNT 5
+#define PRESIEVE_PRIMES {3, 5, 7, 11, 13}
+#define PRESIEVE_WORDS 236
+#define PI_CHECKPOINT_STRIDE (1UL << 26)
+#define PI_CHECKPOINTS 4097
+#define PI_CHECKPOINT_LIMIT (PI_CHECKPOINT_STRIDE * (PI_CHECKPOINTS - 1))
+
+// every prime below 65536; smallPrimeTable + 1 is a base prime list
+const uint32_t smallPrimeTable[SMALL_TABLE_PRIMES] = {
+      2,     3,     5,     7,    11,    13,    17,    19,    23,    29,    31,    37,
+     41,    43,    47,    53,    59,    61,    67,    71,    73,    79,    83,    89,
+     97,   101,   103,   107,   109,   113,   127,   131,   137,   139,   149,   151,
+    157,   163,   167,   173,   179,   181,   191,   193,   197,   199,   211,   223,
+    227,   229,   233,   239,   241,   251,   257,   263,   269,   271,   277,   281,
+    283,   293,   307,   311,   313,   317,   331,   337,   347,   349,   353,   359,
+    367,   373,   379,   383,   389,   397,   401,   409,   419,   421,   431,   433,
+    439,   443,   449,   457,   461,   463,   467,   479,   487,   491,   499,   503,
+    509,   521,   523,   541,   547,   557,   563,   569,   571,   577,   587,   593,
+    599,   601,   607,   613,   617,   619,   631,   641,   643,   647,   653,   659,
+    661,   673,   677,   683,   691,   701,   709,   719,   727,   733,   739,   743,
+    751,   757,   761,   769,   773,   787,   797,   809,   811,   821,   823,   827,
+    829,   839,   853,   857,   859,   863,   877,   881,   883,   887,   907,   911,
+    919,   929,   937,   941,   947,   953,   967,   971,   977,   983,   991,   997,
+   1009,  1013,  1019,  1021,  1031,  1033,  1039,  1049,  1051,  1061,  1063,  1069,
+   1087,  1091,  1093,  1097,  1103,  1109,  1117,  1123,  1129,  1151,  1153,  1163,
+   1171,  1181,  1187,  1193,  1201,  1213,  1217,  1223,  1229,  1231,  1237,  1249,
+   1259,  1277,  1279,  1283,  1289,  1291,  1297,  1301,  1303,  1307,  1319,  1321,
+   1327,  1361,  1367,  1373,  1381,  1399,  1409,  1423,  1427,  1429,  1433,  1439,
+   1447,  1451,  1453,  1459,  1471,  1481,  1483,  1487,  1489,  1493,  1499,  1511,
+   1523,  1531,  1543,  1549,  1553,  1559,  1567,  1571,  1579,  1583,  1597,  1601,
+   1607,  1609,  1613,  1619,  1621,  1627,  1637,  1657,  1663,  1667,  1669,  1693,
+   1697,  1699,  1709,  1721,  1723,  1733,  1741,  1747,  1753,  1759,  1777,  1783,
+   1787,  1789,  1801,  1811,  1823,  1831,  1847,  1861,  1867,  1871,  1873,  1877,
+   1879,  1889,  1901,  1907,  1913,  1931,  1933,  1949,  1951,  1973,  1979,  1987,
+   1993,  1997,  1999,  2003,  2011,  2017,  2027,  2029,  2039,  2053,  2063,  2069,
+   2081,  2083,  2087,  2089,  2099,  2111,  2113,  2129,  2131,  2137,  2141,  2143,
+   2153,  2161,  2179,  2203,  2207,  2213,  2221,  2237,  2239,  2243,  2251,  2267,
+   2269,  2273,  2281,  2287,  2293,  2297,  2309,  2311,  2333,  2339,  2341,  2347,
+   2351,  2357,  2371,  2377,  2381,  2383,  2389,  2393,  2399,  2411,  2417,  2423,
+   2437,  2441,  2447,  2459,  2467,  2473,  2477,  2503,  2521,  2531,  2539,  2543,
+   2549,  2551,  2557,  2579,  2591,  2593,  2609,  2617,  2621,  2633,  2647,  2657,
+   2659,  2663,  2671,  2677,  2683,  2687,  2689,  2693,  2699,  2707,  2711,  2713,
+   2719,  2729,  2731,  2741,  2749,  2753,  2767,  2777,  2789,  2791,  2797,  2801,
+   2803,  2819,  2833,  2837,  2843,  2851,  2857,  2861,  2879,  2887,  2897,  2903,
+   2909,  2917,  2927,  2939,  2953,  2957,  2963,  2969,  2971,  2999,  3001,  3011,
+   3019,  3023,  3037,  3041,  3049,  3061,  3067,  3079,  3083,  3089,  3109,  3119,
+   3121,  3137,  3163,  3167,  3169,  3181,  3187,  3191,  3203,  3209,  3217,  3221,
+   3229,  3251,  3253,  3257,  3259,  3271,  3299,  3301,  3307,  3313,  3319,  3323,
+   3329,  3331,  3343,  3347,  3359,  3361,  3371,  3373,  3389,  3391,  3407,  3413,
+   3433,  3449,  3457,  3461,  3463,  3467,  3469,  3491,  3499,  3511,  3517,  3527,
+   3529,  3533,  3539,  3541,  3547,  3557,  3559,  3571,  3581,  3583,  3593,  3607,
+   3613,  3617,  3623,  3631,  3637,  3643,  3659,  3671,  3673,  3677,  3691,  3697,
+   3701,  3709,  3719,  3727,  3733,  3739,  3761,  3767,  3769,  3779,  3793,  3797,
+   3803,  3821,  3823,  3833,  3847,  3851,  3853,  3863,  3877,  3881,  3889,  3907,
+   3911,  3917,  3919,  3923,  3929,  3931,  3943,  3947,  3967,  3989,  4001,  4003,
+   4007,  4013,  4019,  4021,  4027,  4049,  4051,  4057,  4073,  4079,  4091,  4093,
+   4099,  4111,  4127,  4129,  4133,  4139,  4153,  4157,  4159,  4177,  4201,  4211,
+   4217,  4219,  4229,  4231,  4241,  4243,  4253,  4259,  4261,  4271,  4273,  4283,
+   4289,  4297,  4327,  4337,  4339,  4349,  4357,  4363,  4373,  4391,  4397,  4409,
+   4421,  4423,  4441,  4447,  4451,  4457,  4463,  4481,  4483,  4493,  4507,  4513,
+   4517,  4519,  4523,  4547,  4549,  4561,  4567,  4583,  4591,  4597,  4603,  4621,
+   4637,  4639,  4643,  4649,  4651,  4657,  4663,  4673,  4679,  4691,  4703,  4721,
+   4723,  4729,  4733,  4751,  4759,  4783,  4787,  4789,  4793,  4799,  4801,  4813,
+   4817,  4831,  4861,  4871,  4877,  4889,  4903,  4909,  4919,  4931,  4933,  4937,
+   4943,  4951,  4957,  4967,  4969,  4973,  4987,  4993,  4999,  5003,  5009,  5011,
+   5021,  5023,  5039,  5051,  5059,  5077,  5081,  5087,  5099,  5101,  5107,  5113,
+   5119,  5147,  5153,  5167,  5171,  5179,  5189,  5197,  5209,  5227,  5231,  5233,
+   5237,  5261,  5273,  5279,  5281,  5297,  5303,  5309,  5323,  5333,  5347,  5351,
+   5381,  5387,  5393,  5399,  5407,  5413,  5417,  5419,  5431,  5437,  5441,  5443,
+   5449,  5471,  5477,  5479,  5483,  5501,  5503,  5507,  5519,  5521,  5527,  5531,
+   5557,  5563,  5569,  5573,  5581,  5591,  5623,  5639,  5641,  5647,  5651,  5653,
+   5657,  5659,  5669,  5683,  5689,  5693,  5701,  5711,  5717,  5737,  5741,  5743,
+   5749,  5779,  5783,  5791,  5801,  5807,  5813,  5821,  5827,  5839,  5843,  5849,
+   5851,  5857,  5861,  5867,  5869,  5879,  5881,  5897,  5903,  5923,  5927,  5939,
+   5953,  5981,  5987,  6007,  6011,  6029,  6037,  6043,  6047,  6053,  6067,  6073,
+   6079,  6089,  6091,  6101,  6113,  6121,  6131,  6133,  6143,  6151,  6163,  6173,
+   6197,  6199,  6203,  6211,  6217,  6221,  6229,  6247,  6257,  6263,  6269,  6271,
+   6277,  6287,  6299,  6301,  6311,  6317,  6323,  6329,  6337,  6343,  6353,  6359,
+   6361,  6367,  6373,  6379,  6389,  6397,  6421,  6427,  6449,  6451,  6469,  6473,
+   6481,  6491,  6521,  6529,  6547,  6551,  6553,  6563,  6569,  6571,  6577,  6581,
+   6599,  6607,  6619,  6637,  6653,  6659,  6661,  6673,  6679,  6689,  6691,  6701,
+   6703,  6709,  6719,  6733,  6737,  6761,  6763,  6779,  6781,  6791,  6793,  6803,
+   6823,  6827,  6829,  6833,  6841,  6857,  6863,  6869,  6871,  6883,  6899,  6907,
+   6911,  6917,  6947,  6949,  6959,  6961,  6967,  6971,  6977,  6983,  6991,  6997,
+   7001,  7013,  7019,  7027,  7039,  7043,  7057,  7069,  7079,  7103,  7109,  7121,
+   7127,  7129,  7151,  7159,  7177,  7187,  7193,  7207,  7211,  7213,  7219,  7229,
+   7237,  7243,  7247,  7253,  7283,  7297,  7307,  7309,  7321,  7331,  7333,  7349,
+   7351,  7369,  7393,  7411,  7417,  7433,  7451,  7457,  7459,  7477,  7481,  7487,
+   7489,  7499,  7507,  7517,  7523,  7529,  7537,  7541,  7547,  7549,  7559,  7561,
+   7573,  7577,  7583,  7589,  7591,  7603,  7607,  7621,  7639,  7643,  7649,  7669,
+   7673,  7681,  7687,  7691,  7699,  7703,  7717,  7723,  7727,  7741,  7753,  7757,
+   7759,  7789,  7793,  7817,  7823,  7829,  7841,  7853,  7867,  7873,  7877,  7879,
+   7883,  7901,  7907,  7919,  7927,  7933,  7937,  7949,  7951,  7963,  7993,  8009,
+   8011,  8017,  8039,  8053,  8059,  8069,  8081,  8087,  8089,  8093,  8101,  8111,
+   8117,  8123,  8147,  8161,  8167,  8171,  8179,  8191,  8209,  8219,  8221,  8231,
+   8233,  8237,  8243,  8263,  8269,  8273,  8287,  8291,  8293,  8297,  8311,  8317,
+   8329,  8353,  8363,  8369,  8377,  8387,  8389,  8419,  8423,  8429,  8431,  8443,
+   8447,  8461,  8467,  8501,  8513,  8521,  8527,  8537,  8539,  8543,  8563,  8573,
+   8581,  8597,  8599,  8609,  8623,  8627,  8629,  8641,  8647,  8663,  8669,  8677,
+   8681,  8689,  8693,  8699,  8707,  8713,  8719,  8731,  8737,  8741,  8747,  8753,
+   8761,  8779,  8783,  8803,  8807,  8819,  8821,  8831,  8837,  8839,  8849,  8861,
+   8863,  8867,  8887,  8893,  8923,  8929,  8933,  8941,  8951,  8963,  8969,  8971,
+   8999,  9001,  9007,  9011,  9013,  9029,  9041,  9043,  9049,  9059,  9067,  9091,
+   9103,  9109,  9127,  9133,  9137,  9151,  9157,  9161,  9173,  9181,  9187,  9199,
+   9203,  9209,  9221,  9227,  9239,  9241,  9257,  9277,  9281,  9283,  9293,  9311,
+   9319,  9323,  9337,  9341,  9343,  9349,  9371,  9377,  9391,  9397,  9403,  9413,
+   9419,  9421,  9431,  9433,  9437,  9439,  9461,  9463,  9467,  9473,  9479,  9491,
+   9497,  9511,  9521,  9533,  9539,  9547,  9551,  9587,  9601,  9613,  9619,  9623,
+   9629,  9631,  9643,  9649,  9661,  9677,  9679,  9689,  9697,  9719,  9721,  9733,
+   9739,  9743,  9749,  9767,  9769,  9781,  9787,  9791,  9803,  9811,  9817,  9829,
+   9833,  9839,  9851,  9857,  9859,  9871,  9883,  9887,  9901,  9907,  9923,  9929,
+   9931,  9941,  9949,  9967,  9973, 10007, 10009, 10037, 10039, 10061, 10067, 10069,
+  10079, 10091, 10093, 10099, 10103, 10111, 10133, 10139, 10141, 10151, 10159, 10163,
+  10169, 10177, 10181, 10193, 10211, 10223, 10243, 10247, 10253, 10259, 10267, 10271,
+  10273, 10289, 10301, 10303, 10313, 10321, 10331, 10333, 10337, 10343, 10357, 10369,
+  10391, 10399, 10427, 10429, 10433, 10453, 10457, 10459, 10463, 10477, 10487, 10499,
+  10501, 10513, 10529, 10531, 10559, 10567, 10589, 10597, 10601, 10607, 10613, 10627,
+  10631, 10639, 10651, 10657, 10663, 10667, 10687, 10691, 10709, 10711, 10723, 10729,
+  10733, 10739, 10753, 10771, 10781, 10789, 10799, 10831, 10837, 10847, 10853, 10859,
+  10861, 10867, 10883, 10889, 10891, 10903, 10909, 10937, 10939, 10949, 10957, 10973,
+  10979, 10987, 10993, 11003, 11027, 11047, 11057, 11059, 11069, 11071, 11083, 11087,
+  11093, 11113, 11117, 11119, 11131, 11149, 11159, 11161, 11171, 11173, 11177, 11197,
+  11213, 11239, 11243, 11251, 11257, 11261, 11273, 11279, 11287, 11299, 11311, 11317,
+  11321, 11329, 11351, 11353, 11369, 11383, 11393, 11399, 11411, 11423, 11437, 11443,
+  11447, 11467, 11471, 11483, 11489, 11491, 11497, 11503, 11519, 11527, 11549, 11551,
+  11579, 11587, 11593, 11597, 11617, 11621, 11633, 11657, 11677, 11681, 11689, 11699,
+  11701, 11717, 11719, 11731, 11743, 11777, 11779, 11783, 11789, 11801, 11807, 11813,
+  11821, 11827, 11831, 11833, 11839, 11863, 11867, 11887, 11897, 11903, 11909, 11923,
+  11927, 11933, 11939, 11941, 11953, 11959, 11969, 11971, 11981, 11987, 12007, 12011,
+  12037, 12041, 12043, 12049, 12071, 12073, 12097, 12101, 12107, 12109, 12113, 12119,
+  12143, 12149, 12157, 12161, 12163, 12197, 12203, 12211, 12227, 12239, 12241, 12251,
+  12253, 12263, 12269, 12277, 12281, 12289, 12301, 12323, 12329, 12343, 12347, 12373,
+  12377, 12379, 12391, 12401, 12409, 12413, 12421, 12433, 12437, 12451, 12457, 12473,
+  12479, 12487, 12491, 12497, 12503, 12511, 12517, 12527, 12539, 12541, 12547, 12553,
+  12569, 12577, 12583, 12589, 12601, 12611, 12613, 12619, 12637, 12641, 12647, 12653,
+  12659, 12671, 12689, 12697, 12703, 12713, 12721, 12739, 12743, 12757, 12763, 12781,
+  12791, 12799, 12809, 12821, 12823, 12829, 12841, 12853, 12889, 12893, 12899, 12907,
+  12911, 12917, 12919, 12923, 12941, 12953, 12959, 12967, 12973, 12979, 12983, 13001,
+  13003, 13007, 13009, 13033, 13037, 13043, 13049, 13063, 13093, 13099, 13103, 13109,
+  13121, 13127, 13147, 13151, 13159, 13163, 13171, 13177, 13183, 13187, 13217, 13219,
+  13229, 13241, 13249, 13259, 13267, 13291, 13297, 13309, 13313, 13327, 13331, 13337,
+  13339, 13367, 13381, 13397, 13399, 13411, 13417, 13421, 13441, 13451, 13457, 13463,
+  13469, 13477, 13487, 13499, 13513, 13523, 13537, 13553, 13567, 13577, 13591, 13597,
+  13613, 13619, 13627, 13633, 13649, 13669, 13679, 13681, 13687, 13691, 13693, 13697,
+  13709, 13711, 13721, 13723, 13729, 13751, 13757, 13759, 13763, 13781, 13789, 13799,
+  13807, 13829, 13831, 13841, 13859, 13873, 13877, 13879, 13883, 13901, 13903, 13907,
+  13913, 13921, 13931, 13933, 13963, 13967, 13997, 13999, 14009, 14011, 14029, 14033,
+  14051, 14057, 14071, 14081, 14083, 14087, 14107, 14143, 14149, 14153, 14159, 14173,
+  14177, 14197, 14207, 14221, 14243, 14249, 14251, 14281, 14293, 14303, 14321, 14323,
+  14327, 14341, 14347, 14369, 14387, 14389, 14401, 14407, 14411, 14419, 14423, 14431,
+  14437, 14447, 14449, 14461, 14479, 14489, 14503, 14519, 14533, 14537, 14543, 14549,
+  14551, 14557, 14561, 14563, 14591, 14593, 14621, 14627, 14629, 14633, 14639, 14653,
+  14657, 14669, 14683, 14699, 14713, 14717, 14723, 14731, 14737, 14741, 14747, 14753,
+  14759, 14767, 14771, 14779, 14783, 14797, 14813, 14821, 14827, 14831, 14843, 14851,
+  14867, 14869, 14879, 14887, 14891, 14897, 14923, 14929, 14939, 14947, 14951, 14957,
+  14969, 14983, 15013, 15017, 15031, 15053, 15061, 15073, 15077, 15083, 15091, 15101,
+  15107, 15121, 15131, 15137, 15139, 15149, 15161, 15173, 15187, 15193, 15199, 15217,
+  15227, 15233, 15241, 15259, 15263, 15269, 15271, 15277, 15287, 15289, 15299, 15307,
+  15313, 15319, 15329, 15331, 15349, 15359, 15361, 15373, 15377, 15383, 15391, 15401,
+  15413, 15427, 15439, 15443, 15451, 15461, 15467, 15473, 15493, 15497, 15511, 15527,
+  15541, 15551, 15559, 15569, 15581, 15583, 15601, 15607, 15619, 15629, 15641, 15643,
+  15647, 15649, 15661, 15667, 15671, 15679, 15683, 15727, 15731, 15733, 15737, 15739,
+  15749, 15761, 15767, 15773, 15787, 15791, 15797, 15803, 15809, 15817, 15823, 15859,
+  15877, 15881, 15887, 15889, 15901, 15907, 15913, 15919, 15923, 15937, 15959, 15971,
+  15973, 15991, 16001, 16007, 16033, 16057, 16061, 16063, 16067, 16069, 16073, 16087,
+  16091, 16097, 16103, 16111, 16127, 16139, 16141, 16183, 16187, 16189, 16193, 16217,
+  16223, 16229, 16231, 16249, 16253, 16267, 16273, 16301, 16319, 16333, 16339, 16349,
+  16361, 16363, 16369, 16381, 16411, 16417, 16421, 16427, 16433, 16447, 16451, 16453,
+  16477, 16481, 16487, 16493, 16519, 16529, 16547, 16553, 16561, 16567, 16573, 16603,
+  16607, 16619, 16631, 16633, 16649, 16651, 16657, 16661, 16673, 16691, 16693, 16699,
+  16703, 16729, 16741, 16747, 16759, 16763, 16787, 16811, 16823, 16829, 16831, 16843,
+  16871, 16879, 16883, 16889, 16901, 16903, 16921, 16927, 16931, 16937, 16943, 16963,
+  16979, 16981, 16987, 16993, 17011, 17021, 17027, 17029, 17033, 17041, 17047, 17053,
+  17077, 17093, 17099, 17107, 17117, 17123, 17137, 17159, 17167, 17183, 17189, 17191,
+  17203, 17207, 17209, 17231, 17239, 17257, 17291, 17293, 17299, 17317, 17321, 17327,
+  17333, 17341, 17351, 17359, 17377, 17383, 17387, 17389, 17393, 17401, 17417, 17419,
+  17431, 17443, 17449, 17467, 17471, 17477, 17483, 17489, 17491, 17497, 17509, 17519,
+  17539, 17551, 17569, 17573, 17579, 17581, 17597, 17599, 17609, 17623, 17627, 17657,
+  17659, 17669, 17681, 17683, 17707, 17713, 17729, 17737, 17747, 17749, 17761, 17783,
+  17789, 17791, 17807, 17827, 17837, 17839, 17851, 17863, 17881, 17891, 17903, 17909,
+  17911, 17921, 17923, 17929, 17939, 17957, 17959, 17971, 17977, 17981, 17987, 17989,
+  18013, 18041, 18043, 18047, 18049, 18059, 18061, 18077, 18089, 18097, 18119, 18121,
+  18127, 18131, 18133, 18143, 18149, 18169, 18181, 18191, 18199, 18211, 18217, 18223,
+  18229, 18233, 18251, 18253, 18257, 18269, 18287, 18289, 18301, 18307, 18311, 18313,
+  18329, 18341, 18353, 18367, 18371, 18379, 18397, 18401, 18413, 18427, 18433, 18439,
+  18443, 18451, 18457, 18461, 18481, 18493, 18503, 18517, 18521, 18523, 18539, 18541,
+  18553, 18583, 18587, 18593, 18617, 18637, 18661, 18671, 18679, 18691, 18701, 18713,
+  18719, 18731, 18743, 18749, 18757, 18773, 18787, 18793, 18797, 18803, 18839, 18859,
+  18869, 18899, 18911, 18913, 18917, 18919, 18947, 18959, 18973, 18979, 19001, 19009,
+  19013, 19031, 19037, 19051, 19069, 19073, 19079, 19081, 19087, 19121, 19139, 19141,
+  19157, 19163, 19181, 19183, 19207, 19211, 19213, 19219, 19231, 19237, 19249, 19259,
+  19267, 19273, 19289, 19301, 19309, 19319, 19333, 19373, 19379, 19381, 19387, 19391,
+  19403, 19417, 19421, 19423, 19427, 19429, 19433, 19441, 19447, 19457, 19463, 19469,
+  19471, 19477, 19483, 19489, 19501, 19507, 19531, 19541, 19543, 19553, 19559, 19571,
+  19577, 19583, 19597, 19603, 19609, 19661, 19681, 19687, 19697, 19699, 19709, 19717,
+  19727, 19739, 19751, 19753, 19759, 19763, 19777, 19793, 19801, 19813, 19819, 19841,
+  19843, 19853, 19861, 19867, 19889, 19891, 19913, 19919, 19927, 19937, 19949, 19961,
+  19963, 19973, 19979, 19991, 19993, 19997, 20011, 20021, 20023, 20029, 20047, 20051,
+  20063, 20071, 20089, 20101, 20107, 20113, 20117, 20123, 20129, 20143, 20147, 20149,
+  20161, 20173, 20177, 20183, 20201, 20219, 20231, 20233, 20249, 20261, 20269, 20287,
+  20297, 20323, 20327, 20333, 20341, 20347, 20353, 20357, 20359, 20369, 20389, 20393,
+  20399, 20407, 20411, 20431, 20441, 20443, 20477, 20479, 20483, 20507, 20509, 20521,
+  20533, 20543, 20549, 20551, 20563, 20593, 20599, 20611, 20627, 20639, 20641, 20663,
+  20681, 20693, 20707, 20717, 20719, 20731, 20743, 20747, 20749, 20753, 20759, 20771,
+  20773, 20789, 20807, 20809, 20849, 20857, 20873, 20879, 20887, 20897, 20899, 20903,
+  20921, 20929, 20939, 20947, 20959, 20963, 20981, 20983, 21001, 21011, 21013, 21017,
+  21019, 21023, 21031, 21059, 21061, 21067, 21089, 21101, 21107, 21121, 21139, 21143,
+  21149, 21157, 21163, 21169, 21179, 21187, 21191, 21193, 21211, 21221, 21227, 21247,
+  21269, 21277, 21283, 21313, 21317, 21319, 21323, 21341, 21347, 21377, 21379, 21383,
+  21391, 21397, 21401, 21407, 21419, 21433, 21467, 21481, 21487, 21491, 21493, 21499,
+  21503, 21517, 21521, 21523, 21529, 21557, 21559, 21563, 21569, 21577, 21587, 21589,
+  21599, 21601, 21611, 21613, 21617, 21647, 21649, 21661, 21673, 21683, 21701, 21713,
+  21727, 21737, 21739, 21751, 21757, 21767, 21773, 21787, 21799, 21803, 21817, 21821,
+  21839, 21841, 21851, 21859, 21863, 21871, 21881, 21893, 21911, 21929, 21937, 21943,
+  21961, 21977, 21991, 21997, 22003, 22013, 22027, 22031, 22037, 22039, 22051, 22063,
+  22067, 22073, 22079, 22091, 22093, 22109, 22111, 22123, 22129, 22133, 22147, 22153,
+  22157, 22159, 22171, 22189, 22193, 22229, 22247, 22259, 22271, 22273, 22277, 22279,
+  22283, 22291, 22303, 22307, 22343, 22349, 22367, 22369, 22381, 22391, 22397, 22409,
+  22433, 22441, 22447, 22453, 22469, 22481, 22483, 22501, 22511, 22531, 22541, 22543,
+  22549, 22567, 22571, 22573, 22613, 22619, 22621, 22637, 22639, 22643, 22651, 22669,
+  22679, 22691, 22697, 22699, 22709, 22717, 22721, 22727, 22739, 22741, 22751, 22769,
+  22777, 22783, 22787, 22807, 22811, 22817, 22853, 22859, 22861, 22871, 22877, 22901,
+  22907, 22921, 22937, 22943, 22961, 22963, 22973, 22993, 23003, 23011, 23017, 23021,
+  23027, 23029, 23039, 23041, 23053, 23057, 23059, 23063, 23071, 23081, 23087, 23099,
+  23117, 23131, 23143, 23159, 23167, 23173, 23189, 23197, 23201, 23203, 23209, 23227,
+  23251, 23269, 23279, 23291, 23293, 23297, 23311, 23321, 23327, 23333, 23339, 23357,
+  23369, 23371, 23399, 23417, 23431, 23447, 23459, 23473, 23497, 23509, 23531, 23537,
+  23539, 23549, 23557, 23561, 23563, 23567, 23581, 23593, 23599, 23603, 23609, 23623,
+  23627, 23629, 23633, 23663, 23669, 23671, 23677, 23687, 23689, 23719, 23741, 23743,
+  23747, 23753, 23761, 23767, 23773, 23789, 23801, 23813, 23819, 23827, 23831, 23833,
+  23857, 23869, 23873, 23879, 23887, 23893, 23899, 23909, 23911, 23917, 23929, 23957,
+  23971, 23977, 23981, 23993, 24001, 24007, 24019, 24023, 24029, 24043, 24049, 24061,
+  24071, 24077, 24083, 24091, 24097, 24103, 24107, 24109, 24113, 24121, 24133, 24137,
+  24151, 24169, 24179, 24181, 24197, 24203, 24223, 24229, 24239, 24247, 24251, 24281,
+  24317, 24329, 24337, 24359, 24371, 24373, 24379, 24391, 24407, 24413, 24419, 24421,
+  24439, 24443, 24469, 24473, 24481, 24499, 24509, 24517, 24527, 24533, 24547, 24551,
+  24571, 24593, 24611, 24623, 24631, 24659, 24671, 24677, 24683, 24691, 24697, 24709,
+  24733, 24749, 24763, 24767, 24781, 24793, 24799, 24809, 24821, 24841, 24847, 24851,
+  24859, 24877, 24889, 24907, 24917, 24919, 24923, 24943, 24953, 24967, 24971, 24977,
+  24979, 24989, 25013, 25031, 25033, 25037, 25057, 25073, 25087, 25097, 25111, 25117,
+  25121, 25127, 25147, 25153, 25163, 25169, 25171, 25183, 25189, 25219, 25229, 25237,
+  25243, 25247, 25253, 25261, 25301, 25303, 25307, 25309, 25321, 25339, 25343, 25349,
+  25357, 25367, 25373, 25391, 25409, 25411, 25423, 25439, 25447, 25453, 25457, 25463,
+  25469, 25471, 25523, 25537, 25541, 25561, 25577, 25579, 25583, 25589, 25601, 25603,
+  25609, 25621, 25633, 25639, 25643, 25657, 25667, 25673, 25679, 25693, 25703, 25717,
+  25733, 25741, 25747, 25759, 25763, 25771, 25793, 25799, 25801, 25819, 25841, 25847,
+  25849, 25867, 25873, 25889, 25903, 25913, 25919, 25931, 25933, 25939, 25943, 25951,
+  25969, 25981, 25997, 25999, 26003, 26017, 26021, 26029, 26041, 26053, 26083, 26099,
+  26107, 26111, 26113, 26119, 26141, 26153, 26161, 26171, 26177, 26183, 26189, 26203,
+  26209, 26227, 26237, 26249, 26251, 26261, 26263, 26267, 26293, 26297, 26309, 26317,
+  26321, 26339, 26347, 26357, 26371, 26387, 26393, 26399, 26407, 26417, 26423, 26431,
+  26437, 26449, 26459, 26479, 26489, 26497, 26501, 26513, 26539, 26557, 26561, 26573,
+  26591, 26597, 26627, 26633, 26641, 26647, 26669, 26681, 26683, 26687, 26693, 26699,
+  26701, 26711, 26713, 26717, 26723, 26729, 26731, 26737, 26759, 26777, 26783, 26801,
+  26813, 26821, 26833, 26839, 26849, 26861, 26863, 26879, 26881, 26891, 26893, 26903,
+  26921, 26927, 26947, 26951, 26953, 26959, 26981, 26987, 26993, 27011, 27017, 27031,
+  27043, 27059, 27061, 27067, 27073, 27077, 27091, 27103, 27107, 27109, 27127, 27143,
+  27179, 27191, 27197, 27211, 27239, 27241, 27253, 27259, 27271, 27277, 27281, 27283,
+  27299, 27329, 27337, 27361, 27367, 27397, 27407, 27409, 27427, 27431, 27437, 27449,
+  27457, 27479, 27481, 27487, 27509, 27527, 27529, 27539, 27541, 27551, 27581, 27583,
+  27611, 27617, 27631, 27647, 27653, 27673, 27689, 27691, 27697, 27701, 27733, 27737,
+  27739, 27743, 27749, 27751, 27763, 27767, 27773, 27779, 27791, 27793, 27799, 27803,
+  27809, 27817, 27823, 27827, 27847, 27851, 27883, 27893, 27901, 27917, 27919, 27941,
+  27943, 27947, 27953, 27961, 27967, 27983, 27997, 28001, 28019, 28027, 28031, 28051,
+  28057, 28069, 28081, 28087, 28097, 28099, 28109, 28111, 28123, 28151, 28163, 28181,
+  28183, 28201, 28211, 28219, 28229, 28277, 28279, 28283, 28289, 28297, 28307, 28309,
+  28319, 28349, 28351, 28387, 28393, 28403, 28409, 28411, 28429, 28433, 28439, 28447,
+  28463, 28477, 28493, 28499, 28513, 28517, 28537, 28541, 28547, 28549, 28559, 28571,
+  28573, 28579, 28591, 28597, 28603, 28607, 28619, 28621, 28627, 28631, 28643, 28649,
+  28657, 28661, 28663, 28669, 28687, 28697, 28703, 28711, 28723, 28729, 28751, 28753,
+  28759, 28771, 28789, 28793, 28807, 28813, 28817, 28837, 28843, 28859, 28867, 28871,
+  28879, 28901, 28909, 28921, 28927, 28933, 28949, 28961, 28979, 29009, 29017, 29021,
+  29023, 29027, 29033, 29059, 29063, 29077, 29101, 29123, 29129, 29131, 29137, 29147,
+  29153, 29167, 29173, 29179, 29191, 29201, 29207, 29209, 29221, 29231, 29243, 29251,
+  29269, 29287, 29297, 29303, 29311, 29327, 29333, 29339, 29347, 29363, 29383, 29387,
+  29389, 29399, 29401, 29411, 29423, 29429, 29437, 29443, 29453, 29473, 29483, 29501,
+  29527, 29531, 29537, 29567, 29569, 29573, 29581, 29587, 29599, 29611, 29629, 29633,
+  29641, 29663, 29669, 29671, 29683, 29717, 29723, 29741, 29753, 29759, 29761, 29789,
+  29803, 29819, 29833, 29837, 29851, 29863, 29867, 29873, 29879, 29881, 29917, 29921,
+  29927, 29947, 29959, 29983, 29989, 30011, 30013, 30029, 30047, 30059, 30071, 30089,
+  30091, 30097, 30103, 30109, 30113, 30119, 30133, 30137, 30139, 30161, 30169, 30181,
+  30187, 30197, 30203, 30211, 30223, 30241, 30253, 30259, 30269, 30271, 30293, 30307,
+  30313, 30319, 30323, 30341, 30347, 30367, 30389, 30391, 30403, 30427, 30431, 30449,
+  30467, 30469, 30491, 30493, 30497, 30509, 30517, 30529, 30539, 30553, 30557, 30559,
+  30577, 30593, 30631, 30637, 30643, 30649, 30661, 30671, 30677, 30689, 30697, 30703,
+  30707, 30713, 30727, 30757, 30763, 30773, 30781, 30803, 30809, 30817, 30829, 30839,
+  30841, 30851, 30853, 30859, 30869, 30871, 30881, 30893, 30911, 30931, 30937, 30941,
+  30949, 30971, 30977, 30983, 31013, 31019, 31033, 31039, 31051, 31063, 31069, 31079,
+  31081, 31091, 31121, 31123, 31139, 31147, 31151, 31153, 31159, 31177, 31181, 31183,
+  31189, 31193, 31219, 31223, 31231, 31237, 31247, 31249, 31253, 31259, 31267, 31271,
+  31277, 31307, 31319, 31321, 31327, 31333, 31337, 31357, 31379, 31387, 31391, 31393,
+  31397, 31469, 31477, 31481, 31489, 31511, 31513, 31517, 31531, 31541, 31543, 31547,
+  31567, 31573, 31583, 31601, 31607, 31627, 31643, 31649, 31657, 31663, 31667, 31687,
+  31699, 31721, 31723, 31727, 31729, 31741, 31751, 31769, 31771, 31793, 31799, 31817,
+  31847, 31849, 31859, 31873, 31883, 31891, 31907, 31957, 31963, 31973, 31981, 31991,
+  32003, 32009, 32027, 32029, 32051, 32057, 32059, 32063, 32069, 32077, 32083, 32089,
+  32099, 32117, 32119, 32141, 32143, 32159, 32173, 32183, 32189, 32191, 32203, 32213,
+  32233, 32237, 32251, 32257, 32261, 32297, 32299, 32303, 32309, 32321, 32323, 32327,
+  32341, 32353, 32359, 32363, 32369, 32371, 32377, 32381, 32401, 32411, 32413, 32423,
+  32429, 32441, 32443, 32467, 32479, 32491, 32497, 32503, 32507, 32531, 32533, 32537,
+  32561, 32563, 32569, 32573, 32579, 32587, 32603, 32609, 32611, 32621, 32633, 32647,
+  32653, 32687, 32693, 32707, 32713, 32717, 32719, 32749, 32771, 32779, 32783, 32789,
+  32797, 32801, 32803, 32831, 32833, 32839, 32843, 32869, 32887, 32909, 32911, 32917,
+  32933, 32939, 32941, 32957, 32969, 32971, 32983, 32987, 32993, 32999, 33013, 33023,
+  33029, 33037, 33049, 33053, 33071, 33073, 33083, 33091, 33107, 33113, 33119, 33149,
+  33151, 33161, 33179, 33181, 33191, 33199, 33203, 33211, 33223, 33247, 33287, 33289,
+  33301, 33311, 33317, 33329, 33331, 33343, 33347, 33349, 33353, 33359, 33377, 33391,
+  33403, 33409, 33413, 33427, 33457, 33461, 33469, 33479, 33487, 33493, 33503, 33521,
+  33529, 33533, 33547, 33563, 33569, 33577, 33581, 33587, 33589, 33599, 33601, 33613,
+  33617, 33619, 33623, 33629, 33637, 33641, 33647, 33679, 33703, 33713, 33721, 33739,
+  33749, 33751, 33757, 33767, 33769, 33773, 33791, 33797, 33809, 33811, 33827, 33829,
+  33851, 33857, 33863, 33871, 33889, 33893, 33911, 33923, 33931, 33937, 33941, 33961,
+  33967, 33997, 34019, 34031, 34033, 34039, 34057, 34061, 34123, 34127, 34129, 34141,
+  34147, 34157, 34159, 34171, 34183, 34211, 34213, 34217, 34231, 34253, 34259, 34261,
+  34267, 34273, 34283, 34297, 34301, 34303, 34313, 34319, 34327, 34337, 34351, 34361,
+  34367, 34369, 34381, 34403, 34421, 34429, 34439, 34457, 34469, 34471, 34483, 34487,
+  34499, 34501, 34511, 34513, 34519, 34537, 34543, 34549, 34583, 34589, 34591, 34603,
+  34607, 34613, 34631, 34649, 34651, 34667, 34673, 34679, 34687, 34693, 34703, 34721,
+  34729, 34739, 34747, 34757, 34759, 34763, 34781, 34807, 34819, 34841, 34843, 34847,
+  34849, 34871, 34877, 34883, 34897, 34913, 34919, 34939, 34949, 34961, 34963, 34981,
+  35023, 35027, 35051, 35053, 35059, 35069, 35081, 35083, 35089, 35099, 35107, 35111,
+  35117, 35129, 35141, 35149, 35153, 35159, 35171, 35201, 35221, 35227, 35251, 35257,
+  35267, 35279, 35281, 35291, 35311, 35317, 35323, 35327, 35339, 35353, 35363, 35381,
+  35393, 35401, 35407, 35419, 35423, 35437, 35447, 35449, 35461, 35491, 35507, 35509,
+  35521, 35527, 35531, 35533, 35537, 35543, 35569, 35573, 35591, 35593, 35597, 35603,
+  35617, 35671, 35677, 35729, 35731, 35747, 35753, 35759, 35771, 35797, 35801, 35803,
+  35809, 35831, 35837, 35839, 35851, 35863, 35869, 35879, 35897, 35899, 35911, 35923,
+  35933, 35951, 35963, 35969, 35977, 35983, 35993, 35999, 36007, 36011, 36013, 36017,
+  36037, 36061, 36067, 36073, 36083, 36097, 36107, 36109, 36131, 36137, 36151, 36161,
+  36187, 36191, 36209, 36217, 36229, 36241, 36251, 36263, 36269, 36277, 36293, 36299,
+  36307, 36313, 36319, 36341, 36343, 36353, 36373, 36383, 36389, 36433, 36451, 36457,
+  36467, 36469, 36473, 36479, 36493, 36497, 36523, 36527, 36529, 36541, 36551, 36559,
+  36563, 36571, 36583, 36587, 36599, 36607, 36629, 36637, 36643, 36653, 36671, 36677,
+  36683, 36691, 36697, 36709, 36713, 36721, 36739, 36749, 36761, 36767, 36779, 36781,
+  36787, 36791, 36793, 36809, 36821, 36833, 36847, 36857, 36871, 36877, 36887, 36899,
+  36901, 36913, 36919, 36923, 36929, 36931, 36943, 36947, 36973, 36979, 36997, 37003,
+  37013, 37019, 37021, 37039, 37049, 37057, 37061, 37087, 37097, 37117, 37123, 37139,
+  37159, 37171, 37181, 37189, 37199, 37201, 37217, 37223, 37243, 37253, 37273, 37277,
+  37307, 37309, 37313, 37321, 37337, 37339, 37357, 37361, 37363, 37369, 37379, 37397,
+  37409, 37423, 37441, 37447, 37463, 37483, 37489, 37493, 37501, 37507, 37511, 37517,
+  37529, 37537, 37547, 37549, 37561, 37567, 37571, 37573, 37579, 37589, 37591, 37607,
+  37619, 37633, 37643, 37649, 37657, 37663, 37691, 37693, 37699, 37717, 37747, 37781,
+  37783, 37799, 37811, 37813, 37831, 37847, 37853, 37861, 37871, 37879, 37889, 37897,
+  37907, 37951, 37957, 37963, 37967, 37987, 37991, 37993, 37997, 38011, 38039, 38047,
+  38053, 38069, 38083, 38113, 38119, 38149, 38153, 38167, 38177, 38183, 38189, 38197,
+  38201, 38219, 38231, 38237, 38239, 38261, 38273, 38281, 38287, 38299, 38303, 38317,
+  38321, 38327, 38329, 38333, 38351, 38371, 38377, 38393, 38431, 38447, 38449, 38453,
+  38459, 38461, 38501, 38543, 38557, 38561, 38567, 38569, 38593, 38603, 38609, 38611,
+  38629, 38639, 38651, 38653, 38669, 38671, 38677, 38693, 38699, 38707, 38711, 38713,
+  38723, 38729, 38737, 38747, 38749, 38767, 38783, 38791, 38803, 38821, 38833, 38839,
+  38851, 38861, 38867, 38873, 38891, 38903, 38917, 38921, 38923, 38933, 38953, 38959,
+  38971, 38977, 38993, 39019, 39023, 39041, 39043, 39047, 39079, 39089, 39097, 39103,
+  39107, 39113, 39119, 39133, 39139, 39157, 39161, 39163, 39181, 39191, 39199, 39209,
+  39217, 39227, 39229, 39233, 39239, 39241, 39251, 39293, 39301, 39313, 39317, 39323,
+  39341, 39343, 39359, 39367, 39371, 39373, 39383, 39397, 39409, 39419, 39439, 39443,
+  39451, 39461, 39499, 39503, 39509, 39511, 39521, 39541, 39551, 39563, 39569, 39581,
+  39607, 39619, 39623, 39631, 39659, 39667, 39671, 39679, 39703, 39709, 39719, 39727,
+  39733, 39749, 39761, 39769, 39779, 39791, 39799, 39821, 39827, 39829, 39839, 39841,
+  39847, 39857, 39863, 39869, 39877, 39883, 39887, 39901, 39929, 39937, 39953, 39971,
+  39979, 39983, 39989, 40009, 40013, 40031, 40037, 40039, 40063, 40087, 40093, 40099,
+  40111, 40123, 40127, 40129, 40151, 40153, 40163, 40169, 40177, 40189, 40193, 40213,
+  40231, 40237, 40241, 40253, 40277, 40283, 40289, 40343, 40351, 40357, 40361, 40387,
+  40423, 40427, 40429, 40433, 40459, 40471, 40483, 40487, 40493, 40499, 40507, 40519,
+  40529, 40531, 40543, 40559, 40577, 40583, 40591, 40597, 40609, 40627, 40637, 40639,
+  40693, 40697, 40699, 40709, 40739, 40751, 40759, 40763, 40771, 40787, 40801, 40813,
+  40819, 40823, 40829, 40841, 40847, 40849, 40853, 40867, 40879, 40883, 40897, 40903,
+  40927, 40933, 40939, 40949, 40961, 40973, 40993, 41011, 41017, 41023, 41039, 41047,
+  41051, 41057, 41077, 41081, 41113, 41117, 41131, 41141, 41143, 41149, 41161, 41177,
+  41179, 41183, 41189, 41201, 41203, 41213, 41221, 41227, 41231, 41233, 41243, 41257,
+  41263, 41269, 41281, 41299, 41333, 41341, 41351, 41357, 41381, 41387, 41389, 41399,
+  41411, 41413, 41443, 41453, 41467, 41479, 41491, 41507, 41513, 41519, 41521, 41539,
+  41543, 41549, 41579, 41593, 41597, 41603, 41609, 41611, 41617, 41621, 41627, 41641,
+  41647, 41651, 41659, 41669, 41681, 41687, 41719, 41729, 41737, 41759, 41761, 41771,
+  41777, 41801, 41809, 41813, 41843, 41849, 41851, 41863, 41879, 41887, 41893, 41897,
+  41903, 41911, 41927, 41941, 41947, 41953, 41957, 41959, 41969, 41981, 41983, 41999,
+  42013, 42017, 42019, 42023, 42043, 42061, 42071, 42073, 42083, 42089, 42101, 42131,
+  42139, 42157, 42169, 42179, 42181, 42187, 42193, 42197, 42209, 42221, 42223, 42227,
+  42239, 42257, 42281, 42283, 42293, 42299, 42307, 42323, 42331, 42337, 42349, 42359,
+  42373, 42379, 42391, 42397, 42403, 42407, 42409, 42433, 42437, 42443, 42451, 42457,
+  42461, 42463, 42467, 42473, 42487, 42491, 42499, 42509, 42533, 42557, 42569, 42571,
+  42577, 42589, 42611, 42641, 42643, 42649, 42667, 42677, 42683, 42689, 42697, 42701,
+  42703, 42709, 42719, 42727, 42737, 42743, 42751, 42767, 42773, 42787, 42793, 42797,
+  42821, 42829, 42839, 42841, 42853, 42859, 42863, 42899, 42901, 42923, 42929, 42937,
+  42943, 42953, 42961, 42967, 42979, 42989, 43003, 43013, 43019, 43037, 43049, 43051,
+  43063, 43067, 43093, 43103, 43117, 43133, 43151, 43159, 43177, 43189, 43201, 43207,
+  43223, 43237, 43261, 43271, 43283, 43291, 43313, 43319, 43321, 43331, 43391, 43397,
+  43399, 43403, 43411, 43427, 43441, 43451, 43457, 43481, 43487, 43499, 43517, 43541,
+  43543, 43573, 43577, 43579, 43591, 43597, 43607, 43609, 43613, 43627, 43633, 43649,
+  43651, 43661, 43669, 43691, 43711, 43717, 43721, 43753, 43759, 43777, 43781, 43783,
+  43787, 43789, 43793, 43801, 43853, 43867, 43889, 43891, 43913, 43933, 43943, 43951,
+  43961, 43963, 43969, 43973, 43987, 43991, 43997, 44017, 44021, 44027, 44029, 44041,
+  44053, 44059, 44071, 44087, 44089, 44101, 44111, 44119, 44123, 44129, 44131, 44159,
+  44171, 44179, 44189, 44201, 44203, 44207, 44221, 44249, 44257, 44263, 44267, 44269,
+  44273, 44279, 44281, 44293, 44351, 44357, 44371, 44381, 44383, 44389, 44417, 44449,
+  44453, 44483, 44491, 44497, 44501, 44507, 44519, 44531, 44533, 44537, 44543, 44549,
+  44563, 44579, 44587, 44617, 44621, 44623, 44633, 44641, 44647, 44651, 44657, 44683,
+  44687, 44699, 44701, 44711, 44729, 44741, 44753, 44771, 44773, 44777, 44789, 44797,
+  44809, 44819, 44839, 44843, 44851, 44867, 44879, 44887, 44893, 44909, 44917, 44927,
+  44939, 44953, 44959, 44963, 44971, 44983, 44987, 45007, 45013, 45053, 45061, 45077,
+  45083, 45119, 45121, 45127, 45131, 45137, 45139, 45161, 45179, 45181, 45191, 45197,
+  45233, 45247, 45259, 45263, 45281, 45289, 45293, 45307, 45317, 45319, 45329, 45337,
+  45341, 45343, 45361, 45377, 45389, 45403, 45413, 45427, 45433, 45439, 45481, 45491,
+  45497, 45503, 45523, 45533, 45541, 45553, 45557, 45569, 45587, 45589, 45599, 45613,
+  45631, 45641, 45659, 45667, 45673, 45677, 45691, 45697, 45707, 45737, 45751, 45757,
+  45763, 45767, 45779, 45817, 45821, 45823, 45827, 45833, 45841, 45853, 45863, 45869,
+  45887, 45893, 45943, 45949, 45953, 45959, 45971, 45979, 45989, 46021, 46027, 46049,
+  46051, 46061, 46073, 46091, 46093, 46099, 46103, 46133, 46141, 46147, 46153, 46171,
+  46181, 46183, 46187, 46199, 46219, 46229, 46237, 46261, 46271, 46273, 46279, 46301,
+  46307, 46309, 46327, 46337, 46349, 46351, 46381, 46399, 46411, 46439, 46441, 46447,
+  46451, 46457, 46471, 46477, 46489, 46499, 46507, 46511, 46523, 46549, 46559, 46567,
+  46573, 46589, 46591, 46601, 46619, 46633, 46639, 46643, 46649, 46663, 46679, 46681,
+  46687, 46691, 46703, 46723, 46727, 46747, 46751, 46757, 46769, 46771, 46807, 46811,
+  46817, 46819, 46829, 46831, 46853, 46861, 46867, 46877, 46889, 46901, 46919, 46933,
+  46957, 46993, 46997, 47017, 47041, 47051, 47057, 47059, 47087, 47093, 47111, 47119,
+  47123, 47129, 47137, 47143, 47147, 47149, 47161, 47189, 47207, 47221, 47237, 47251,
+  47269, 47279, 47287, 47293, 47297, 47303, 47309, 47317, 47339, 47351, 47353, 47363,
+  47381, 47387, 47389, 47407, 47417, 47419, 47431, 47441, 47459, 47491, 47497, 47501,
+  47507, 47513, 47521, 47527, 47533, 47543, 47563, 47569, 47581, 47591, 47599, 47609,
+  47623, 47629, 47639, 47653, 47657, 47659, 47681, 47699, 47701, 47711, 47713, 47717,
+  47737, 47741, 47743, 47777, 47779, 47791, 47797, 47807, 47809, 47819, 47837, 47843,
+  47857, 47869, 47881, 47903, 47911, 47917, 47933, 47939, 47947, 47951, 47963, 47969,
+  47977, 47981, 48017, 48023, 48029, 48049, 48073, 48079, 48091, 48109, 48119, 48121,
+  48131, 48157, 48163, 48179, 48187, 48193, 48197, 48221, 48239, 48247, 48259, 48271,
+  48281, 48299, 48311, 48313, 48337, 48341, 48353, 48371, 48383, 48397, 48407, 48409,
+  48413, 48437, 48449, 48463, 48473, 48479, 48481, 48487, 48491, 48497, 48523, 48527,
+  48533, 48539, 48541, 48563, 48571, 48589, 48593, 48611, 48619, 48623, 48647, 48649,
+  48661, 48673, 48677, 48679, 48731, 48733, 48751, 48757, 48761, 48767, 48779, 48781,
+  48787, 48799, 48809, 48817, 48821, 48823, 48847, 48857, 48859, 48869, 48871, 48883,
+  48889, 48907, 48947, 48953, 48973, 48989, 48991, 49003, 49009, 49019, 49031, 49033,
+  49037, 49043, 49057, 49069, 49081, 49103, 49109, 49117, 49121, 49123, 49139, 49157,
+  49169, 49171, 49177, 49193, 49199, 49201, 49207, 49211, 49223, 49253, 49261, 49277,
+  49279, 49297, 49307, 49331, 49333, 49339, 49363, 49367, 49369, 49391, 49393, 49409,
+  49411, 49417, 49429, 49433, 49451, 49459, 49463, 49477, 49481, 49499, 49523, 49529,
+  49531, 49537, 49547, 49549, 49559, 49597, 49603, 49613, 49627, 49633, 49639, 49663,
+  49667, 49669, 49681, 49697, 49711, 49727, 49739, 49741, 49747, 49757, 49783, 49787,
+  49789, 49801, 49807, 49811, 49823, 49831, 49843, 49853, 49871, 49877, 49891, 49919,
+  49921, 49927, 49937, 49939, 49943, 49957, 49991, 49993, 49999, 50021, 50023, 50033,
+  50047, 50051, 50053, 50069, 50077, 50087, 50093, 50101, 50111, 50119, 50123, 50129,
+  50131, 50147, 50153, 50159, 50177, 50207, 50221, 50227, 50231, 50261, 50263, 50273,
+  50287, 50291, 50311, 50321, 50329, 50333, 50341, 50359, 50363, 50377, 50383, 50387,
+  50411, 50417, 50423, 50441, 50459, 50461, 50497, 50503, 50513, 50527, 50539, 50543,
+  50549, 50551, 50581, 50587, 50591, 50593, 50599, 50627, 50647, 50651, 50671, 50683,
+  50707, 50723, 50741, 50753, 50767, 50773, 50777, 50789, 50821, 50833, 50839, 50849,
+  50857, 50867, 50873, 50891, 50893, 50909, 50923, 50929, 50951, 50957, 50969, 50971,
+  50989, 50993, 51001, 51031, 51043, 51047, 51059, 51061, 51071, 51109, 51131, 51133,
+  51137, 51151, 51157, 51169, 51193, 51197, 51199, 51203, 51217, 51229, 51239, 51241,
+  51257, 51263, 51283, 51287, 51307, 51329, 51341, 51343, 51347, 51349, 51361, 51383,
+  51407, 51413, 51419, 51421, 51427, 51431, 51437, 51439, 51449, 51461, 51473, 51479,
+  51481, 51487, 51503, 51511, 51517, 51521, 51539, 51551, 51563, 51577, 51581, 51593,
+  51599, 51607, 51613, 51631, 51637, 51647, 51659, 51673, 51679, 51683, 51691, 51713,
+  51719, 51721, 51749, 51767, 51769, 51787, 51797, 51803, 51817, 51827, 51829, 51839,
+  51853, 51859, 51869, 51871, 51893, 51899, 51907, 51913, 51929, 51941, 51949, 51971,
+  51973, 51977, 51991, 52009, 52021, 52027, 52051, 52057, 52067, 52069, 52081, 52103,
+  52121, 52127, 52147, 52153, 52163, 52177, 52181, 52183, 52189, 52201, 52223, 52237,
+  52249, 52253, 52259, 52267, 52289, 52291, 52301, 52313, 52321, 52361, 52363, 52369,
+  52379, 52387, 52391, 52433, 52453, 52457, 52489, 52501, 52511, 52517, 52529, 52541,
+  52543, 52553, 52561, 52567, 52571, 52579, 52583, 52609, 52627, 52631, 52639, 52667,
+  52673, 52691, 52697, 52709, 52711, 52721, 52727, 52733, 52747, 52757, 52769, 52783,
+  52807, 52813, 52817, 52837, 52859, 52861, 52879, 52883, 52889, 52901, 52903, 52919,
+  52937, 52951, 52957, 52963, 52967, 52973, 52981, 52999, 53003, 53017, 53047, 53051,
+  53069, 53077, 53087, 53089, 53093, 53101, 53113, 53117, 53129, 53147, 53149, 53161,
+  53171, 53173, 53189, 53197, 53201, 53231, 53233, 53239, 53267, 53269, 53279, 53281,
+  53299, 53309, 53323, 53327, 53353, 53359, 53377, 53381, 53401, 53407, 53411, 53419,
+  53437, 53441, 53453, 53479, 53503, 53507, 53527, 53549, 53551, 53569, 53591, 53593,
+  53597, 53609, 53611, 53617, 53623, 53629, 53633, 53639, 53653, 53657, 53681, 53693,
+  53699, 53717, 53719, 53731, 53759, 53773, 53777, 53783, 53791, 53813, 53819, 53831,
+  53849, 53857, 53861, 53881, 53887, 53891, 53897, 53899, 53917, 53923, 53927, 53939,
+  53951, 53959, 53987, 53993, 54001, 54011, 54013, 54037, 54049, 54059, 54083, 54091,
+  54101, 54121, 54133, 54139, 54151, 54163, 54167, 54181, 54193, 54217, 54251, 54269,
+  54277, 54287, 54293, 54311, 54319, 54323, 54331, 54347, 54361, 54367, 54371, 54377,
+  54401, 54403, 54409, 54413, 54419, 54421, 54437, 54443, 54449, 54469, 54493, 54497,
+  54499, 54503, 54517, 54521, 54539, 54541, 54547, 54559, 54563, 54577, 54581, 54583,
+  54601, 54617, 54623, 54629, 54631, 54647, 54667, 54673, 54679, 54709, 54713, 54721,
+  54727, 54751, 54767, 54773, 54779, 54787, 54799, 54829, 54833, 54851, 54869, 54877,
+  54881, 54907, 54917, 54919, 54941, 54949, 54959, 54973, 54979, 54983, 55001, 55009,
+  55021, 55049, 55051, 55057, 55061, 55073, 55079, 55103, 55109, 55117, 55127, 55147,
+  55163, 55171, 55201, 55207, 55213, 55217, 55219, 55229, 55243, 55249, 55259, 55291,
+  55313, 55331, 55333, 55337, 55339, 55343, 55351, 55373, 55381, 55399, 55411, 55439,
+  55441, 55457, 55469, 55487, 55501, 55511, 55529, 55541, 55547, 55579, 55589, 55603,
+  55609, 55619, 55621, 55631, 55633, 55639, 55661, 55663, 55667, 55673, 55681, 55691,
+  55697, 55711, 55717, 55721, 55733, 55763, 55787, 55793, 55799, 55807, 55813, 55817,
+  55819, 55823, 55829, 55837, 55843, 55849, 55871, 55889, 55897, 55901, 55903, 55921,
+  55927, 55931, 55933, 55949, 55967, 55987, 55997, 56003, 56009, 56039, 56041, 56053,
+  56081, 56087, 56093, 56099, 56101, 56113, 56123, 56131, 56149, 56167, 56171, 56179,
+  56197, 56207, 56209, 56237, 56239, 56249, 56263, 56267, 56269, 56299, 56311, 56333,
+  56359, 56369, 56377, 56383, 56393, 56401, 56417, 56431, 56437, 56443, 56453, 56467,
+  56473, 56477, 56479, 56489, 56501, 56503, 56509, 56519, 56527, 56531, 56533, 56543,
+  56569, 56591, 56597, 56599, 56611, 56629, 56633, 56659, 56663, 56671, 56681, 56687,
+  56701, 56711, 56713, 56731, 56737, 56747, 56767, 56773, 56779, 56783, 56807, 56809,
+  56813, 56821, 56827, 56843, 56857, 56873, 56891, 56893, 56897, 56909, 56911, 56921,
+  56923, 56929, 56941, 56951, 56957, 56963, 56983, 56989, 56993, 56999, 57037, 57041,
+  57047, 57059, 57073, 57077, 57089, 57097, 57107, 57119, 57131, 57139, 57143, 57149,
+  57163, 57173, 57179, 57191, 57193, 57203, 57221, 57223, 57241, 57251, 57259, 57269,
+  57271, 57283, 57287, 57301, 57329, 57331, 57347, 57349, 57367, 57373, 57383, 57389,
+  57397, 57413, 57427, 57457, 57467, 57487, 57493, 57503, 57527, 57529, 57557, 57559,
+  57571, 57587, 57593, 57601, 57637, 57641, 57649, 57653, 57667, 57679, 57689, 57697,
+  57709, 57713, 57719, 57727, 57731, 57737, 57751, 57773, 57781, 57787, 57791, 57793,
+  57803, 57809, 57829, 57839, 57847, 57853, 57859, 57881, 57899, 57901, 57917, 57923,
+  57943, 57947, 57973, 57977, 57991, 58013, 58027, 58031, 58043, 58049, 58057, 58061,
+  58067, 58073, 58099, 58109, 58111, 58129, 58147, 58151, 58153, 58169, 58171, 58189,
+  58193, 58199, 58207, 58211, 58217, 58229, 58231, 58237, 58243, 58271, 58309, 58313,
+  58321, 58337, 58363, 58367, 58369, 58379, 58391, 58393, 58403, 58411, 58417, 58427,
+  58439, 58441, 58451, 58453, 58477, 58481, 58511, 58537, 58543, 58549, 58567, 58573,
+  58579, 58601, 58603, 58613, 58631, 58657, 58661, 58679, 58687, 58693, 58699, 58711,
+  58727, 58733, 58741, 58757, 58763, 58771, 58787, 58789, 58831, 58889, 58897, 58901,
+  58907, 58909, 58913, 58921, 58937, 58943, 58963, 58967, 58979, 58991, 58997, 59009,
+  59011, 59021, 59023, 59029, 59051, 59053, 59063, 59069, 59077, 59083, 59093, 59107,
+  59113, 59119, 59123, 59141, 59149, 59159, 59167, 59183, 59197, 59207, 59209, 59219,
+  59221, 59233, 59239, 59243, 59263, 59273, 59281, 59333, 59341, 59351, 59357, 59359,
+  59369, 59377, 59387, 59393, 59399, 59407, 59417, 59419, 59441, 59443, 59447, 59453,
+  59467, 59471, 59473, 59497, 59509, 59513, 59539, 59557, 59561, 59567, 59581, 59611,
+  59617, 59621, 59627, 59629, 59651, 59659, 59663, 59669, 59671, 59693, 59699, 59707,
+  59723, 59729, 59743, 59747, 59753, 59771, 59779, 59791, 59797, 59809, 59833, 59863,
+  59879, 59887, 59921, 59929, 59951, 59957, 59971, 59981, 59999, 60013, 60017, 60029,
+  60037, 60041, 60077, 60083, 60089, 60091, 60101, 60103, 60107, 60127, 60133, 60139,
+  60149, 60161, 60167, 60169, 60209, 60217, 60223, 60251, 60257, 60259, 60271, 60289,
+  60293, 60317, 60331, 60337, 60343, 60353, 60373, 60383, 60397, 60413, 60427, 60443,
+  60449, 60457, 60493, 60497, 60509, 60521, 60527, 60539, 60589, 60601, 60607, 60611,
+  60617, 60623, 60631, 60637, 60647, 60649, 60659, 60661, 60679, 60689, 60703, 60719,
+  60727, 60733, 60737, 60757, 60761, 60763, 60773, 60779, 60793, 60811, 60821, 60859,
+  60869, 60887, 60889, 60899, 60901, 60913, 60917, 60919, 60923, 60937, 60943, 60953,
+  60961, 61001, 61007, 61027, 61031, 61043, 61051, 61057, 61091, 61099, 61121, 61129,
+  61141, 61151, 61153, 61169, 61211, 61223, 61231, 61253, 61261, 61283, 61291, 61297,
+  61331, 61333, 61339, 61343, 61357, 61363, 61379, 61381, 61403, 61409, 61417, 61441,
+  61463, 61469, 61471, 61483, 61487, 61493, 61507, 61511, 61519, 61543, 61547, 61553,
+  61559, 61561, 61583, 61603, 61609, 61613, 61627, 61631, 61637, 61643, 61651, 61657,
+  61667, 61673, 61681, 61687, 61703, 61717, 61723, 61729, 61751, 61757, 61781, 61813,
+  61819, 61837, 61843, 61861, 61871, 61879, 61909, 61927, 61933, 61949, 61961, 61967,
+  61979, 61981, 61987, 61991, 62003, 62011, 62017, 62039, 62047, 62053, 62057, 62071,
+  62081, 62099, 62119, 62129, 62131, 62137, 62141, 62143, 62171, 62189, 62191, 62201,
+  62207, 62213, 62219, 62233, 62273, 62297, 62299, 62303, 62311, 62323, 62327, 62347,
+  62351, 62383, 62401, 62417, 62423, 62459, 62467, 62473, 62477, 62483, 62497, 62501,
+  62507, 62533, 62539, 62549, 62563, 62581, 62591, 62597, 62603, 62617, 62627, 62633,
+  62639, 62653, 62659, 62683, 62687, 62701, 62723, 62731, 62743, 62753, 62761, 62773,
+  62791, 62801, 62819, 62827, 62851, 62861, 62869, 62873, 62897, 62903, 62921, 62927,
+  62929, 62939, 62969, 62971, 62981, 62983, 62987, 62989, 63029, 63031, 63059, 63067,
+  63073, 63079, 63097, 63103, 63113, 63127, 63131, 63149, 63179, 63197, 63199, 63211,
+  63241, 63247, 63277, 63281, 63299, 63311, 63313, 63317, 63331, 63337, 63347, 63353,
+  63361, 63367, 63377, 63389, 63391, 63397, 63409, 63419, 63421, 63439, 63443, 63463,
+  63467, 63473, 63487, 63493, 63499, 63521, 63527, 63533, 63541, 63559, 63577, 63587,
+  63589, 63599, 63601, 63607, 63611, 63617, 63629, 63647, 63649, 63659, 63667, 63671,
+  63689, 63691, 63697, 63703, 63709, 63719, 63727, 63737, 63743, 63761, 63773, 63781,
+  63793, 63799, 63803, 63809, 63823, 63839, 63841, 63853, 63857, 63863, 63901, 63907,
+  63913, 63929, 63949, 63977, 63997, 64007, 64013, 64019, 64033, 64037, 64063, 64067,
+  64081, 64091, 64109, 64123, 64151, 64153, 64157, 64171, 64187, 64189, 64217, 64223,
+  64231, 64237, 64271, 64279, 64283, 64301, 64303, 64319, 64327, 64333, 64373, 64381,
+  64399, 64403, 64433, 64439, 64451, 64453, 64483, 64489, 64499, 64513, 64553, 64567,
+  64577, 64579, 64591, 64601, 64609, 64613, 64621, 64627, 64633, 64661, 64663, 64667,
+  64679, 64693, 64709, 64717, 64747, 64763, 64781, 64783, 64793, 64811, 64817, 64849,
+  64853, 64871, 64877, 64879, 64891, 64901, 64919, 64921, 64927, 64937, 64951, 64969,
+  64997, 65003, 65011, 65027, 65029, 65033, 65053, 65063, 65071, 65089, 65099, 65101,
+  65111, 65119, 65123, 65129, 65141, 65147, 65167, 65171, 65173, 65179, 65183, 65203,
+  65213, 65239, 65257, 65267, 65269, 65287, 65293, 65309, 65323, 65327, 65353, 65357,
+  65371, 65381, 65393, 65407, 65413, 65419, 65423, 65437, 65447, 65449, 65479, 65497,
+  65519, 65521
+};
+
+// bit j is set iff 2j+1 is coprime to PRESIEVE_PRODUCT
+const uint64_t presievePattern[PRESIEVE_WORDS] = {
+  0x816d129a64b4cb01ULL, 0x2196820d864a4c32ULL, 0xa49961225a0534c9ULL,
+  0x4a6882d12d86114cULL, 0x0c349961324a41b0ULL, 0x148a6894d225264bULL,
+  0x4b40b6186d30c225ULL, 0x65a4c92912d108a6ULL, 0xa2134496914c30d8ULL,
+  0xd82194cb49164229ULL, 0x28245b4484982d32ULL, 0x225865b083689683ULL,
+  0x9125265948b2894dULL, 0x69129a6434c36186ULL, 0x96430da45a0cb210ULL,
+  0x896522d22414c869ULL, 0x4192d305821b4ca4ULL, 0x16996922ca45b00aULL,
+  0x0b6894d324a6520cULL, 0x4cb6102c30d26194ULL, 0xa4cb0912d1298648ULL,
+  0x534c168964309a65ULL, 0x61b4c90986522d82ULL, 0xa45340a699283250ULL,
+  0x5a45b0c32984912cULL, 0x2d26494836894512ULL, 0x109a04b4ca618693ULL,
+  0xc30ca65848a2116dULL, 0x45225a2124c96896ULL, 0x12c22d861b04b499ULL,
+  0x992932ca45144a69ULL, 0x6890d301a65b0434ULL, 0xb2106d22d0658483ULL,
+  0xcb29161121a64b4cULL, 0x0c96986c10da2524ULL, 0xb48b4996422d2053ULL,
+  0x5b44a2990d32d060ULL, 0x64b0836196910ca0ULL, 0x245848960949324aULL,
+  0x9a60944a6184d32dULL, 0x05a6184cb2816c12ULL, 0x229a2530c94992c3ULL,
+  0xd22c86134c348965ULL, 0x29304a45b44a2992ULL, 0x04d12586520c3699ULL,
+  0x1865329245908b68ULL, 0x2906d129224b4cb6ULL, 0x96196c30d225a4c8ULL,
+  0xc90994522ca25348ULL, 0x4426990d12d861a4ULL, 0x90c36116832ca40bULL,
+  0x5948a4890d325a45ULL, 0x60b4c36086d32926ULL, 0xa65a0cb0916d0218ULL,
+  0xca2534c969968205ULL, 0x0d841b04b4986502ULL, 0x32c044a44a699253ULL,
+  0x5301a25b0c269169ULL, 0x6d32c225948b6094ULL, 0x14c129264a4c9618ULL,
+  0x914c30da61a40b29ULL, 0x4992502da2514c92ULL, 0x260929329860b4c3ULL,
+  0xc22996922c845b44ULL, 0x48b68949325a6590ULL, 0xb0cb4186d1252611ULL,
+  0x424cb29165029a44ULL, 0x2534486996c30c26ULL, 0x861a48b4192520daULL,
+  0x8a45a4486912d32cULL, 0x25a21b0436994132ULL, 0x32d26594896804c3ULL,
+  0xd129a64b48b4182cULL, 0x6c00d865a4c32814ULL, 0x961225a2434c1299ULL,
+  0x982d12d84134cb41ULL, 0x6896132ca45904a6ULL, 0xa4894d325260b0c3ULL,
+  0x8b6186d20d225908ULL, 0x4492916d128a6434ULL, 0x24496990c30da65aULL,
+  0x194cb4916422d821ULL, 0x05b44a4992532986ULL, 0x065b0c168869328aULL,
+  0x5265948b2894c225ULL, 0x29a6434cb2184932ULL, 0x30da44a0c32906d1ULL,
+  0x522d20434c961960ULL, 0x2d30d82194ca4996ULL, 0x969324a41b40a609ULL,
+  0x894d225a65a0c149ULL, 0x6106c32c261140b6ULL, 0xb0912d109a64944bULL,
+  0xc16816c309865a4cULL, 0x4cb0996522982534ULL, 0x344869829325821bULL,
+  0x5b0836986812c245ULL, 0x64948b28945325a4ULL, 0xa24b4c26186d12d2ULL,
+  0xca45a48b21169109ULL, 0x2da2504c86996c30ULL, 0x325861b44b489452ULL,
+  0x922ca45904a4912cULL, 0x4d320a6530c34992ULL, 0x82d20d0659403689ULL,
+  0x9169121864a4cb21ULL, 0x69864109a6524cb2ULL, 0x94986522da0530c9ULL,
+  0x0a6992c32d060b4cULL, 0x0832194930ca05b4ULL, 0x84816894d124a65bULL,
+  0x0b44b6184932d264ULL, 0x6584ca2916c129a4ULL, 0xa2134c94892c30daULL,
+  0xd861b0c348965221ULL, 0x24a45344a2992d22ULL, 0x105a653043699693ULL,
+  0x532d045808b6880dULL, 0x65129264b4cb6106ULL, 0x86c30da25a4ca291ULL,
+  0x996422c225348961ULL, 0x2990d32d861a4894ULL, 0x36916812ca41b44aULL,
+  0x8b40909325a6490cULL, 0x4c26086d32924594ULL, 0xa4cb2816d0298649ULL,
+  0x530c949968305a61ULL, 0x4130cb4986502da2ULL, 0x244b44a6992532c8ULL,
+  0x5825a0c26992930cULL, 0x28265948b6014d30ULL, 0x129a24a4c9618653ULL,
+  0xc30d261a4492904dULL, 0x0522da2514896916ULL, 0x92d129861b4cb099ULL,
+  0x196922c844b44268ULL, 0x68949325a45b0c32ULL, 0xb6086d12d265148aULL,
+  0xcb09165121a40b0cULL, 0x4c86996c20d264a0ULL, 0xb40b4196520ca253ULL,
+  0x5a4486992d30c861ULL, 0x61b0436914932c84ULL, 0x225948b68144321aULL,
+  0x9264b4c94182d32dULL, 0x0d865a4832816c12ULL, 0x025a2534c92994c2ULL,
+  0x912d86034c349961ULL, 0x6132ca45b04a6182ULL, 0x94d32526490c2699ULL,
+  0x186d305221948a68ULL, 0x2916d028a64b08b4ULL, 0x96994c30ca6524c9ULL,
+  0xcb4912420da21344ULL, 0x44a4912d32d86184ULL, 0xb0c368961328a45bULL,
+  0x594892884d225825ULL, 0x64348b6186832526ULL, 0xa45a0cb2904d129aULL,
+  0xd22434c16996410dULL, 0x0d801b4ca4196122ULL, 0x32ca45940a6192d3ULL,
+  0xd325a61a0c168969ULL, 0x6c22d261900b4894ULL, 0x12d128a6414cb610ULL,
+  0x892c309a65a44b09ULL, 0x0916522d82524c16ULL, 0xa69921321861b4cbULL,
+  0xc16986912ca05344ULL, 0x48b68944325245b0ULL, 0xb4ca2184d32d2649ULL,
+  0x4a4832116d109a24ULL, 0x0524c96196830ca6ULL, 0x861944a4994522daULL,
+  0x4a41944a6812c32dULL, 0x21a65b0c34992932ULL, 0x22c06514836894d2ULL,
+  0x9101a64b44b2186dULL, 0x6c10d86524cb2912ULL, 0x965229a0530c9690ULL,
+  0x982d32d020b4cb49ULL, 0x6196830c205b4486ULL, 0x92894d324a65b083ULL,
+  0x436184d12d265848ULL, 0x4cb21168129a60b4ULL, 0x14c84992c30da458ULL,
+  0x1b4c348965229a25ULL, 0x45b04a0992d22586ULL, 0xa6530c369969224aULL,
+  0xd245900b6884d124ULL, 0x29064a4cb6182530ULL, 0x309a25a4ca2916d1ULL,
+  0x522ca25348961964ULL, 0x0c32d061a4c94986ULL, 0x14832ca41b40a699ULL,
+  0x890d125a6590c329ULL, 0x6086932926494834ULL, 0xa2916d029844b4c3ULL,
+  0xc968968305a6584cULL, 0x0cb49865025a2134ULL, 0x344a6992522d841bULL,
+  0x5b0426996932c244ULL, 0x65848b6090d305a2ULL, 0xa64a4c96106d32c0ULL,
+  0xda21a44b29145129ULL, 0x2d22514c96906c30ULL, 0x329861b48b499242ULL,
+  0x902c845b4422890dULL, 0x49325a64b0c32996ULL, 0x86d12d245148b609ULL,
+  0x8165129a4490ca61ULL, 0x4996c305260a4cb2ULL, 0xb4196520da2530c8ULL,
+  0x486992d32c861348ULL, 0x0436990930ca45a4ULL, 0x948b6814c325861aULL,
+  0x4b4cb41825329265ULL, 0x65a4c12806d129a2ULL, 0xa2534892996c20d0ULL,
+  0xd86134cb09941225ULL, 0x2ca44b0426982d12ULL, 0x325244b0c3619613ULL,
+  0xd30d225948a6894dULL, 0x6d120a60b48b6086ULL, 0x94c20da65a0c9091ULL,
+  0x916422ca21344969ULL, 0x4992d30d861944b4ULL, 0x368169328845a44aULL,
+  0x8b28945221865b0cULL, 0x4c96186932522594ULL, 0xa08b2906c1292643ULL,
+  0x434c92994430da45ULL, 0x20b4c24996502d22ULL, 0xa45b40a6192930d8ULL,
+  0x5a6580c06996932cULL, 0x25261940b6894d32ULL
+};
+
+// pi(k * PI_CHECKPOINT_STRIDE)
+const uint64_t piCheckpoints[PI_CHECKPOINTS] = {
+            0,     3957809,     7603553,    11148380,    14630843,    18067928,
+     21470125,    24843811,    28192750,    31521999,    34832027,    38125588,
+     41405139,    44671153,    47924571,    51167426,    54400028,    57622141,
+     60835159,    64040181,    67237143,    70426037,    73608065,    76783820,
+     79952414,    83114437,    86271164,    89422336,    92566977,    95706381,
+     98842358,   101972147,   105097565,   108218044,   111335476,   114447354,
+    117554790,   120659533,   123760183,   126857081,   129949342,   133038172,
+    136124186,   139207080,   142286266,   145361105,   148434577,   151503798,
+    154570516,   157633846,   160694879,   163752941,   166808879,   169862599,
+    172912320,   175960453,   179006096,   182049056,   185088740,   188126374,
+    191161159,   194193943,   197225357,   200253501,   203280221,   206305742,
+    209327989,   212347043,   215366129,   218382596,   221397223,   224410064,
+    227419748,   230428470,   233435108,   236440180,   239442272,   242443982,
+    245443941,   248442200,   251437996,   254431422,   257425118,   260416123,
+    263406917,   266395416,   269382129,   272366747,   275349597,   278331397,
+    281312080,   284291127,   287269563,   290246139,   293221158,   296193608,
+    299164159,   302134836,   305104705,   308073301,   311039870,   314005185,
+    316968620,   319931229,   322891643,   325852200,   328811756,   331768512,
+    334724494,   337679008,   340633253,   343587443,   346538918,   349488137,
+    352436777,   355384621,   358332206,   361278569,   364223187,   367167514,
+    370110663,   373052672,   375992182,   378933151,   381871718,   384809523,
+    387745348,   390680925,   393615806,   396549018,   399481011,   402411719,
+    405342570,   408270954,   411199741,   414127561,   417054137,   419978113,
+    422903947,   425828739,   428751202,   431673300,   434594143,   437514371,
+    440434411,   443353882,   446271253,   449187773,   452103598,   455018720,
+    457932094,   460844895,   463757287,   466668383,   469579734,   472489221,
+    475397685,   478304746,   481212995,   484119436,   487025115,   489932289,
+    492835219,   495739365,   498641563,   501542902,   504445270,   507346041,
+    510245043,   513143153,   516040498,   518937598,   521835912,   524733295,
+    527628737,   530523521,   533417220,   536310379,   539202396,   542093655,
+    544984960,   547876044,   550765653,   553655185,   556542913,   559429967,
+    562318643,   565205568,   568090220,   570974655,   573858886,   576743123,
+    579626882,   582509448,   585390991,   588272130,   591152188,   594032556,
+    596911546,   599790310,   602668549,   605546358,   608422185,   611298955,
+    614174357,   617049795,   619923750,   622796740,   625670302,   628542168,
+    631412907,   634284580,   637155678,   640026570,   642896111,   645765270,
+    648634305,   651501656,   654370045,   657236390,   660103174,   662969575,
+    665833627,   668698916,   671562744,   674426328,   677290827,   680153131,
+    683014525,   685875068,   688736319,   691595889,   694457446,   697316366,
+    700176111,   703033721,   705891492,   708747986,   711604734,   714460416,
+    717315988,   720171523,   723025946,   725880189,   728733351,   731585982,
+    734438344,   737291124,   740142216,   742994181,   745845085,   748695628,
+    751545789,   754394920,   757243615,   760091796,   762939111,   765786429,
+    768633259,   771479230,   774324682,   777170351,   780015289,   782859115,
+    785703935,   788546838,   791390170,   794233695,   797075421,   799917221,
+    802758347,   805598328,   808439121,   811278449,   814118905,   816957588,
+    819796142,   822634092,   825471919,   828309269,   831145899,   833982104,
+    836817853,   839653968,   842489668,   845324899,   848160280,   850994698,
+    853829009,   856661908,   859494440,   862326938,   865157397,   867990144,
+    870821698,   873651106,   876482128,   879312035,   882140897,   884969747,
+    887798083,   890627196,   893455672,   896282599,   899110448,   901936987,
+    904763976,   907589294,   910415133,   913240643,   916064997,   918890376,
+    921714909,   924537969,   927362167,   930185548,   933007463,   935829716,
+    938651747,   941472577,   944293561,   947114020,   949935452,   952756482,
+    955576801,   958393981,   961213417,   964030963,   966849626,   969667594,
+    972484974,   975302689,   978119072,   980933513,   983750225,   986566244,
+    989381581,   992197593,   995012035,   997826345,  1000639279,  1003452486,
+   1006265827,  1009078491,  1011890413,  1014701775,  1017513636,  1020325193,
+   1023135921,  1025946735,  1028758101,  1031569090,  1034379981,  1037189064,
+   1039997486,  1042805406,  1045614506,  1048422803,  1051231183,  1054039306,
+   1056846966,  1059652892,  1062458896,  1065264721,  1068070508,  1070874766,
+   1073680637,  1076484539,  1079289710,  1082092545,  1084896855,  1087700498,
+   1090504037,  1093307761,  1096109878,  1098911701,  1101714828,  1104515578,
+   1107316198,  1110117389,  1112917592,  1115718758,  1118518498,  1121318027,
+   1124116614,  1126915974,  1129714768,  1132514100,  1135312059,  1138110358,
+   1140907863,  1143705752,  1146503408,  1149300544,  1152096990,  1154893755,
+   1157690400,  1160486265,  1163281327,  1166076026,  1168870145,  1171664928,
+   1174459251,  1177253771,  1180047820,  1182841173,  1185634470,  1188428223,
+   1191218794,  1194012052,  1196804343,  1199596828,  1202388438,  1205178793,
+   1207970029,  1210758914,  1213548989,  1216339106,  1219129763,  1221919210,
+   1224707825,  1227495745,  1230283144,  1233071628,  1235859269,  1238647545,
+   1241434413,  1244223106,  1247009616,  1249796767,  1252582886,  1255369570,
+   1258155266,  1260940975,  1263726478,  1266510503,  1269294918,  1272079363,
+   1274863965,  1277647535,  1280431831,  1283214229,  1285997101,  1288779721,
+   1291563513,  1294345938,  1297128471,  1299909102,  1302690752,  1305472046,
+   1308254829,  1311035864,  1313817124,  1316596583,  1319376005,  1322155901,
+   1324935742,  1327715483,  1330496122,  1333274565,  1336052991,  1338831972,
+   1341608585,  1344386284,  1347163648,  1349941355,  1352719268,  1355495847,
+   1358272163,  1361049541,  1363824346,  1366600272,  1369376000,  1372150761,
+   1374925685,  1377701582,  1380476239,  1383251568,  1386025814,  1388799588,
+   1391572698,  1394347146,  1397120459,  1399892389,  1402666293,  1405438405,
+   1408210886,  1410980894,  1413753173,  1416526474,  1419297815,  1422068636,
+   1424841060,  1427611312,  1430381358,  1433152305,  1435920889,  1438689721,
+   1441460057,  1444229037,  1446997142,  1449765833,  1452533492,  1455301233,
+   1458068976,  1460836605,  1463605463,  1466372291,  1469139040,  1471906177,
+   1474673341,  1477439962,  1480206279,  1482973014,  1485738961,  1488505145,
+   1491270413,  1494035800,  1496800877,  1499564753,  1502329729,  1505094788,
+   1507859399,  1510620967,  1513385155,  1516149980,  1518912507,  1521676039,
+   1524439493,  1527202529,  1529964541,  1532727384,  1535489021,  1538251682,
+   1541012866,  1543774007,  1546535870,  1549298711,  1552058577,  1554819609,
+   1557580618,  1560339970,  1563098932,  1565856831,  1568616884,  1571377141,
+   1574136992,  1576895697,  1579653725,  1582411865,  1585169626,  1587928016,
+   1590685282,  1593443502,  1596199602,  1598957716,  1601714557,  1604471804,
+   1607227054,  1609983651,  1612739532,  1615495862,  1618252477,  1621006980,
+   1623762746,  1626517364,  1629272920,  1632028764,  1634783396,  1637538268,
+   1640293122,  1643045145,  1645798703,  1648551947,  1651305826,  1654058800,
+   1656810703,  1659563631,  1662315981,  1665066829,  1667819204,  1670572445,
+   1673325002,  1676074210,  1678825006,  1681576739,  1684327433,  1687078520,
+   1689829930,  1692577869,  1695328529,  1698078703,  1700828803,  1703579221,
+   1706329521,  1709078186,  1711827574,  1714575085,  1717323250,  1720071303,
+   1722820937,  1725569212,  1728317328,  1731064649,  1733814247,  1736561429,
+   1739308361,  1742055048,  1744803209,  1747548552,  1750296096,  1753041948,
+   1755785833,  1758530806,  1761276250,  1764022651,  1766767570,  1769513169,
+   1772258070,  1775004000,  1777749436,  1780492216,  1783237144,  1785982122,
+   1788726030,  1791469591,  1794213590,  1796956619,  1799700998,  1802444008,
+   1805187130,  1807929180,  1810672843,  1813415631,  1816158498,  1818899850,
+   1821641783,  1824381652,  1827121689,  1829863339,  1832604295,  1835343979,
+   1838084942,  1840825057,  1843565610,  1846305406,  1849045256,  1851785315,
+   1854524772,  1857264250,  1860003915,  1862743564,  1865483037,  1868222684,
+   1870961322,  1873699130,  1876437828,  1879175663,  1881913670,  1884652315,
+   1887390192,  1890126268,  1892863918,  1895601425,  1898338391,  1901075923,
+   1903812355,  1906549145,  1909286849,  1912021728,  1914758173,  1917494377,
+   1920231108,  1922966376,  1925700801,  1928436203,  1931170682,  1933905229,
+   1936638769,  1939374362,  1942108611,  1944843517,  1947577111,  1950312320,
+   1953045824,  1955779267,  1958512148,  1961243850,  1963976913,  1966709094,
+   1969441497,  1972173490,  1974906005,  1977639219,  1980371059,  1983103852,
+   1985835410,  1988566210,  1991298338,  1994030146,  1996760977,  1999491349,
+   2002220714,  2004950840,  2007681240,  2010412364,  2013142939,  2015872269,
+   2018601698,  2021331793,  2024060647,  2026790265,  2029518493,  2032248370,
+   2034977214,  2037706626,  2040434636,  2043162573,  2045890361,  2048618050,
+   2051346000,  2054072697,  2056800223,  2059528572,  2062256014,  2064981980,
+   2067709807,  2070435944,  2073163707,  2075890303,  2078617693,  2081343859,
+   2084068897,  2086796293,  2089522639,  2092247518,  2094974026,  2097698513,
+   2100423153,  2103149385,  2105873221,  2108596975,  2111321110,  2114046347,
+   2116771150,  2119496386,  2122218892,  2124941329,  2127664866,  2130387790,
+   2133113576,  2135837075,  2138559265,  2141282882,  2144006222,  2146729659,
+   2149452424,  2152175169,  2154897614,  2157620030,  2160341417,  2163064013,
+   2165785788,  2168508197,  2171230018,  2173950187,  2176670465,  2179391706,
+   2182112798,  2184834112,  2187555306,  2190276279,  2192996930,  2195716947,
+   2198436302,  2201157088,  2203875972,  2206594586,  2209312945,  2212031263,
+   2214750511,  2217470163,  2220188305,  2222909007,  2225628124,  2228346000,
+   2231064612,  2233782766,  2236500175,  2239217560,  2241935239,  2244653283,
+   2247371655,  2250088777,  2252807418,  2255524571,  2258241572,  2260958932,
+   2263675172,  2266390726,  2269107957,  2271823935,  2274538978,  2277255052,
+   2279971328,  2282686293,  2285401426,  2288116521,  2290831355,  2293546113,
+   2296263056,  2298979245,  2301692091,  2304406853,  2307119609,  2309834634,
+   2312549293,  2315264073,  2317978462,  2320692407,  2323406933,  2326120353,
+   2328832619,  2331544734,  2334258297,  2336970998,  2339683992,  2342396918,
+   2345109448,  2347822119,  2350533739,  2353246248,  2355957122,  2358670547,
+   2361382742,  2364093743,  2366805320,  2369516393,  2372227772,  2374938481,
+   2377649968,  2380361211,  2383072023,  2385781604,  2388492078,  2391201979,
+   2393913038,  2396622409,  2399331967,  2402042020,  2404751772,  2407460924,
+   2410170698,  2412880842,  2415590738,  2418296912,  2421006471,  2423715111,
+   2426423945,  2429133843,  2431842163,  2434549640,  2437257818,  2439965050,
+   2442673274,  2445380789,  2448088713,  2450796322,  2453503297,  2456210520,
+   2458917875,  2461623546,  2464329011,  2467034724,  2469741518,  2472449274,
+   2475155754,  2477861003,  2480566825,  2483273101,  2485979261,  2488685473,
+   2491391506,  2494096737,  2496802372,  2499507764,  2502212803,  2504917926,
+   2507622924,  2510327148,  2513031632,  2515735807,  2518439876,  2521144624,
+   2523849367,  2526552691,  2529258067,  2531962173,  2534666339,  2537369460,
+   2540073711,  2542776583,  2545480396,  2548183132,  2550886132,  2553588449,
+   2556291696,  2558994418,  2561696007,  2564398490,  2567100157,  2569802347,
+   2572504405,  2575206446,  2577907913,  2580607898,  2583309387,  2586010581,
+   2588711539,  2591412819,  2594113937,  2596815088,  2599514746,  2602215334,
+   2604916891,  2607618063,  2610316491,  2613018020,  2615718797,  2618418724,
+   2621117694,  2623817089,  2626515005,  2629215603,  2631914347,  2634615175,
+   2637313511,  2640013035,  2642712247,  2645412064,  2648110221,  2650808512,
+   2653506618,  2656203775,  2658902274,  2661600230,  2664298770,  2666996232,
+   2669695512,  2672393205,  2675089993,  2677788272,  2680485382,  2683181888,
+   2685878857,  2688577151,  2691274042,  2693970981,  2696667510,  2699363855,
+   2702060228,  2704755632,  2707450780,  2710146728,  2712842012,  2715538609,
+   2718234014,  2720929270,  2723625683,  2726320635,  2729016316,  2731712376,
+   2734407174,  2737101897,  2739797613,  2742493841,  2745187056,  2747881529,
+   2750574640,  2753269776,  2755962435,  2758656234,  2761351086,  2764044004,
+   2766737717,  2769431045,  2772125305,  2774819486,  2777512467,  2780206370,
+   2782898374,  2785591147,  2788284408,  2790977926,  2793669056,  2796361527,
+   2799053050,  2801746135,  2804437858,  2807128788,  2809821271,  2812513824,
+   2815205298,  2817896180,  2820588243,  2823279030,  2825970995,  2828662903,
+   2831353826,  2834045832,  2836737104,  2839425856,  2842117374,  2844807611,
+   2847498273,  2850187614,  2852877906,  2855569142,  2858259711,  2860950382,
+   2863640124,  2866328984,  2869019439,  2871709096,  2874398515,  2877088130,
+   2879777756,  2882466657,  2885156661,  2887846973,  2890534876,  2893223285,
+   2895912308,  2898600580,  2901289660,  2903976852,  2906665636,  2909353361,
+   2912043206,  2914731643,  2917417992,  2920105556,  2922793507,  2925481037,
+   2928167978,  2930855105,  2933541149,  2936228168,  2938914160,  2941601365,
+   2944288148,  2946974971,  2949661097,  2952347530,  2955033541,  2957720130,
+   2960405998,  2963091608,  2965777774,  2968465377,  2971151796,  2973838060,
+   2976522910,  2979209829,  2981896176,  2984582385,  2987265729,  2989949704,
+   2992633748,  2995319385,  2998002571,  3000685715,  3003369753,  3006053223,
+   3008736848,  3011421531,  3014105695,  3016789777,  3019475336,  3022158265,
+   3024840757,  3027525811,  3030209497,  3032892308,  3035575506,  3038259091,
+   3040941406,  3043625284,  3046308196,  3048991308,  3051674319,  3054357113,
+   3057039820,  3059722598,  3062405838,  3065087174,  3067768704,  3070450960,
+   3073132102,  3075814511,  3078494576,  3081175650,  3083855758,  3086537223,
+   3089218931,  3091899735,  3094580914,  3097262955,  3099943479,  3102625083,
+   3105306478,  3107987247,  3110667460,  3113347951,  3116028382,  3118708108,
+   3121388303,  3124068417,  3126748687,  3129429300,  3132108467,  3134787883,
+   3137467889,  3140147254,  3142826343,  3145506745,  3148186229,  3150866220,
+   3153545213,  3156224163,  3158901763,  3161580395,  3164259968,  3166938286,
+   3169616937,  3172295943,  3174973041,  3177652249,  3180330337,  3183008569,
+   3185687884,  3188366298,  3191044545,  3193721936,  3196399443,  3199076502,
+   3201755709,  3204431118,  3207109140,  3209786904,  3212463377,  3215141435,
+   3217817382,  3220494274,  3223170640,  3225847604,  3228522967,  3231199535,
+   3233875702,  3236550735,  3239225625,  3241901278,  3244575822,  3247251945,
+   3249927518,  3252603440,  3255279730,  3257953653,  3260630455,  3263305627,
+   3265980520,  3268655904,  3271330947,  3274006554,  3276680631,  3279355612,
+   3282030614,  3284705937,  3287380664,  3290056410,  3292728965,  3295402952,
+   3298076295,  3300751011,  3303424530,  3306097991,  3308771148,  3311444653,
+   3314117312,  3316791321,  3319465684,  3322137815,  3324810874,  3327483405,
+   3330156271,  3332828578,  3335502210,  3338175451,  3340847882,  3343521082,
+   3346193285,  3348864753,  3351538274,  3354209820,  3356881431,  3359552496,
+   3362224792,  3364896166,  3367568337,  3370239843,  3372912275,  3375583874,
+   3378254862,  3380925785,  3383597725,  3386267949,  3388938275,  3391608880,
+   3394281714,  3396952316,  3399621658,  3402291917,  3404963065,  3407632245,
+   3410304234,  3412973845,  3415644201,  3418316023,  3420985138,  3423653866,
+   3426325221,  3428994928,  3431664007,  3434333479,  3437003622,  3439672849,
+   3442340577,  3445011314,  3447679764,  3450348111,  3453016388,  3455686019,
+   3458356162,  3461025240,  3463694243,  3466364182,  3469031698,  3471700106,
+   3474368585,  3477034826,  3479703548,  3482371943,  3485039326,  3487707629,
+   3490374300,  3493041801,  3495709336,  3498375630,  3501044208,  3503712284,
+   3506380398,  3509047979,  3511714134,  3514381202,  3517048757,  3519715017,
+   3522382483,  3525048681,  3527715642,  3530381004,  3533048292,  3535715769,
+   3538381978,  3541048103,  3543711976,  3546377251,  3549042980,  3551710683,
+   3554376575,  3557041889,  3559707890,  3562373725,  3565040257,  3567704203,
+   3570369274,  3573033394,  3575697754,  3578361729,  3581027044,  3583691924,
+   3586355954,  3589020490,  3591684112,  3594350060,  3597014705,  3599678925,
+   3602343508,  3605008222,  3607672916,  3610336620,  3613001398,  3615665523,
+   3618329432,  3620992495,  3623655525,  3626319028,  3628982820,  3631647497,
+   3634310720,  3636972363,  3639634258,  3642297548,  3644960832,  3647622676,
+   3650285462,  3652948774,  3655611953,  3658274251,  3660937524,  3663599806,
+   3666262226,  3668924822,  3671587093,  3674249145,  3676910041,  3679573537,
+   3682234312,  3684897222,  3687559633,  3690219916,  3692881249,  3695542000,
+   3698204551,  3700866527,  3703528860,  3706189329,  3708849642,  3711509778,
+   3714171809,  3716830902,  3719491305,  3722150893,  3724812030,  3727472487,
+   3730132580,  3732793306,  3735453977,  3738114341,  3740773960,  3743435015,
+   3746094482,  3748755014,  3751414957,  3754073884,  3756733955,  3759393352,
+   3762051952,  3764711084,  3767370700,  3770029927,  3772690071,  3775348900,
+   3778007699,  3780668002,  3783325712,  3785984450,  3788643020,  3791302320,
+   3793961193,  3796619185,  3799278024,  3801936853,  3804594766,  3807253321,
+   3809911842,  3812568973,  3815227869,  3817886982,  3820544148,  3823201202,
+   3825858781,  3828516090,  3831171818,  3833828758,  3836485639,  3839144229,
+   3841802095,  3844459046,  3847115454,  3849772199,  3852430149,  3855086951,
+   3857744016,  3860401841,  3863057028,  3865714914,  3868370983,  3871027674,
+   3873685019,  3876341345,  3878997209,  3881653816,  3884309783,  3886965812,
+   3889620617,  3892276901,  3894932168,  3897588342,  3900242488,  3902898354,
+   3905553600,  3908209429,  3910863610,  3913518874,  3916173461,  3918829355,
+   3921484127,  3924140297,  3926793639,  3929448587,  3932101997,  3934756466,
+   3937411006,  3940065723,  3942720532,  3945374467,  3948028889,  3950682793,
+   3953336948,  3955991344,  3958645403,  3961300007,  3963953459,  3966608095,
+   3969260037,  3971913859,  3974566494,  3977219510,  3979873686,  3982526542,
+   3985179240,  3987830970,  3990483814,  3993136770,  3995789642,  3998443983,
+   4001096080,  4003749297,  4006401767,  4009054381,  4011706954,  4014359037,
+   4017011011,  4019662942,  4022316002,  4024968116,  4027619764,  4030272238,
+   4032924162,  4035577004,  4038229405,  4040881180,  4043533788,  4046185745,
+   4048837843,  4051487914,  4054138248,  4056789254,  4059441842,  4062092924,
+   4064743589,  4067393465,  4070044873,  4072695439,  4075345964,  4077997231,
+   4080646050,  4083295817,  4085947419,  4088596998,  4091249215,  4093899276,
+   4096548869,  4099199114,  4101848519,  4104497903,  4107147482,  4109796935,
+   4112446915,  4115097353,  4117746990,  4120397025,  4123046748,  4125695395,
+   4128344576,  4130993941,  4133643035,  4136292803,  4138941823,  4141592189,
+   4144242188,  4146890112,  4149537806,  4152186394,  4154834834,  4157484381,
+   4160132884,  4162782856,  4165431573,  4168080776,  4170728285,  4173377466,
+   4176025657,  4178672683,  4181320277,  4183967973,  4186615512,  4189263878,
+   4191911530,  4194557818,  4197205410,  4199853191,  4202501253,  4205148061,
+   4207795454,  4210443751,  4213091003,  4215738229,  4218384037,  4221032274,
+   4223678685,  4226325560,  4228971529,  4231617538,  4234264243,  4236911298,
+   4239555921,  4242202342,  4244849957,  4247495227,  4250139899,  4252786586,
+   4255431090,  4258077726,  4260722271,  4263367922,  4266013250,  4268659047,
+   4271304285,  4273950160,  4276594588,  4279240351,  4281886047,  4284532061,
+   4287176356,  4289821930,  4292467683,  4295112874,  4297757276,  4300402091,
+   4303047495,  4305693154,  4308337793,  4310982568,  4313627010,  4316272276,
+   4318914963,  4321558336,  4324202301,  4326846664,  4329491225,  4332133557,
+   4334776601,  4337420351,  4340064325,  4342707311,  4345350662,  4347994795,
+   4350637781,  4353282033,  4355924523,  4358568279,  4361211011,  4363852699,
+   4366496458,  4369137936,  4371781725,  4374424087,  4377067379,  4379709609,
+   4382351336,  4384994420,  4387636480,  4390278770,  4392921875,  4395563000,
+   4398206032,  4400847613,  4403491928,  4406135041,  4408777644,  4411418708,
+   4414060146,  4416701919,  4419345089,  4421986259,  4424626698,  4427268361,
+   4429910381,  4432551439,  4435194459,  4437835372,  4440476534,  4443116967,
+   4445758421,  4448400241,  4451039448,  4453681265,  4456322300,  4458962791,
+   4461603501,  4464243415,  4466884272,  4469524824,  4472165575,  4474808034,
+   4477447858,  4480088688,  4482727975,  4485367906,  4488008771,  4490650141,
+   4493288625,  4495928928,  4498569507,  4501209123,  4503847765,  4506487149,
+   4509126435,  4511767991,  4514406615,  4517046349,  4519685371,  4522324661,
+   4524963457,  4527603502,  4530242275,  4532882660,  4535521975,  4538159730,
+   4540799475,  4543437844,  4546076959,  4548716854,  4551355924,  4553993972,
+   4556633281,  4559271954,  4561910282,  4564549110,  4567186884,  4569825019,
+   4572463522,  4575102629,  4577741476,  4580378699,  4583016982,  4585654384,
+   4588292686,  4590930701,  4593568236,  4596205901,  4598843922,  4601480670,
+   4604118196,  4606753925,  4609391617,  4612028935,  4614667705,  4617304286,
+   4619942224,  4622578960,  4625215301,  4627853274,  4630491352,  4633127543,
+   4635763637,  4638400800,  4641037635,  4643672976,  4646309389,  4648946454,
+   4651582359,  4654218968,  4656854266,  4659490845,  4662126209,  4664763528,
+   4667400716,  4670037409,  4672672227,  4675308476,  4677944803,  4680579336,
+   4683214675,  4685850999,  4688487757,  4691123852,  4693759139,  4696395078,
+   4699030631,  4701667093,  4704301989,  4706937514,  4709571183,  4712205435,
+   4714841311,  4717475221,  4720109452,  4722745676,  4725380253,  4728013986,
+   4730647610,  4733282390,  4735917707,  4738553359,  4741187712,  4743821480,
+   4746455365,  4749089012,  4751723948,  4754357697,  4756990534,  4759624297,
+   4762257916,  4764891611,  4767524082,  4770158175,  4772792256,  4775424628,
+   4778059080,  4780692140,  4783325939,  4785960031,  4788593523,  4791225762,
+   4793859608,  4796493217,  4799126189,  4801758014,  4804390661,  4807024280,
+   4809658426,  4812288982,  4814920692,  4817553926,  4820187114,  4822819441,
+   4825453763,  4828084589,  4830716377,  4833348049,  4835980280,  4838611730,
+   4841243747,  4843877437,  4846508935,  4849140231,  4851772002,  4854403349,
+   4857034289,  4859664801,  4862295893,  4864927868,  4867560427,  4870192069,
+   4872823820,  4875455674,  4878087213,  4880717746,  4883348023,  4885979901,
+   4888612098,  4891242179,  4893872518,  4896502436,  4899131862,  4901761756,
+   4904392873,  4907023803,  4909654783,  4912284426,  4914914330,  4917544030,
+   4920173792,  4922803885,  4925433301,  4928064319,  4930693557,  4933324597,
+   4935954793,  4938585408,  4941214391,  4943843698,  4946472741,  4949103169,
+   4951732969,  4954363307,  4956992098,  4959622951,  4962252052,  4964881937,
+   4967512224,  4970140994,  4972771648,  4975402322,  4978030744,  4980660954,
+   4983289839,  4985919867,  4988547756,  4991177021,  4993806541,  4996434619,
+   4999062979,  5001691237,  5004319471,  5006946475,  5009576862,  5012203790,
+   5014831188,  5017459914,  5020089042,  5022716456,  5025343848,  5027972793,
+   5030600358,  5033228812,  5035858389,  5038486037,  5041113848,  5043742351,
+   5046370198,  5048998462,  5051625281,  5054252678,  5056880259,  5059507437,
+   5062135191,  5064762029,  5067388840,  5070016168,  5072642618,  5075270824,
+   5077896714,  5080523885,  5083151021,  5085778546,  5088404455,  5091030861,
+   5093658151,  5096282894,  5098910437,  5101537655,  5104164515,  5106790420,
+   5109418210,  5112042446,  5114667107,  5117293335,  5119919134,  5122544881,
+   5125170256,  5127796245,  5130421788,  5133047470,  5135671959,  5138297214,
+   5140922669,  5143548607,  5146174119,  5148799492,  5151424971,  5154049753,
+   5156676407,  5159301034,  5161926135,  5164550828,  5167175026,  5169801302,
+   5172425119,  5175049075,  5177674164,  5180300910,  5182926877,  5185549959,
+   5188174892,  5190799786,  5193423590,  5196046528,  5198671505,  5201295719,
+   5203920677,  5206544866,  5209170515,  5211794449,  5214417978,  5217042136,
+   5219665919,  5222291265,  5224914358,  5227537577,  5230161281,  5232786533,
+   5235409855,  5238031983,  5240655795,  5243278602,  5245900800,  5248526203,
+   5251149245,  5253772261,  5256395210,  5259020342,  5261645133,  5264269320,
+   5266891140,  5269514387,  5272137514,  5274760174,  5277383111,  5280005644,
+   5282628219,  5285252040,  5287874099,  5290497904,  5293119033,  5295742020,
+   5298365619,  5300987335,  5303609480,  5306231141,  5308852843,  5311475161,
+   5314097511,  5316719916,  5319341258,  5321963865,  5324585527,  5327206510,
+   5329828570,  5332449892,  5335072889,  5337694326,  5340315566,  5342936143,
+   5345557055,  5348178692,  5350799379,  5353422076,  5356042174,  5358663489,
+   5361283923,  5363905258,  5366526076,  5369146918,  5371766743,  5374387946,
+   5377008495,  5379628485,  5382249665,  5384871631,  5387491959,  5390111656,
+   5392731671,  5395351906,  5397972433,  5400591976,  5403212727,  5405832701,
+   5408453328,  5411073456,  5413694089,  5416314362,  5418934534,  5421555308,
+   5424174588,  5426794211,  5429412781,  5432033158,  5434652016,  5437271640,
+   5439892995,  5442514158,  5445132727,  5447752032,  5450372147,  5452991771,
+   5455610019,  5458228190,  5460847403,  5463465204,  5466084640,  5468703314,
+   5471321901,  5473940922,  5476561470,  5479179871,  5481797278,  5484414553,
+   5487034127,  5489652943,  5492271352,  5494888485,  5497507238,  5500125450,
+   5502743670,  5505361208,  5507979457,  5510597631,  5513214677,  5515832589,
+   5518451416,  5521069543,  5523687165,  5526303708,  5528922234,  5531539601,
+   5534157303,  5536774817,  5539392929,  5542010286,  5544629020,  5547246653,
+   5549864215,  5552482108,  5555098344,  5557716066,  5560332261,  5562950746,
+   5565568790,  5568186584,  5570803590,  5573419744,  5576037108,  5578653589,
+   5581269927,  5583886789,  5586502348,  5589119138,  5591735540,  5594351677,
+   5596967592,  5599583849,  5602200372,  5604816338,  5607431651,  5610048318,
+   5612664170,  5615280059,  5617896521,  5620512991,  5623128895,  5625745970,
+   5628361931,  5630979056,  5633595261,  5636210580,  5638825811,  5641443046,
+   5644058705,  5646675470,  5649291453,  5651908005,  5654522588,  5657138445,
+   5659753301,  5662368590,  5664982786,  5667597985,  5670213188,  5672828039,
+   5675442013,  5678057094,  5680671338,  5683287186,  5685901618,  5688517038,
+   5691132178,  5693745278,  5696360571,  5698974324,  5701588311,  5704202734,
+   5706817469,  5709431943,  5712045912,  5714659538,  5717273385,  5719887248,
+   5722501986,  5725116998,  5727731295,  5730344216,  5732959754,  5735573235,
+   5738187455,  5740801219,  5743415787,  5746028386,  5748641473,  5751255788,
+   5753869402,  5756482040,  5759095695,  5761709247,  5764322672,  5766935384,
+   5769548029,  5772161223,  5774775684,  5777389699,  5780002598,  5782616053,
+   5785229281,  5787841503,  5790452919,  5793065483,  5795678074,  5798290702,
+   5800902862,  5803515883,  5806129359,  5808742117,  5811354559,  5813967690,
+   5816579224,  5819191640,  5821803786,  5824416358,  5827030161,  5829642182,
+   5832254376,  5834866573,  5837478669,  5840090827,  5842703887,  5845315420,
+   5847928553,  5850540606,  5853152276,  5855763236,  5858374326,  5860984880,
+   5863595701,  5866207266,  5868818795,  5871431235,  5874042128,  5876653753,
+   5879265188,  5881876750,  5884487502,  5887098509,  5889709504,  5892321736,
+   5894932586,  5897543191,  5900155141,  5902764006,  5905375420,  5907986807,
+   5910597970,  5913207522,  5915819684,  5918430908,  5921041236,  5923651299,
+   5926261218,  5928872604,  5931482044,  5934092877,  5936705379,  5939315572,
+   5941925973,  5944533979,  5947145132,  5949754439,  5952363057,  5954973270,
+   5957584634,  5960195593,  5962805809,  5965415417,  5968024812,  5970635264,
+   5973245990,  5975853916,  5978464317,  5981075486,  5983684596,  5986294894,
+   5988904601,  5991512804,  5994122802,  5996731359,  5999340638,  6001951525,
+   6004561393,  6007168710,  6009777901,  6012386409,  6014996066,  6017604530,
+   6020213488,  6022822220,  6025429593,  6028037181,  6030646652,  6033255478,
+   6035864005,  6038473686,  6041081245,  6043688116,  6046296090,  6048903803,
+   6051511992,  6054119791,  6056728385,  6059336481,  6061944704,  6064552888,
+   6067160595,  6069768472,  6072376043,  6074983258,  6077591914,  6080198160,
+   6082806028,  6085413963,  6088021757,  6090628414,  6093236568,  6095843970,
+   6098452124,  6101060156,  6103666496,  6106273235,  6108878950,  6111486354,
+   6114093424,  6116700530,  6119308145,  6121913260,  6124521189,  6127127655,
+   6129734866,  6132341972,  6134949109,  6137554496,  6140160297,  6142766856,
+   6145372971,  6147979357,  6150586896,  6153193217,  6155798298,  6158403898,
+   6161010021,  6163616625,  6166222184,  6168829634,  6171436395,  6174042384,
+   6176648574,  6179254060,  6181860249,  6184466618,  6187072101,  6189678046,
+   6192282886,  6194887508,  6197493315,  6200098744,  6202702993,  6205307283,
+   6207913118,  6210518472,  6213123043,  6215727960,  6218333690,  6220937753,
+   6223544851,  6226149355,  6228755980,  6231361782,  6233968185,  6236573470,
+   6239177998,  6241782825,  6244389359,  6246994155,  6249598264,  6252203327,
+   6254807346,  6257411399,  6260015962,  6262619846,  6265224779,  6267831114,
+   6270437610,  6273041683,  6275646415,  6278250693,  6280854076,  6283459617,
+   6286063921,  6288668808,  6291273787,  6293877641,  6296481317,  6299084785,
+   6301688860,  6304292001,  6306896331,  6309500013,  6312104361,  6314708130,
+   6317311303,  6319915278,  6322520369,  6325124362,  6327728104,  6330332148,
+   6332935020,  6335539253,  6338141758,  6340745402,  6343349458,  6345952248,
+   6348554608,  6351156451,  6353761067,  6356362631,  6358966231,  6361568603,
+   6364171327,  6366774242,  6369376570,  6371978843,  6374581449,  6377185310,
+   6379788292,  6382391061,  6384993620,  6387595456,  6390197663,  6392800262,
+   6395402214,  6398004046,  6400606316,  6403209017,  6405811942,  6408413616,
+   6411015240,  6413617008,  6416219983,  6418823168,  6421425702,  6424027237,
+   6426629997,  6429230602,  6431833036,  6434434922,  6437036416,  6439637064,
+   6442239653,  6444841019,  6447442555,  6450043654,  6452645463,  6455245456,
+   6457847005,  6460449008,  6463050406,  6465652071,  6468253620,  6470854963,
+   6473456111,  6476057757,  6478658276,  6481259264,  6483860177,  6486461687,
+   6489062784,  6491664955,  6494265482,  6496866068,  6499466094,  6502067086,
+   6504668040,  6507267020,  6509866508,  6512465975,  6515066780,  6517668370,
+   6520268903,  6522869585,  6525468428,  6528069177,  6530669293,  6533269155,
+   6535870862,  6538470110,  6541070211,  6543669023,  6546268726,  6548869572,
+   6551468653,  6554067228,  6556667461,  6559267929,  6561867098,  6564467140,
+   6567065811,  6569665027,  6572264378,  6574865138,  6577464710,  6580064913,
+   6582662898,  6585261945,  6587861994,  6590459700,  6593058607,  6595658483,
+   6598257626,  6600857011,  6603454780,  6606053361,  6608653234,  6611251936,
+   6613849933,  6616448812,  6619047787,  6621647754,  6624246535,  6626844053,
+   6629442337,  6632040938,  6634638998,  6637238578,  6639837841,  6642437735,
+   6645036535,  6647634903,  6650233045,  6652831133,  6655427799,  6658026206,
+   6660622715,  6663219047,  6665816838,  6668415630,  6671013740,  6673612425,
+   6676209699,  6678806851,  6681404686,  6684003129,  6686601753,  6689199392,
+   6691796360,  6694394102,  6696990891,  6699587363,  6702185043,  6704783176,
+   6707380955,  6709978458,  6712576203,  6715173567,  6717771622,  6720369242,
+   6722965330,  6725563595,  6728159867,  6730757223,  6733354178,  6735950697,
+   6738547004,  6741143797,  6743740818,  6746336379,  6748933952,  6751531224,
+   6754128035,  6756725482,  6759321159,  6761918609,  6764514695,  6767110563,
+   6769707520,  6772303569,  6774900911,  6777497679,  6780094242,  6782692103,
+   6785288260,  6787884967,  6790481205,  6793075683,  6795670672,  6798266588,
+   6800863747,  6803459952,  6806055466,  6808651937,  6811247334,  6813842594,
+   6816437928,  6819033205,  6821629126,  6824224958,  6826820966,  6829416561,
+   6832012377,  6834607403,  6837203805,  6839799885,  6842393123,  6844988484,
+   6847583550,  6850178505,  6852773506,  6855368489,  6857963860,  6860558696,
+   6863154682,  6865749485,  6868345740,  6870941224,  6873535317,  6876129404,
+   6878724465,  6881320066,  6883915832,  6886511555,  6889106157,  6891702370,
+   6894296829,  6896891560,  6899486689,  6902081015,  6904673481,  6907266927,
+   6909861130,  6912455786,  6915049996,  6917643613,  6920237847,  6922831126,
+   6925426957,  6928018861,  6930613127,  6933207407,  6935801514,  6938395154,
+   6940988162,  6943582533,  6946176851,  6948769453,  6951363879,  6953958066,
+   6956549597,  6959143468,  6961736781,  6964330732,  6966923711,  6969517172,
+   6972110036,  6974703714,  6977297811,  6979892673,  6982485570,  6985077444,
+   6987671014,  6990263713,  6992856649,  6995450219,  6998043200,  7000634713,
+   7003227547,  7005820761,  7008413761,  7011006571,  7013599244,  7016192567,
+   7018784975,  7021377755,  7023970872,  7026564132,  7029156888,  7031748735,
+   7034340477,  7036931875,  7039523751,  7042114577,  7044708638,  7047302534,
+   7049894490,  7052486516,  7055080459,  7057672143,  7060264197,  7062856721,
+   7065447845,  7068040021,  7070631901,  7073223911,  7075814892,  7078405302,
+   7080995984,  7083587427,  7086178784,  7088771929,  7091364025,  7093952866,
+   7096546258,  7099138224,  7101729502,  7104320850,  7106911652,  7109503939,
+   7112095409,  7114687478,  7117278783,  7119869976,  7122462463,  7125053597,
+   7127645494,  7130235266,  7132827811,  7135418279,  7138009369,  7140600257,
+   7143190255,  7145779945,  7148370928,  7150962072,  7153552900,  7156143646,
+   7158732867,  7161323784,  7163913538,  7166503045,  7169094286,  7171684567,
+   7174274878,  7176867187,  7179457187,  7182047279,  7184636632,  7187225498,
+   7189814574,  7192405440,  7194995349,  7197585473,  7200175984,  7202765853,
+   7205357947,  7207948459,  7210537326,  7213127855,  7215717366,  7218307508,
+   7220897205,  7223486882,  7226076255,  7228665793,  7231257480,  7233847800,
+   7236436679,  7239025716,  7241615164,  7244204703,  7246792014,  7249381801,
+   7251971352,  7254560643,  7257148966,  7259737989,  7262327347,  7264915253,
+   7267504145,  7270092441,  7272680964,  7275271211,  7277858201,  7280447296,
+   7283036866,  7285626426,  7288215088,  7290803666,  7293393773,  7295981575,
+   7298570140,  7301157492,  7303747061,  7306334795,  7308923428,  7311512163,
+   7314101221,  7316690533,  7319279243,  7321867334,  7324455346,  7327043223,
+   7329631825,  7332219865,  7334809180,  7337396091,  7339982098,  7342570639,
+   7345158598,  7347747028,  7350334638,  7352922603,  7355510801,  7358098905,
+   7360686458,  7363273812,  7365860589,  7368448584,  7371037016,  7373623777,
+   7376210536,  7378797069,  7381384889,  7383971534,  7386558188,  7389146260,
+   7391733494,  7394321579,  7396907786,  7399494610,  7402082257,  7404669005,
+   7407255640,  7409843728,  7412431330,  7415019092,  7417604437,  7420190754,
+   7422778297,  7425366180,  7427955027,  7430541064,  7433127324,  7435713968,
+   7438300155,  7440886490,  7443472737,  7446059437,  7448643595,  7451229517,
+   7453816386,  7456401923,  7458987282,  7461573939,  7464159429,  7466745052,
+   7469330358,  7471916767,  7474502800,  7477089568,  7479676381,  7482262989,
+   7484848728,  7487433160,  7490020374,  7492606297,  7495191683,  7497777798,
+   7500363649,  7502950358,  7505536433,  7508121716,  7510708073,  7513294493,
+   7515878952,  7518464250,  7521049788,  7523634731,  7526221471,  7528807000,
+   7531392035,  7533978202,  7536563749,  7539148858,  7541733151,  7544316945,
+   7546902160,  7549486751,  7552071582,  7554655865,  7557243553,  7559828058,
+   7562413361,  7564996295,  7567580654,  7570167331,  7572751434,  7575336510,
+   7577920493,  7580504850,  7583090633,  7585675779,  7588258541,  7590843097,
+   7593426135,  7596010648,  7598595854,  7601179584,  7603763852,  7606349130,
+   7608932720,  7611518132,  7614101774,  7616686959,  7619270879,  7621854767,
+   7624439319,  7627023851,  7629606968,  7632189584,  7634773917,  7637356907,
+   7639940514,  7642524830,  7645108495,  7647691480,  7650275000,  7652857684,
+   7655441177,  7658025413,  7660608711,  7663191840,  7665775203,  7668359481,
+   7670943811,  7673526608,  7676108103,  7678692273,  7681276557,  7683859350,
+   7686442623,  7689026291,  7691609385,  7694192879,  7696777206,  7699359930,
+   7701942741,  7704527953,  7707110326,  7709691248,  7712273946,  7714858428,
+   7717441632,  7720022620,  7722605304,  7725188829,  7727769533,  7730353052,
+   7732937176,  7735519679,  7738101346,  7740683853,  7743267544,  7745849918,
+   7748432257,  7751015034,  7753597830,  7756179829,  7758762059,  7761344612,
+   7763927577,  7766510876,  7769093253,  7771674856,  7774256706,  7776837411,
+   7779420477,  7782002873,  7784585249,  7787166915,  7789747063,  7792328706,
+   7794910754,  7797491632,  7800072486,  7802654646,  7805237221,  7807819356,
+   7810401522,  7812982237,  7815564758,  7818146289,  7820726915,  7823307838,
+   7825888114,  7828469799,  7831051266,  7833630890,  7836213146,  7838794512,
+   7841376455,  7843957455,  7846539162,  7849119390,  7851700000,  7854281560,
+   7856862388,  7859443453,  7862024199,  7864604974,  7867184878,  7869765360,
+   7872345857,  7874926876,  7877507355,  7880087587,  7882667098,  7885248209,
+   7887829735,  7890409183,  7892990015,  7895570532,  7898151759,  7900731542,
+   7903311626,  7905892462,  7908473392,  7911053995,  7913634815,  7916214707,
+   7918794953,  7921375117,  7923955435,  7926535295,  7929115838,  7931695077,
+   7934275587,  7936857228,  7939437302,  7942017309,  7944596890,  7947177456,
+   7949756828,  7952336161,  7954914502,  7957493092,  7960072819,  7962653214,
+   7965231950,  7967812001,  7970391361,  7972971523,  7975551460,  7978130973,
+   7980711855,  7983291989,  7985871551,  7988450348,  7991030867,  7993609887,
+   7996189487,  7998769593,  8001347604,  8003925914,  8006506001,  8009084627,
+   8011662555,  8014241873,  8016821121,  8019399246,  8021978160,  8024556356,
+   8027136096,  8029715870,  8032295041,  8034874061,  8037452170,  8040031628,
+   8042610601,  8045190155,  8047768601,  8050346521,  8052924430,  8055501645,
+   8058080569,  8060659722,  8063237905,  8065815846,  8068394658,  8070972503,
+   8073550658,  8076129340,  8078707350,  8081283680,  8083859229,  8086436575,
+   8089013358,  8091591310,  8094168988,  8096747069,  8099323934,  8101901276,
+   8104478448,  8107055926,  8109633072,  8112211269,  8114789706,  8117368002,
+   8119944397,  8122520522,  8125099012,  8127675403,  8130250654,  8132828767,
+   8135404653,  8137982663,  8140560635,  8143137947,  8145714695,  8148291337,
+   8150869929,  8153447241,  8156023168,  8158601154,  8161178098,  8163756533,
+   8166334487,  8168911584,  8171487898,  8174064619,  8176641977,  8179219410,
+   8181794044,  8184371399,  8186947364,  8189525146,  8192101524,  8194678839,
+   8197254215,  8199830425,  8202407098,  8204983199,  8207561844,  8210137355,
+   8212714110,  8215290974,  8217867168,  8220443798,  8223019951,  8225595851,
+   8228172194,  8230748553,  8233324649,  8235900841,  8238476181,  8241051645,
+   8243628111,  8246203953,  8248779192,  8251355851,  8253931882,  8256507637,
+   8259083804,  8261659238,  8264234677,  8266808849,  8269384817,  8271961433,
+   8274536541,  8277112215,  8279687316,  8282263626,  8284838978,  8287414634,
+   8289990658,  8292566036,  8295141517,  8297717547,  8300292669,  8302867725,
+   8305443941,  8308019969,  8310594679,  8313170364,  8315744880,  8318319963,
+   8320895451,  8323471171,  8326045617,  8328620523,  8331194047,  8333768452,
+   8336343978,  8338917819,  8341491352,  8344066028,  8346642050,  8349217022,
+   8351790960,  8354366950,  8356941035,  8359516711,  8362090748,  8364664403,
+   8367238393,  8369813580,  8372387483,  8374961315,  8377535098,  8380108526,
+   8382684053,  8385258821,  8387833670,  8390407078,  8392981048,  8395555071,
+   8398129776,  8400703853,  8403278905,  8405852210,  8408427046,  8410999719,
+   8413573159,  8416145959,  8418718885,  8421293804,  8423868264,  8426443429,
+   8429018228,  8431591123,  8434163627,  8436737443,  8439309540,  8441883864,
+   8444457354,  8447029698,  8449604292,  8452177817,  8454748596,  8457322271,
+   8459895264,  8462468794,  8465042714,  8467616015,  8470189471,  8472761352,
+   8475335133,  8477908869,  8480479874,  8483052231,  8485625201,  8488198867,
+   8490771383,  8493344682,  8495918344,  8498491140,  8501063304,  8503637444,
+   8506210367,  8508783630,  8511355505,  8513928497,  8516502147,  8519074263,
+   8521644594,  8524217102,  8526789302,  8529361131,  8531933662,  8534507130,
+   8537079745,  8539652002,  8542225930,  8544798493,  8547368647,  8549941019,
+   8552512939,  8555084909,  8557657312,  8560229099,  8562800878,  8565372714,
+   8567944355,  8570516407,  8573089193,  8575662381,  8578235447,  8580808334,
+   8583379962,  8585952376,  8588523786,  8591094942,  8593665995,  8596236904,
+   8598809924,  8601381657,  8603954228,  8606526284,  8609098645,  8611671474,
+   8614242043,  8616812329,  8619385163,  8621955570,  8624526393,  8627096811,
+   8629669167,  8632240655,  8634809832,  8637381080,  8639952509,  8642524686,
+   8645096222,  8647668117,  8650240025,  8652810135,  8655380506,  8657951176,
+   8660522635,  8663094261,  8665665022,  8668234972,  8670806960,  8673375454,
+   8675946640,  8678517892,  8681088303,  8683658699,  8686229965,  8688800525,
+   8691370702,  8693940159,  8696511548,  8699081989,  8701652776,  8704222234,
+   8706792646,  8709362806,  8711932788,  8714501851,  8717070938,  8719640849,
+   8722211930,  8724783249,  8727352524,  8729922972,  8732493606,  8735063020,
+   8737633613,  8740204855,  8742773581,  8745343186,  8747914210,  8750484207,
+   8753053721,  8755622309,  8758191900,  8760762756,  8763332750,  8765900722,
+   8768471239,  8771040917,  8773609192,  8776176867,  8778746765,  8781317570,
+   8783887794,  8786457938,  8789027605,  8791594557,  8794165385,  8796734529,
+   8799303122,  8801872544,  8804443207,  8807011907,  8809581357,  8812151144,
+   8814719587,  8817288855,  8819857803,  8822426665,  8824995833,  8827566249,
+   8830133926,  8832702846,  8835272362,  8837841701,  8840410756,  8842979042,
+   8845547872,  8848116056,  8850684923,  8853253591,  8855822741,  8858391451,
+   8860960033,  8863527723,  8866095343,  8868663640,  8871232963,  8873802724,
+   8876371063,  8878939285,  8881508836,  8884077446,  8886645336,  8889212953,
+   8891781465,  8894348620,  8896914891,  8899482027,  8902049303,  8904616728,
+   8907186081,  8909754607,  8912321974,  8914890654,  8917459179,  8920027369,
+   8922594025,  8925162904,  8927729141,  8930297066,  8932864500,  8935430778,
+   8937998931,  8940566939,  8943133801,  8945701703,  8948270534,  8950837948,
+   8953405025,  8955973234,  8958541220,  8961109488,  8963676764,  8966245504,
+   8968811748,  8971378159,  8973945622,  8976511373,  8979078574,  8981645158,
+   8984211924,  8986780124,  8989346458,  8991912846,  8994481061,  8997048599,
+   8999615027,  9002181553,  9004748444,  9007316067,  9009882111,  9012447941,
+   9015015197,  9017583239,  9020149688,  9022717455,  9025284288,  9027850766,
+   9030418609,  9032984263,  9035550945,  9038116842,  9040683253,  9043249301,
+   9045815829,  9048381058,  9050948493,  9053515292,  9056081415,  9058649609,
+   9061214624,  9063780969,  9066346906,  9068913620,  9071478759,  9074044692,
+   9076610487,  9079176441,  9081743115,  9084310371,  9086877560,  9089442625,
+   9092008625,  9094576486,  9097141268,  9099707815,  9102274930,  9104841251,
+   9107406711,  9109972809,  9112537401,  9115102665,  9117667389,  9120232537,
+   9122797250,  9125362651,  9127927298,  9130491649,  9133056964,  9135622018,
+   9138187656,  9140752360,  9143316864,  9145882217,  9148446868,  9151012899,
+   9153577619,  9156143024,  9158707541,  9161272505,  9163838578,  9166402624,
+   9168967490,  9171532370,  9174098723,  9176662403,  9179227419,  9181791770,
+   9184355234,  9186920505,  9189484331,  9192048592,  9194615424,  9197180014,
+   9199745550,  9202310061,  9204872691,  9207436683,  9210001538,  9212565991,
+   9215132413,  9217697130,  9220260894,  9222824233,  9225388365,  9227952904,
+   9230516397,  9233081968,  9235646685,  9238211223,  9240775158,  9243339063,
+   9245903359,  9248467978,  9251032026,  9253595703,  9256160643,  9258724823,
+   9261288605,  9263852126,  9266416767,  9268980485,  9271544483,  9274108508,
+   9276672875,  9279236818,  9281801563,  9284364203,  9286928260,  9289492161,
+   9292057465,  9294620970,  9297185583,  9299749757,  9302311999,  9304874906,
+   9307438499,  9310001559,  9312565902,  9315129200,  9317691035,  9320255061,
+   9322818733,  9325383038,  9327946644,  9330510777,  9333072551,  9335636244,
+   9338201519,  9340763574,  9343326233,  9345888278,  9348452207,  9351015259,
+   9353578158,  9356142856,  9358706842,  9361270287,  9363834034,  9366396530,
+   9368961019,  9371524502,  9374086810,  9376650268,  9379214490,  9381777082,
+   9384340093,  9386901987,  9389464349,  9392026178,  9394589390,  9397151371,
+   9399713462,  9402277055,  9404839449,  9407399532,  9409962284,  9412525064,
+   9415088552,  9417651109,  9420212131,  9422775538,  9425337882,  9427901456,
+   9430463644,  9433024366,  9435586848,  9438149985,  9440712404,  9443274769,
+   9445835618,  9448398650,  9450961727,  9453523831,  9456086237,  9458647830,
+   9461210000,  9463771816,  9466335254,  9468896376,  9471458296,  9474020064,
+   9476581146,  9479142329,  9481702294,  9484263119,  9486825276,  9489386571,
+   9491949508,  9494511786,  9497074528,  9499634682,  9502197345,  9504758832,
+   9507318463,  9509879884,  9512440629,  9515002214,  9517565200,  9520126848,
+   9522688580,  9525250762,  9527811424,  9530373789,  9532934470,  9535496017,
+   9538056421,  9540616870,  9543178094,  9545739451,  9548300332,  9550860831,
+   9553422319,  9555982383,  9558542731,  9561103707,  9563665363,  9566226179,
+   9568787168,  9571348181,  9573908996,  9576468118,  9579028265,  9581588873,
+   9584150573,  9586711352,  9589271457,  9591832734,  9594393352,  9596953249,
+   9599512761,  9602073256,  9604633540,  9607194732,  9609755664,  9612315443,
+   9614874653,  9617436295,  9619995569,  9622555388,  9625115333,  9627674166,
+   9630234967,  9632794590,  9635354329,  9637913622,  9640472707,  9643031981,
+   9645590560,  9648152357,  9650712074,  9653272615,  9655831197,  9658390833,
+   9660949876,  9663510481,  9666070001,  9668629580,  9671188266,  9673747754,
+   9676306644,  9678865836,  9681424428,  9683982320,  9686541649,  9689101143,
+   9691661729,  9694220401,  9696780646,  9699339517,  9701899246,  9704459656,
+   9707018772,  9709578446,  9712136643,  9714696309,  9717256533,  9719814515,
+   9722373646,  9724933176,  9727491355,  9730050635,  9732610356,  9735169494,
+   9737727824,  9740286483,  9742846316,  9745404014,  9747962721,  9750522502,
+   9753082083,  9755640493,  9758200492,  9760758118,  9763316005,  9765874535,
+   9768433547,  9770992101,  9773550856,  9776109187,  9778667451,  9781226239,
+   9783784913,  9786343278,  9788902394,  9791460738,  9794019642,  9796578020,
+   9799134937,  9801693210,  9804252674,  9806810704,  9809368478,  9811926346,
+   9814483145,  9817041496,  9819598905,  9822156842,  9824715037,  9827272009,
+   9829829565,  9832388417,  9834945493,  9837502865,  9840060479,  9842618129,
+   9845177481,  9847733639,  9850291298,  9852849438,  9855407445,  9857964819,
+   9860522553,  9863080672,  9865637552,  9868196177,  9870752261,  9873311240,
+   9875869325,  9878426079,  9880983350,  9883538724,  9886097137,  9888654808,
+   9891211640,  9893769173,  9896325726,  9898882785,  9901440273,  9903996570,
+   9906554833,  9909110873,  9911668041,  9914223916,  9916781413,  9919337030,
+   9921893606,  9924449549,  9927007675,  9929565321,  9932122559,  9934679081,
+   9937235861,  9939792181,  9942347710,  9944906643,  9947464734,  9950021809,
+   9952579095,  9955135664,  9957693104,  9960249372,  9962807326,  9965363948,
+   9967920487,  9970476626,  9973032457,  9975588599,  9978145435,  9980700697,
+   9983256992,  9985813793,  9988371655,  9990927909,  9993482512,  9996038004,
+   9998593578, 10001148069, 10003705192, 10006261190, 10008817160, 10011374423,
+  10013929193, 10016485363, 10019042730, 10021597898, 10024154665, 10026711220,
+  10029267042, 10031822944, 10034378954, 10036935062, 10039491710, 10042047627,
+  10044603255, 10047159080, 10049713727, 10052269852, 10054826748, 10057382010,
+  10059938753, 10062495681, 10065052900, 10067607171, 10070163032, 10072718249,
+  10075274450, 10077830081, 10080385442, 10082940054, 10085494918, 10088051060,
+  10090606737, 10093162384, 10095717646, 10098272534, 10100827616, 10103383607,
+  10105938923, 10108495163, 10111050215, 10113605255, 10116159552, 10118713056,
+  10121267741, 10123823387, 10126377722, 10128932446, 10131485262, 10134041472,
+  10136595465, 10139150872, 10141704820, 10144257789, 10146813492, 10149368880,
+  10151924459, 10154478207, 10157032277, 10159586123, 10162140716, 10164695237,
+  10167250647, 10169805447, 10172359020, 10174913608, 10177466593, 10180022191,
+  10182575345, 10185130054, 10187685063, 10190240079, 10192794665, 10195347585,
+  10197900729, 10200455614, 10203011121, 10205565132, 10208119339, 10210673242,
+  10213226856, 10215782063, 10218336116, 10220891775, 10223444733, 10225997852,
+  10228551751, 10231105387, 10233658882, 10236213262, 10238766736, 10241321044,
+  10243874850, 10246427391, 10248981639, 10251536564, 10254089323, 10256642630,
+  10259195779, 10261748591, 10264301554, 10266855819, 10269410974, 10271963551,
+  10274517634, 10277071323, 10279624619, 10282177228, 10284731233, 10287283978,
+  10289837061, 10292391241, 10294944313, 10297497912, 10300053503, 10302605872,
+  10305158872, 10307712950, 10310266590, 10312819386, 10315373139, 10317925423,
+  10320478131, 10323031217, 10325584062, 10328136965, 10330689901, 10333241447,
+  10335793686, 10338346161, 10340899953, 10343452269, 10346006138, 10348558130,
+  10351111748, 10353664966, 10356217338, 10358769773, 10361321810, 10363874409,
+  10366424924, 10368977396, 10371531764, 10374085461, 10376638162, 10379191620,
+  10381744005, 10384296303, 10386850818, 10389403694, 10391955992, 10394507632,
+  10397060863, 10399613379, 10402165204, 10404718587, 10407269138, 10409821340,
+  10412373081, 10414924444, 10417477765, 10420030612, 10422583711, 10425136055,
+  10427687736, 10430239397, 10432791023, 10435342829, 10437894516, 10440447028,
+  10443000189, 10445551591, 10448101661, 10450653298, 10453204066, 10455756067,
+  10458307790, 10460858556, 10463410759, 10465961230, 10468513023, 10471065955,
+  10473616846, 10476166891, 10478717776, 10481270093, 10483820296, 10486372717,
+  10488922945, 10491474266, 10494025787, 10496579146, 10499130652, 10501681618,
+  10504232236, 10506783514, 10509334694, 10511885671, 10514436128, 10516985451,
+  10519535368, 10522086258, 10524637668, 10527189487, 10529741471, 10532292331,
+  10534843581, 10537393773, 10539944975, 10542496020, 10545045213, 10547595961,
+  10550148026, 10552698569, 10555249408, 10557800106, 10560350439, 10562900158,
+  10565451525, 10568002082, 10570551531, 10573102617, 10575652858, 10578204025,
+  10580755310, 10583305317, 10585856090, 10588406534, 10590955857, 10593507459,
+  10596057100, 10598607240, 10601159075, 10603709408, 10606258660, 10608809126,
+  10611356948, 10613907344, 10616457561, 10619007735, 10621557349, 10624107786,
+  10626658810, 10629209168, 10631759514, 10634309177, 10636859413, 10639410592,
+  10641961048, 10644510900, 10647060881, 10649611614, 10652160247, 10654710496,
+  10657260513, 10659812503, 10662360756, 10664910843, 10667460847, 10670010220,
+  10672560220, 10675108535, 10677658728, 10680208522, 10682758072, 10685307546,
+  10687857613, 10690406102, 10692956370, 10695504831, 10698053938, 10700603706,
+  10703154404, 10705702836, 10708252712, 10710802037, 10713351602, 10715902264,
+  10718451892, 10721000893, 10723550405, 10726100415, 10728649135, 10731198843,
+  10733748362, 10736296767, 10738845163, 10741393581, 10743942661, 10746493195,
+  10749042145, 10751592522, 10754139074, 10756688073, 10759237087, 10761786760,
+  10764335029, 10766884919, 10769432920, 10771980512, 10774530050, 10777077777,
+  10779626323, 10782174272, 10784723548, 10787270395, 10789820277, 10792369700,
+  10794917974, 10797466835, 10800014829, 10802563473, 10805112348, 10807660777,
+  10810209077, 10812757438, 10815306992, 10817855094, 10820402131, 10822949731,
+  10825497159, 10828045980, 10830593841, 10833140780, 10835688524, 10838237499,
+  10840785910, 10843333973, 10845881694, 10848428997, 10850976790, 10853523444,
+  10856071115, 10858621503, 10861170730, 10863718638, 10866266172
+};
+
+#endif
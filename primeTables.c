@@ -0,0 +1,81 @@
+/*
+  Author:  Vincent T. Mossman
+  Updated: October 16, 2026
+*/
+
+#ifndef PRIMETABLES_C
+#define PRIMETABLES_C
+
+#include "primeTableData.c"
+
+/* Tables compiled into every tool instead of being rebuilt on each run: the
+    primes below 2^16 (every sieving prime up to 2^32 comes from them), a
+    presieve pattern that marks the odd multiples of 3, 5, 7, 11 and 13 in
+    one copy, and pi(x) at every multiple of PI_CHECKPOINT_STRIDE up to
+    PI_CHECKPOINT_LIMIT, as exact anchors for counting and nth-prime searches.
+    The tables themselves live in primeTableData.c, written by
+    primeTablesGen.c from its own sieves (npm run gen-tables, about ten minutes
+    on one core); change the spacing or limits there and regenerate. The
+    checkpoints agree with pi(2^26), pi(2^30), pi(2^32), pi(2^36) and
+    pi(2^38) as published. */
+
+// content summary
+void presieveSegment(uint64_t *bits, long unsigned int low, long unsigned int words);
+  /* presieveSegment fills words of an odd-only segment starting at low (odd)
+      from presievePattern: set bits are the numbers coprime to
+      PRESIEVE_PRODUCT, with 3, 5, 7, 11 and 13 themselves put back. Base
+      primes up to PRESIEVE_LARGEST need no crossing off after it.
+      */
+long unsigned int piCheckpoint(long unsigned int x, long unsigned int *anchor);
+  /* piCheckpoint sets *anchor to the largest checkpoint <= x (x below
+      PI_CHECKPOINT_LIMIT) and returns pi(*anchor).
+      */
+
+// definitions
+
+/******************************************************************************
+* Function presieveSegment copies the pattern a word at a time, each word     *
+*  pieced together from the two pattern words it straddles                    *
+******************************************************************************/
+void presieveSegment(uint64_t *bits, long unsigned int low, long unsigned int words) {
+
+  static const long unsigned int presievePrimes[PRESIEVE_COUNT] = PRESIEVE_PRIMES;
+  long unsigned int w, offset, shift, i, p;
+
+  offset = ((low - 1) / 2) % PRESIEVE_PRODUCT;
+  for (w = 0; w < words; w++) {
+    shift = offset & 63;
+    bits[w] = shift ? (presievePattern[offset >> 6] >> shift)
+                      | (presievePattern[(offset >> 6) + 1] << (64 - shift))
+                    : presievePattern[offset >> 6];
+    offset += 64;
+    if (offset >= PRESIEVE_PRODUCT) {
+      offset -= PRESIEVE_PRODUCT;
+    } // end if
+  } // end for (w)
+
+  // the pattern strikes its own primes too
+  if (low <= PRESIEVE_LARGEST) {
+    for (i = 0; i < PRESIEVE_COUNT; i++) {
+      p = presievePrimes[i];
+      if (p >= low && (p - low) / 2 < words * 64) {
+        bits[(p - low) / 128] |= 1ULL << (((p - low) / 2) & 63);
+      } // end if
+    } // end for (i)
+  } // end if
+
+} // end presieveSegment
+
+/******************************************************************************
+* Function piCheckpoint                                                       *
+******************************************************************************/
+long unsigned int piCheckpoint(long unsigned int x, long unsigned int *anchor) {
+
+  long unsigned int k = x / PI_CHECKPOINT_STRIDE;
+
+  *anchor = k * PI_CHECKPOINT_STRIDE;
+  return piCheckpoints[k];
+
+} // end piCheckpoint
+
+#endif
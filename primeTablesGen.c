@@ -0,0 +1,258 @@
+/* Some fun with prime numbers. Program generates primeTableData.c, the
+    literal tables behind primeTables.c: the primes below SMALL_LIMIT, the
+    presieve pattern for the odd primes up to PRESIEVE_LARGEST, and pi(x) at
+    every multiple of 2^CHECKPOINT_SHIFT up to CHECKPOINTS - 1 strides. It
+    uses nothing but its own byte and bit sieves (primeCount itself starts
+    from the checkpoints), so the tables can be re-derived or re-spaced by
+    changing the definitions below. The file is written beside the old one
+    and renamed over it once complete.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primeTablesGen primeTablesGen.c -pthread
+   Run by:     ./primeTablesGen [-t threads] [output file]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "timer.h"
+
+void *threadCountStrides(void *rank);
+long unsigned int countStride(long unsigned int k, long unsigned int *next);
+void writeTables(FILE *out);
+
+// definitions
+#define SMALL_LIMIT 65536               // table primes lie below it
+#define PRESIEVE_PRIMES {3, 5, 7, 11, 13}
+#define CHECKPOINT_SHIFT 26
+#define CHECKPOINTS 4097                // checkpoints 0 .. 4096 strides
+#define BLOCK_WORDS 4096                // 32 KB of odd numbers per block
+#define DEFAULT_OUTPUT "primeTableData.c"
+
+// global variables: sieving primes up to sqrt of the last checkpoint, and
+//  the odd primes in each stride, claimed one stride at a time by workers
+uint32_t *smallPrimes, *basePrimes;
+long unsigned int numSmall, numBase;
+long unsigned int *strideCounts;
+long unsigned int nextStride = 0;
+
+int main(int argc, char * argv[]) {
+
+  const char *output = DEFAULT_OUTPUT;
+  char temp[4096];
+  unsigned char *composite;
+  long unsigned int limit, i, j, threads;
+  pthread_t *handles;
+  FILE *out;
+  double start, finish;
+  int arg = 1;
+
+  threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (argc >= 3 && strcmp(argv[1], "-t") == 0) {
+    threads = strtoul(argv[2], NULL, 10);
+    arg = 3;
+  }
+  if (argc > arg + 1 || threads < 1) {
+    printf("Usage: %s [-t threads] <optionally followed by [output file]>\n", argv[0]);
+    exit(-1);
+  }
+  if (arg < argc) {
+    output = argv[arg];
+  }
+
+  GET_TIME(start);
+
+  // one byte sieve up to sqrt(last checkpoint) gives both prime lists
+  limit = 1;
+  while (limit * limit < (1UL << CHECKPOINT_SHIFT) * (CHECKPOINTS - 1)) {
+    limit++;
+  }
+  if (limit < SMALL_LIMIT) {
+    limit = SMALL_LIMIT;
+  }
+  composite = (unsigned char *) calloc(limit + 1, 1);
+  smallPrimes = (uint32_t *) malloc(sizeof(uint32_t)*SMALL_LIMIT);
+  basePrimes = (uint32_t *) malloc(sizeof(uint32_t)*(limit / 2 + 1));
+  for (i = 2; i <= limit; i++) {
+    if (composite[i]) {
+      continue;
+    }
+    for (j = i * i; j <= limit; j += i) {
+      composite[j] = 1;
+    }
+    if (i < SMALL_LIMIT) {
+      smallPrimes[numSmall++] = (uint32_t) i;
+    }
+    if (i > 2) {
+      basePrimes[numBase++] = (uint32_t) i;
+    }
+  }
+  free(composite);
+
+  strideCounts = (long unsigned int *) calloc(CHECKPOINTS, sizeof(long unsigned int));
+  handles = (pthread_t *) malloc(sizeof(pthread_t)*threads);
+  for (i = 0; i < threads; i++) {
+    pthread_create(&handles[i], NULL, threadCountStrides, NULL);
+  }
+  for (i = 0; i < threads; i++) {
+    pthread_join(handles[i], NULL);
+  }
+  free(handles);
+  for (i = 1; i < CHECKPOINTS; i++) {
+    strideCounts[i] += strideCounts[i - 1];
+  }
+
+  snprintf(temp, sizeof(temp), "%s.tmp", output);
+  if ((out = fopen(temp, "w")) == NULL) {
+    perror(temp);
+    exit(1);
+  }
+  writeTables(out);
+  if (ferror(out) | (fclose(out) != 0) || rename(temp, output) != 0) {
+    perror(output);
+    remove(temp);
+    exit(1);
+  }
+
+  GET_TIME(finish);
+
+  printf("Wrote %lu primes and %d checkpoints (pi(%lu) = %lu) to %s\n",
+         numSmall, CHECKPOINTS,
+         (1UL << CHECKPOINT_SHIFT) * (CHECKPOINTS - 1), strideCounts[CHECKPOINTS - 1], output);
+  printf("\nCPU execution time: %0.6fs\n\n", finish - start);
+
+  return 0;
+
+}
+
+/******************************************************************************
+* Function threadCountStrides counts the odd primes of whole strides, then    *
+*  the main thread turns the counts into running totals                       *
+******************************************************************************/
+void *threadCountStrides(void *rank) {
+
+  long unsigned int k, *next;
+
+  (void) rank;
+  next = (long unsigned int *) malloc(sizeof(long unsigned int)*numBase);
+  while ((k = __atomic_fetch_add(&nextStride, 1, __ATOMIC_RELAXED)) < CHECKPOINTS - 1) {
+    strideCounts[k + 1] = countStride(k, next);
+  } // end while
+  free(next);
+
+  return NULL;
+
+} // end threadCountStrides
+
+/******************************************************************************
+* Function countStride counts the primes in (k * stride, (k+1) * stride] with *
+*  a bit sieve of the odd numbers, one cache-sized block at a time; next     *
+*  carries each base prime's next multiple from block to block               *
+******************************************************************************/
+long unsigned int countStride(long unsigned int k, long unsigned int *next) {
+
+  uint64_t bits[BLOCK_WORDS];
+  long unsigned int low, high, blockLow, numBits, bit, m, p, i, w, count = 0;
+
+  // in stride 0, 1 takes the place of 2 in the count
+  low = (k << CHECKPOINT_SHIFT) + 1;
+  high = ((k + 1) << CHECKPOINT_SHIFT) - 1;
+
+  for (i = 0; i < numBase; i++) {
+    p = basePrimes[i];
+    m = (p * p > low) ? p * p : low + (p - low % p) % p;
+    if (m % 2 == 0) {
+      m += p;
+    } // end if
+    next[i] = (m - low) / 2;
+  } // end for (i)
+
+  for (blockLow = 0; low + 2 * blockLow <= high; blockLow += BLOCK_WORDS * 64) {
+    memset(bits, 0xff, sizeof(bits));
+    for (i = 0; i < numBase; i++) {
+      p = basePrimes[i];
+      for (bit = next[i]; bit < blockLow + BLOCK_WORDS * 64; bit += p) {
+        bits[(bit - blockLow) >> 6] &= ~(1ULL << ((bit - blockLow) & 63));
+      } // end for (bit)
+      next[i] = bit;
+    } // end for (i)
+    numBits = (high - low) / 2 + 1 - blockLow;
+    for (w = 0; w < BLOCK_WORDS && w * 64 < numBits; w++) {
+      if (numBits - w * 64 < 64) {
+        bits[w] &= (1ULL << (numBits - w * 64)) - 1;
+      } // end if
+      count += __builtin_popcountll(bits[w]);
+    } // end for (w)
+  } // end for (blockLow)
+
+  return count;
+
+} // end countStride
+
+/******************************************************************************
+* Function writeTables prints primeTableData.c in the layout of the rest of  *
+*  the tree                                                                   *
+******************************************************************************/
+void writeTables(FILE *out) {
+
+  static const long unsigned int presievePrimes[] = PRESIEVE_PRIMES;
+  long unsigned int product = 1, words, largest = 0, i, j, q, word;
+  int coprime;
+
+  for (i = 0; i < sizeof(presievePrimes) / sizeof(presievePrimes[0]); i++) {
+    product *= presievePrimes[i];
+    largest = presievePrimes[i];
+  } // end for (i)
+  words = (product + 63) / 64 + 1;
+
+  fprintf(out, "/*\n  Generated by primeTablesGen.c (npm run gen-tables); do not edit.\n*/\n\n");
+  fprintf(out, "#ifndef PRIMETABLEDATA_C\n#define PRIMETABLEDATA_C\n\n#include <stdint.h>\n\n");
+  fprintf(out, "#define SMALL_TABLE_PRIMES %lu\n", numSmall);
+  fprintf(out, "#define PRESIEVE_PRODUCT %luUL\n", product);
+  fprintf(out, "#define PRESIEVE_LARGEST %lu\n", largest);
+  fprintf(out, "#define PRESIEVE_COUNT %lu\n", sizeof(presievePrimes) / sizeof(presievePrimes[0]));
+  fprintf(out, "#define PRESIEVE_PRIMES ");
+  for (i = 0; i < sizeof(presievePrimes) / sizeof(presievePrimes[0]); i++) {
+    fprintf(out, "%s%lu", i ? ", " : "{", presievePrimes[i]);
+  } // end for (i)
+  fprintf(out, "}\n");
+  fprintf(out, "#define PRESIEVE_WORDS %lu\n", words);
+  fprintf(out, "#define PI_CHECKPOINT_STRIDE (1UL << %d)\n", CHECKPOINT_SHIFT);
+  fprintf(out, "#define PI_CHECKPOINTS %d\n", CHECKPOINTS);
+  fprintf(out, "#define PI_CHECKPOINT_LIMIT (PI_CHECKPOINT_STRIDE * (PI_CHECKPOINTS - 1))\n\n");
+
+  fprintf(out, "// every prime below %d; smallPrimeTable + 1 is a base prime list\n", SMALL_LIMIT);
+  fprintf(out, "const uint32_t smallPrimeTable[SMALL_TABLE_PRIMES] = {\n");
+  for (i = 0; i < numSmall; i++) {
+    fprintf(out, "%s%5u%s", i % 12 ? " " : "  ", smallPrimes[i],
+            i + 1 == numSmall ? "\n" : (i % 12 == 11 ? ",\n" : ","));
+  } // end for (i)
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "// bit j is set iff 2j+1 is coprime to PRESIEVE_PRODUCT\n");
+  fprintf(out, "const uint64_t presievePattern[PRESIEVE_WORDS] = {\n");
+  for (i = 0; i < words; i++) {
+    word = 0;
+    for (j = 0; j < 64; j++) {
+      coprime = 1;
+      for (q = 0; q < sizeof(presievePrimes) / sizeof(presievePrimes[0]); q++) {
+        coprime &= (2 * (i * 64 + j) + 1) % presievePrimes[q] != 0;
+      } // end for (q)
+      word |= (uint64_t) coprime << j;
+    } // end for (j)
+    fprintf(out, "%s0x%016lxULL%s", i % 3 ? " " : "  ", word,
+            i + 1 == words ? "\n" : (i % 3 == 2 ? ",\n" : ","));
+  } // end for (i)
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "// pi(k * PI_CHECKPOINT_STRIDE)\n");
+  fprintf(out, "const uint64_t piCheckpoints[PI_CHECKPOINTS] = {\n");
+  for (i = 0; i < CHECKPOINTS; i++) {
+    fprintf(out, "%s%11lu%s", i % 6 ? " " : "  ", strideCounts[i],
+            i + 1 == CHECKPOINTS ? "\n" : (i % 6 == 5 ? ",\n" : ","));
+  } // end for (i)
+  fprintf(out, "};\n\n#endif\n");
+
+} // end writeTables
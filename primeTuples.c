@@ -0,0 +1,77 @@
+/* Some fun with prime numbers. Program counts (and optionally lists) prime
+    constellations such as twin, cousin and sexy primes, prime triplets and
+    quadruplets, sieving only the residue classes the pattern allows.
+   Author:     Vincent T. Mossman
+   Compile by: gcc -O2 -o primeTuples primeTuples.c -pthread -lm
+   Run by:     ./primeTuples [-t threads] [--list] [-f format] [--profile[=json]]
+                             [pattern] [NAT from] [NAT to]
+               patterns: twin, cousin, sexy, triplet, quadruplet or offsets
+                         such as 0,2,6
+*/
+
+#include "constellation.c"
+#include "timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+int main(int argc, char * argv[]) {
+
+  tuplePattern pattern;
+  primeOutput out;
+  long unsigned int lo = 0, hi, count;
+  int list = 0, format, arg, i;
+  double start, finish;
+  FILE *report;
+
+  for (arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--list") == 0) {
+      list = 1;
+      for (i = arg; i + 1 <= argc; i++) {
+        argv[i] = argv[i+1];
+      }
+      argc--;
+      break;
+    }
+  }
+  if (parseThreadFlag(&argc, argv) != 0 || (format = parseFormatFlag(&argc, argv)) < 0
+      || profileInit(&argc, argv) != 0 || argc < 3 || argc > 4
+      || parsePattern(argv[1], &pattern) != 0) {
+    printf("Usage: %s [-t threads] [--list] [-f text|uint64|half_gap32|varint_delta] [--profile[=json]] <followed by [pattern] optionally followed by [NAT from] followed by [NAT to]>\n", argv[0]);
+    printf("       patterns: twin, cousin, sexy, triplet, quadruplet, or rising offsets from 0 such as 0,2,6\n");
+    exit(-1);
+  }
+  hi = strtoul(argv[argc-1], NULL, 10);
+  if (argc == 4) {
+    lo = strtoul(argv[2], NULL, 10);
+  }
+  if (hi > ULONG_MAX - (1UL << 33)) {
+    printf("%s: the range must end below 2^64 - 2^33\n", argv[argc-1]);
+    exit(-1);
+  }
+
+  GET_TIME(start);
+  if (list && primeOutputOpen(&out, STDOUT_FILENO, format, sieveThreadCount() > 1) != 0) {
+    printf("Error allocating output buffers\n");
+    exit(1);
+  }
+  count = countTuples(&pattern, lo, hi, list ? &out : NULL);
+  if (list && primeOutputClose(&out) != 0) {
+    perror("Error writing tuples");
+    exit(1);
+  }
+  GET_TIME(finish);
+
+  // keep binary output clean
+  report = (list && format != OUTPUT_TEXT) ? stderr : stdout;
+  fprintf(report, "\n{");
+  for (i = 0; i < pattern.k; i++) {
+    fprintf(report, "%s%lu", i ? ", " : "", pattern.offsets[i]);
+  }
+  fprintf(report, "}: %lu in [%lu, %lu]\n", count, lo, hi);
+  fprintf(report, "CPU execution time: %0.6fs\n\n", finish - start);
+
+  return 0;
+
+}
@@ -1,6 +1,7 @@
 // API Testing Functionality
 
 let currentMaxIndex = 10000000000; // Default fallback
+const MAX_COMPUTED_INDEX = 252252704148404; // past the database, computed up to pi(2^53)
 
 // Fetch current database limits
 async function fetchCurrentLimits() {
@@ -43,7 +44,7 @@ async function fetchCurrentLimits() {
         // Update input max attribute
         const primeIndexInput = document.getElementById('prime-index');
         if (primeIndexInput) {
-            primeIndexInput.max = currentMaxIndex;
+            primeIndexInput.max = MAX_COMPUTED_INDEX;
         }
         
     } catch (error) {
@@ -160,10 +161,10 @@ async function testAPI() {
         return;
     }
     
-    if (index > currentMaxIndex) {
+    if (index > MAX_COMPUTED_INDEX) {
         responseStatus.className = 'status-badge error';
         responseStatus.textContent = 'Out of Range';
-        testResponse.textContent = `Index ${index.toLocaleString()} exceeds current maximum of ${currentMaxIndex.toLocaleString()}. Database may still be building.`;
+        testResponse.textContent = `Index ${index.toLocaleString()} exceeds the maximum of ${MAX_COMPUTED_INDEX.toLocaleString()}.`;
         return;
     }
     
@@ -5,6 +5,19 @@ class OptimizedPrimeGenerator {
     constructor() {
         this.smallPrimes = [2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47];
         this.cache = new Map();
+        this.sieved = null;     // largest prime table built so far
+        this.sievedLimit = 0;
+    }
+
+    // Primes <= limit out of a sorted prime table
+    primesUpTo(primes, limit) {
+        let low = 0, high = primes.length;
+        while (low < high) {
+            const mid = (low + high) >>> 1;
+            if (primes[mid] <= limit) low = mid + 1;
+            else high = mid;
+        }
+        return primes.slice(0, low);
     }
 
     // Generate small primes up to limit using simple sieve
@@ -12,6 +25,9 @@ class OptimizedPrimeGenerator {
         if (limit <= 47) {
             return this.smallPrimes.filter(p => p <= limit);
         }
+        if (this.sieved && limit <= this.sievedLimit) {
+            return this.primesUpTo(this.sieved, limit);
+        }
 
         const sieve = new Array(limit + 1).fill(true);
         sieve[0] = sieve[1] = false;
@@ -28,7 +44,9 @@ class OptimizedPrimeGenerator {
         for (let i = 2; i <= limit; i++) {
             if (sieve[i]) primes.push(i);
         }
-        return primes;
+        this.sieved = primes;
+        this.sievedLimit = limit;
+        return primes.slice();
     }
 
     // Optimized segmented sieve for large ranges
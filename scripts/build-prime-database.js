@@ -3,6 +3,7 @@
 const sqlite3 = require('sqlite3').verbose();
 const fs = require('fs');
 const path = require('path');
+const { PrimeDatabase } = require('../lib/prime-database');
 
 // Configuration - easily adjustable for scaling up
 const CONFIG = {
@@ -19,6 +20,12 @@ class PrimeDatabaseBuilder {
         this.db = null;
         this.currentSegmentId = 0;
         this.primesGenerated = 0;
+        this.primesResumed = 0;
+        this.resumeSegment = null;  // primes of a partial last segment
+        this.resumeNumber = 2;      // where sieving picks up
+        this.stopRequested = false;
+        this.basePrimes = [];       // simpleSieve's last table, and its limit
+        this.baseLimit = 0;
         this.startTime = Date.now();
     }
 
@@ -44,6 +51,67 @@ class PrimeDatabaseBuilder {
         });
     }
 
+    // Pick up after the last stored segment so a larger target only costs
+    // the new primes: a full segment is followed by a new one, a partial one
+    // (the end of an earlier, lower target) is reloaded and filled up
+    async resume() {
+        const row = await new Promise((resolve, reject) => {
+            this.db.get(`
+                SELECT segment_id, start_index, end_index, start_prime, segment_size, compressed_deltas,
+                       (SELECT value FROM database_metadata WHERE key = 'compression_method') AS method
+                FROM prime_segments ORDER BY segment_id DESC LIMIT 1
+            `, (err, row) => {
+                if (err) reject(err);
+                else resolve(row);
+            });
+        });
+        if (!row) return 0;
+        if ((row.method || 'varint_delta') !== 'varint_delta') {
+            throw new Error(`database uses ${row.method}; extend it with ./buildPrimeDatabase`);
+        }
+
+        const primes = [row.start_prime];
+        let prime = row.start_prime, offset = 0, damaged = false;
+        try {
+            while (offset < row.compressed_deltas.length) {
+                const decoded = PrimeDatabase.decodeVarInt(row.compressed_deltas, offset);
+                prime += decoded.value;
+                primes.push(prime);
+                offset = decoded.nextOffset;
+            }
+        } catch (err) {
+            damaged = true; // a varint cut off at the end of the blob
+        }
+        if (damaged || primes.length !== row.segment_size || row.end_index - row.start_index + 1 !== row.segment_size) {
+            throw new Error(`segment ${row.segment_id} is damaged; remove it to resume`);
+        }
+
+        if (row.segment_size < CONFIG.SEGMENT_SIZE) {
+            this.currentSegmentId = row.segment_id;
+            this.primesGenerated = row.start_index - 1;
+            this.resumeSegment = primes;
+        } else {
+            this.currentSegmentId = row.segment_id + 1;
+            this.primesGenerated = row.end_index;
+        }
+        this.resumeNumber = prime + 1;
+        this.primesResumed = row.end_index;
+        return row.end_index;
+    }
+
+    // Primes and segments actually in prime_segments: an interrupted refill
+    // of a reloaded partial segment leaves that segment as it was
+    async storedTotals() {
+        return new Promise((resolve, reject) => {
+            this.db.get(`
+                SELECT COUNT(*) AS segments, COALESCE(MAX(end_index), 0) AS primes FROM prime_segments
+            `, (err, row) => {
+                if (err) reject(err);
+                else resolve(row);
+            });
+        });
+    }
+
     // Variable-length integer encoding for delta compression
     encodeVarInt(value) {
         const bytes = [];
@@ -95,8 +163,18 @@ class PrimeDatabaseBuilder {
         return primes;
     }
 
-    // Simple sieve for base primes
+    // Simple sieve for base primes; sqrt(end) grows slowly, so the table is
+    // only rebuilt (with headroom) once it no longer reaches limit
     simpleSieve(limit) {
+        if (limit <= this.baseLimit) {
+            return this.basePrimes.filter(prime => prime <= limit);
+        }
+        this.baseLimit = Math.max(limit, 2 * this.baseLimit);
+        this.basePrimes = this.sieveTo(this.baseLimit);
+        return this.basePrimes.filter(prime => prime <= limit);
+    }
+
+    sieveTo(limit) {
         if (limit < 2) return [];
         
         const isPrime = new Array(limit + 1).fill(true);
@@ -130,7 +208,7 @@ class PrimeDatabaseBuilder {
         
         return new Promise((resolve, reject) => {
             const stmt = this.db.prepare(`
-                INSERT INTO prime_segments 
+                INSERT OR REPLACE INTO prime_segments 
                 (segment_id, start_index, end_index, start_prime, segment_size, compressed_deltas)
                 VALUES (?, ?, ?, ?, ?, ?)
             `);
@@ -147,7 +225,7 @@ class PrimeDatabaseBuilder {
     async updateProgress(segmentId, currentNumber, primesGenerated) {
         const now = new Date().toISOString();
         const progressPercent = (primesGenerated / CONFIG.TARGET_PRIME_COUNT * 100).toFixed(2);
-        const ratePerSecond = primesGenerated / ((Date.now() - this.startTime) / 1000);
+        const ratePerSecond = (primesGenerated - this.primesResumed) / ((Date.now() - this.startTime) / 1000);
         const estimatedCompletion = new Date(Date.now() + 
             (CONFIG.TARGET_PRIME_COUNT - primesGenerated) / ratePerSecond * 1000
         ).toISOString();
@@ -170,31 +248,45 @@ class PrimeDatabaseBuilder {
         }
     }
 
-    // Main generation function
-    async generate() {
-        console.log(`🚀 Starting prime database generation...`);
-        console.log(`📊 Target: ${CONFIG.TARGET_PRIME_COUNT.toLocaleString()} primes`);
-        console.log(`🔧 Segment size: ${CONFIG.SEGMENT_SIZE.toLocaleString()} primes`);
-        console.log(`💾 Database: ${CONFIG.DATABASE_PATH}`);
-        console.log('');
-
-        // Set status to in_progress
-        await new Promise((resolve, reject) => {
+    async setMetadata(key, value) {
+        return new Promise((resolve, reject) => {
             this.db.run(`
                 UPDATE database_metadata 
                 SET value = ?, updated_at = CURRENT_TIMESTAMP 
                 WHERE key = ?
-            `, ['in_progress', 'generation_status'], (err) => {
+            `, [String(value), key], (err) => {
                 if (err) reject(err);
                 else resolve();
             });
         });
+    }
 
-        let currentNumber = 2;
-        let primesInCurrentSegment = [];
-        let globalPrimeIndex = 1;
+    // Main generation function: builds, or extends what is already stored
+    async generate() {
+        const existing = await this.resume();
+        if (existing >= CONFIG.TARGET_PRIME_COUNT) {
+            console.log(`✅ Database already holds ${existing.toLocaleString()} primes`);
+            return;
+        }
+        if (existing) {
+            console.log(`🔁 Extending from ${existing.toLocaleString()} primes, after ${(this.resumeNumber - 1).toLocaleString()}`);
+        } else {
+            console.log(`🚀 Starting prime database generation...`);
+        }
+        console.log(`📊 Target: ${CONFIG.TARGET_PRIME_COUNT.toLocaleString()} primes`);
+        console.log(`🔧 Segment size: ${CONFIG.SEGMENT_SIZE.toLocaleString()} primes`);
+        console.log(`💾 Database: ${CONFIG.DATABASE_PATH}`);
+        console.log('');
+
+        // Set status to in_progress
+        await this.setMetadata('generation_status', 'in_progress');
+        await this.setMetadata('target_prime_count', CONFIG.TARGET_PRIME_COUNT);
 
-        while (this.primesGenerated < CONFIG.TARGET_PRIME_COUNT) {
+        let currentNumber = this.resumeNumber;
+        let primesInCurrentSegment = this.resumeSegment || [];
+        let globalPrimeIndex = this.primesGenerated + 1;
+
+        while (this.primesGenerated < CONFIG.TARGET_PRIME_COUNT && !this.stopRequested) {
             // Generate primes for current sieve segment
             const segmentEnd = currentNumber + CONFIG.SIEVE_SEGMENT_SIZE;
             const segmentPrimes = this.segmentedSieve(currentNumber, segmentEnd);
@@ -221,25 +313,25 @@ class PrimeDatabaseBuilder {
                     this.currentSegmentId++;
                     primesInCurrentSegment = [];
                     
-                    // Check if we've reached our target
-                    if (this.primesGenerated >= CONFIG.TARGET_PRIME_COUNT) break;
+                    // Check if we've reached our target, or were asked to stop
+                    if (this.primesGenerated >= CONFIG.TARGET_PRIME_COUNT || this.stopRequested) break;
                 }
             }
             
             currentNumber = segmentEnd;
         }
 
-        // Update final metadata
-        await new Promise((resolve, reject) => {
-            this.db.run(`
-                UPDATE database_metadata 
-                SET value = ?, updated_at = CURRENT_TIMESTAMP 
-                WHERE key = ?
-            `, ['completed', 'generation_status'], (err) => {
-                if (err) reject(err);
-                else resolve();
-            });
-        });
+        // Update final metadata from what is stored; primes past the last
+        // stored segment are sieved again by the next run
+        const stored = await this.storedTotals();
+        await this.setMetadata('last_generated_index', stored.primes);
+        await this.setMetadata('total_segments', stored.segments);
+        if (this.stopRequested) {
+            console.log('');
+            console.log(`🛑 Stopped at ${stored.primes.toLocaleString()} primes; run again to resume`);
+            return;
+        }
+        await this.setMetadata('generation_status', 'completed');
 
         const totalTime = ((Date.now() - this.startTime) / 1000 / 60).toFixed(1);
         console.log('');
@@ -258,9 +350,10 @@ class PrimeDatabaseBuilder {
 }
 
 // Main execution
+const builder = new PrimeDatabaseBuilder();
+
 async function main() {
-    const builder = new PrimeDatabaseBuilder();
-    
+
     try {
         await builder.initialize();
         await builder.generate();
@@ -272,10 +365,12 @@ async function main() {
     }
 }
 
-// Handle graceful shutdown
+// Handle graceful shutdown: finish the segment being stored, then stop;
+// a second interrupt exits at once (each segment is stored in one statement)
 process.on('SIGINT', async () => {
-    console.log('\n🛑 Received interrupt signal. Shutting down gracefully...');
-    process.exit(0);
+    if (builder.stopRequested) process.exit(1);
+    console.log('\n🛑 Received interrupt signal. Stopping after the current segment...');
+    builder.stopRequested = true;
 });
 
 if (require.main === module) {
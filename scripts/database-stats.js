@@ -62,7 +62,9 @@ async function displayDatabaseStats() {
             console.log('');
             console.log('🗃️  CACHE STATISTICS');
             console.log('─'.repeat(30));
-            console.log(`Cache Size: ${cacheStats.cacheSize}/${cacheStats.maxCacheSize}`);
+            console.log(`Cached Segments: ${cacheStats.segments} (${(cacheStats.bytes / 1048576).toFixed(1)}/${(cacheStats.maxBytes / 1048576).toFixed(0)} MB)`);
+            console.log(`Hits/Misses: ${cacheStats.hits}/${cacheStats.misses} (${(cacheStats.hitRate * 100).toFixed(1)}%)`);
+            console.log(`Evictions: ${cacheStats.evictions} | Prefetches: ${cacheStats.prefetches}`);
         }
         
         console.log('');
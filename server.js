@@ -3,6 +3,7 @@ const helmet = require('helmet');
 const rateLimit = require('express-rate-limit');
 const path = require('path');
 const { getPrimeDatabaseInstance } = require('./lib/prime-database');
+const { getNthPrimeEngineInstance, MAX_COMPUTED_INDEX } = require('./lib/nth-prime-engine');
 
 const app = express();
 const PORT = 3007;
@@ -62,6 +63,9 @@ app.use(express.urlencoded({ extended: true }));
 // Initialize prime database
 const primeDB = getPrimeDatabaseInstance();
 
+// Computes primes past the database's last index (NTH_PRIME_BUDGET_MS)
+const nthPrimeEngine = getNthPrimeEngineInstance();
+
 // Get nth prime using database (1-indexed)
 async function getNthPrime(n) {
     if (n < 1) return null;
@@ -75,8 +79,266 @@ async function getNthPrime(n) {
     }
 }
 
+// Indices past the database are computed on demand, counting on from its
+// last prime (or an earlier result, or the addon's pi checkpoints)
+async function handleComputedIndex(res, index, maxIndex) {
+    const anchorPrime = maxIndex > 0 ? await getNthPrime(maxIndex) : null;
+
+    try {
+        const prime = await nthPrimeEngine.nthPrime(index, anchorPrime ? maxIndex : 0, anchorPrime || 0);
+        return res.json({
+            index: index,
+            prime: prime,
+            computed: true
+        });
+    } catch (error) {
+        if (error.code === 'range') {
+            return res.status(400).json({
+                error: "Index out of range",
+                message: error.message,
+                current_max: MAX_COMPUTED_INDEX,
+                database_max: maxIndex,
+                requested: index,
+                suggestion: "Try a smaller index"
+            });
+        }
+        if (error.code === 'busy' || error.code === 'timeout') {
+            return res.status(503).json({
+                error: "Computation unavailable",
+                message: error.message,
+                requested: index,
+                estimate: error.estimate,
+                database_max: maxIndex,
+                suggestion: error.code === 'busy' ? "Try again shortly" : "Try an index closer to the database"
+            });
+        }
+        console.error(`Error computing prime at index ${index}:`, error);
+        return res.status(500).json({
+            error: "Prime computation failed",
+            message: error.message,
+            index: index
+        });
+    }
+}
+
+// Reverse lookups: ?prime=x (is x prime, and its index), ?next=x and ?prev=x.
+// Each is answered from the one segment whose range covers x.
+const REVERSE_QUERIES = ['prime', 'next', 'prev'];
+
+async function handleReverseQuery(req, res) {
+    const mode = REVERSE_QUERIES.find((name) => req.query[name] !== undefined);
+    if (!mode) {
+        return false;
+    }
+
+    const x = Number(req.query[mode]);
+    if (!Number.isSafeInteger(x) || x < 0) {
+        res.status(400).json({
+            error: "Invalid number",
+            message: `${mode} must be a non-negative integer`,
+            example: `/prime-generator/api?${mode}=97`
+        });
+        return true;
+    }
+
+    let result;
+    try {
+        if (mode === 'prime') {
+            result = await primeDB.getIndexOfPrime(x);
+            if (result) {
+                result = { number: x, is_prime: result.isPrime, index: result.index, pi: result.pi };
+            }
+        } else if (mode === 'next') {
+            result = await primeDB.getNextPrime(x);
+            if (result) {
+                result = { after: x, index: result.index, prime: result.prime };
+            }
+        } else {
+            if (x <= 2) {
+                res.status(404).json({
+                    error: "No previous prime",
+                    message: `There is no prime below ${x}`
+                });
+                return true;
+            }
+            result = await primeDB.getPrevPrime(x);
+            if (result) {
+                result = { before: x, index: result.index, prime: result.prime };
+            }
+        }
+    } catch (error) {
+        console.error(`Error in ${mode} lookup for ${x}:`, error);
+        res.status(503).json({
+            error: "Database unavailable",
+            message: "Prime database is not accessible",
+            suggestion: "Database may still be building. Try again later."
+        });
+        return true;
+    }
+
+    if (!result) {
+        res.status(400).json({
+            error: "Number out of range",
+            message: `${x.toLocaleString()} is beyond the largest prime in the database`,
+            requested: x,
+            suggestion: "Try a smaller number"
+        });
+        return true;
+    }
+
+    res.json(result);
+    return true;
+}
+
+// Bulk ranges: ?from=a&to=b[&format=ndjson|binary], at most MAX_RANGE primes.
+// The covering segments are decoded one at a time and streamed as they go.
+// binary is the first prime as a little-endian uint64, then the varint gaps.
+const MAX_RANGE = 1000000;
+const NDJSON_LINES_PER_WRITE = 16384;
+
+// Write a chunk, waiting for the socket to drain if its buffer is full.
+// Resolves false once the client is gone (a destroyed response never drains)
+function writeChunk(res, chunk) {
+    if (res.destroyed) {
+        return Promise.resolve(false);
+    }
+    if (res.write(chunk)) {
+        return Promise.resolve(true);
+    }
+    return new Promise((resolve) => {
+        const settle = () => {
+            res.off('drain', settle);
+            res.off('close', settle);
+            res.off('error', settle);
+            resolve(!res.destroyed);
+        };
+        res.on('drain', settle);
+        res.on('close', settle);
+        res.on('error', settle);
+    });
+}
+
+// Varint-encode the gaps of primes (after previous) into a Buffer
+function encodeGaps(primes, previous) {
+    const bytes = Buffer.allocUnsafe(primes.length * 3);
+    let length = 0;
+    for (let i = 0; i < primes.length; i++) {
+        let gap = primes[i] - previous;
+        previous = primes[i];
+        while (gap >= 128) {
+            bytes[length++] = (gap % 128) | 128;
+            gap = Math.floor(gap / 128);
+        }
+        bytes[length++] = gap;
+    }
+    return bytes.subarray(0, length);
+}
+
+async function handleRangeQuery(req, res) {
+    if (req.query.from === undefined && req.query.to === undefined) {
+        return false;
+    }
+
+    const from = Number(req.query.from);
+    const to = Number(req.query.to);
+    const format = req.query.format || 'ndjson';
+    if (!Number.isSafeInteger(from) || !Number.isSafeInteger(to) || from < 1 || to < from) {
+        res.status(400).json({
+            error: "Invalid range",
+            message: "from and to must be integers with 1 <= from <= to",
+            example: "/prime-generator/api?from=1&to=1000"
+        });
+        return true;
+    }
+    if (format !== 'ndjson' && format !== 'binary') {
+        res.status(400).json({
+            error: "Invalid format",
+            message: "format must be ndjson or binary"
+        });
+        return true;
+    }
+    if (to - from + 1 > MAX_RANGE) {
+        res.status(400).json({
+            error: "Range too large",
+            message: `At most ${MAX_RANGE.toLocaleString()} primes per request`,
+            requested: to - from + 1,
+            suggestion: "Split the range into several requests"
+        });
+        return true;
+    }
+
+    let maxIndex;
+    try {
+        const stats = await primeDB.getStats();
+        maxIndex = stats.max_prime_index || 0;
+    } catch (error) {
+        res.status(503).json({
+            error: "Database unavailable",
+            message: "Prime database is not accessible",
+            suggestion: "Database may still be building. Try again later."
+        });
+        return true;
+    }
+    if (to > maxIndex) {
+        res.status(400).json({
+            error: "Index out of range",
+            message: `Index must be between 1 and ${maxIndex.toLocaleString()}`,
+            current_max: maxIndex,
+            requested: to
+        });
+        return true;
+    }
+
+    res.status(200);
+    res.set('X-Prime-From', String(from));
+    res.set('X-Prime-To', String(to));
+    res.type(format === 'binary' ? 'application/octet-stream' : 'application/x-ndjson');
+
+    // returning out of the loop on a lost client closes the generator and
+    // lets go of the segment it holds
+    let previous = null;
+    try {
+        for await (const run of primeDB.iteratePrimeRange(from, to)) {
+            if (format === 'binary') {
+                let primes = run.primes;
+                if (previous === null) {
+                    const header = Buffer.alloc(8);
+                    header.writeBigUInt64LE(BigInt(primes[0]));
+                    if (!await writeChunk(res, header)) return true;
+                    previous = primes[0];
+                    primes = primes.slice(1);
+                }
+                if (!await writeChunk(res, encodeGaps(primes, previous))) return true;
+                previous = run.primes[run.primes.length - 1];
+                continue;
+            }
+
+            for (let i = 0; i < run.primes.length; i += NDJSON_LINES_PER_WRITE) {
+                const end = Math.min(i + NDJSON_LINES_PER_WRITE, run.primes.length);
+                let lines = '';
+                for (let k = i; k < end; k++) {
+                    lines += `{"index":${run.startIndex + k},"prime":${run.primes[k]}}\n`;
+                }
+                if (!await writeChunk(res, lines)) return true;
+            }
+        }
+    } catch (error) {
+        // Headers are already sent, so the truncated body is the signal
+        console.error(`Error streaming range ${from}..${to}:`, error);
+        res.destroy(error);
+        return true;
+    }
+
+    res.end();
+    return true;
+}
+
 // Main prime generator route - serves HTML page and handles API requests
 app.get('/', strictApiLimiter, async (req, res, next) => {
+    if (await handleReverseQuery(req, res)) {
+        return;
+    }
+
     const primeIndex = req.query.pi;
     
     // If pi parameter exists, return JSON API response
@@ -106,13 +368,7 @@ app.get('/', strictApiLimiter, async (req, res, next) => {
         }
         
         if (index > maxIndex) {
-            return res.status(400).json({
-                error: "Index out of range",
-                message: `Index must be between 1 and ${maxIndex.toLocaleString()}`,
-                current_max: maxIndex,
-                requested: index,
-                suggestion: maxIndex === 0 ? "Database is still building" : "Try a smaller index"
-            });
+            return handleComputedIndex(res, index, maxIndex);
         }
         
         const startTime = Date.now();
@@ -133,7 +389,7 @@ app.get('/', strictApiLimiter, async (req, res, next) => {
         });
     }
     
-    // If no 'pi' parameter, pass to the next middleware (static files)
+    // If no query parameter, pass to the next middleware (static files)
     return next();
 });
 
@@ -142,6 +398,10 @@ app.use(express.static(path.join(__dirname, 'public')));
 
 // API route - handles both documentation and API requests
 app.get('/api', strictApiLimiter, async (req, res) => {
+    if (await handleReverseQuery(req, res) || await handleRangeQuery(req, res)) {
+        return;
+    }
+
     const primeIndex = req.query.pi;
     
     // If pi parameter exists, return JSON API response
@@ -171,13 +431,7 @@ app.get('/api', strictApiLimiter, async (req, res) => {
         }
         
         if (index > maxIndex) {
-            return res.status(400).json({
-                error: "Index out of range",
-                message: `Index must be between 1 and ${maxIndex.toLocaleString()}`,
-                current_max: maxIndex,
-                requested: index,
-                suggestion: maxIndex === 0 ? "Database is still building" : "Try a smaller index"
-            });
+            return handleComputedIndex(res, index, maxIndex);
         }
         
         const startTime = Date.now();
@@ -198,7 +452,7 @@ app.get('/api', strictApiLimiter, async (req, res) => {
         });
     }
     
-    // If no 'pi' parameter, serve API documentation
+    // If no query parameter, serve API documentation
     res.sendFile(path.join(__dirname, 'public', 'api.html'));
 });
 
@@ -216,6 +470,7 @@ app.get('/stats', async (req, res) => {
                 target_count: parseInt(stats.target_count) || 0
             },
             cache: cacheStats,
+            nth_prime: nthPrimeEngine.getStats(),
             timestamp: new Date().toISOString(),
             version: '2025-08-05-dynamic'
         });
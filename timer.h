@@ -25,13 +25,15 @@
 #ifndef _TIMER_H_
 #define _TIMER_H_
 
-#include <sys/time.h>
+#include <time.h>
 
-/* The argument now should be a double (not a pointer to a double) */
+/* The argument now should be a double (not a pointer to a double). Reads
+ * the monotonic clock, so intervals are immune to wall-clock adjustments
+ * and accurate to the nanosecond. */
 #define GET_TIME(now); { \
-   struct timeval t; \
-   gettimeofday(&t, NULL); \
-   now = t.tv_sec + t.tv_usec/1000000.0; \
+   struct timespec t; \
+   clock_gettime(CLOCK_MONOTONIC, &t); \
+   now = t.tv_sec + t.tv_nsec/1000000000.0; \
 }
 
 #endif